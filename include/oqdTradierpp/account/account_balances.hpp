@@ -15,6 +15,7 @@
 
 #include <simdjson.h>
 #include <string>
+#include "oqdTradierpp/core/json_fwd.hpp"
 
 namespace oqd {
 
@@ -42,6 +43,7 @@ struct AccountBalances {
     
     static AccountBalances from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,324 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "oqdTradierpp/account/account_balances.hpp"
+#include "oqdTradierpp/account/position.hpp"
+#include "oqdTradierpp/endpoints.hpp"
+#include "oqdTradierpp/trading/order.hpp"
+
+namespace oqd {
+
+// One request of a snapshot: the decoded value, or the error that replaced it.
+template<typename T>
+struct SnapshotPart {
+    std::optional<T> value;
+    std::string error;
+    std::chrono::microseconds latency{0};   // request issued to response decoded
+
+    bool ok() const { return value.has_value(); }
+};
+
+// A decoded response and the moment the worker finished decoding it.
+template<typename T>
+struct Timed {
+    T value;
+    std::chrono::steady_clock::time_point completed;
+};
+
+// The value type behind a possibly Timed result.
+template<typename T>
+struct untimed {
+    using type = T;
+    static constexpr bool stamped = false;
+};
+template<typename T>
+struct untimed<Timed<T>> {
+    using type = T;
+    static constexpr bool stamped = true;
+};
+
+// Wraps a decoder so its result is stamped on the worker. Fetches handed to
+// issue_request() should decode through it: an unstamped response can only
+// be timed when it is collected, which may be long after it arrived.
+template<typename Decode>
+auto stamp_completion(Decode decode) {
+    return [decode = std::move(decode)](const auto& response) {
+        using T = std::decay_t<decltype(decode(response))>;
+        return Timed<T>{decode(response), std::chrono::steady_clock::now()};
+    };
+}
+
+struct AccountSnapshot {
+    std::string account_id;
+    SnapshotPart<AccountBalances> balances;
+    SnapshotPart<std::vector<Position>> positions;
+    SnapshotPart<std::vector<Order>> orders;
+
+    bool ok() const { return balances.ok() && positions.ok() && orders.ok(); }
+    std::chrono::microseconds latency() const {
+        return std::max({balances.latency, positions.latency, orders.latency});
+    }
+};
+
+struct AccountsSnapshot {
+    std::vector<AccountSnapshot> accounts;          // in the order the ids were given
+    std::chrono::microseconds elapsed{0};           // wall time for the whole snapshot
+    std::chrono::microseconds budget_wait{0};       // summed time requests waited on the rate budget
+    std::size_t budget_waits = 0;                   // requests the budget held back
+    std::size_t requests = 0;
+
+    bool ok() const {
+        return std::all_of(accounts.begin(), accounts.end(), [](const AccountSnapshot& a) { return a.ok(); });
+    }
+    std::vector<std::string> failed_accounts() const {
+        std::vector<std::string> failed;
+        for (const auto& account : accounts) {
+            if (!account.ok()) {
+                failed.push_back(account.account_id);
+            }
+        }
+        return failed;
+    }
+};
+
+struct AccountSnapshotOptions {
+    std::size_t max_in_flight = 64;
+    // Account endpoints share one per-minute budget. The client's last
+    // X-Ratelimit-Available/Expiry reading, when current, caps the first window.
+    int requests_per_window = endpoints::accounts::balances::rate_limit;
+    std::chrono::seconds window{60};
+    bool include_tags = false;
+};
+
+// Fixed-window request budget: up to `per_window` acquisitions per window,
+// later callers block until the next window opens. A non-positive
+// `per_window` admits everything.
+class RequestWindowBudget {
+public:
+    using clock = std::chrono::steady_clock;
+
+    RequestWindowBudget(int per_window, clock::duration window,
+                        std::optional<int> available_now = std::nullopt,
+                        clock::time_point current_window_end = {})
+        : per_window_(per_window), window_(window) {
+        auto now = clock::now();
+        if (available_now && current_window_end > now) {
+            remaining_ = std::clamp(*available_now, 0, per_window_);
+            // A server window never outlasts our own; this bounds any wait.
+            window_end_ = std::min(current_window_end, now + window_);
+        } else {
+            remaining_ = per_window_;
+            window_end_ = now + window_;
+        }
+    }
+
+    // Returns how long the caller was held back.
+    clock::duration acquire() {
+        if (per_window_ <= 0) {
+            return clock::duration::zero();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto now = clock::now();
+        if (now >= window_end_) {
+            remaining_ = per_window_;
+            window_end_ = now + window_;
+        }
+        if (remaining_ > 0) {
+            --remaining_;
+            return clock::duration::zero();
+        }
+        // Waiters queue on the mutex, so they are released in arrival order.
+        std::this_thread::sleep_until(window_end_);
+        auto woke = clock::now();
+        remaining_ = per_window_ - 1;
+        window_end_ = woke + window_;
+        return woke - now;
+    }
+
+private:
+    std::mutex mutex_;
+    int per_window_;
+    clock::duration window_;
+    int remaining_ = 0;
+    clock::time_point window_end_;
+};
+
+// A request that has been issued but not yet collected. `ready` polls the
+// response without blocking; `collect` waits for it and records the outcome.
+// A deferred future (a ResponseCache join) cannot be polled, so it counts as
+// ready and collecting it waits on the request it joined.
+struct InFlightRequest {
+    std::function<bool()> ready;
+    std::function<void()> collect;
+};
+
+// Issues `fetch(args...)` and returns its slot. On collection `record` is
+// called with the value (or std::nullopt), the error text and the latency.
+// A fetch whose future yields Timed<T> is timed from issue to its completion
+// stamp; any other result, and every error, from issue to collection. A
+// fetch that throws instead of returning a future is recorded as that
+// request's error.
+template<typename Fetch, typename Record, typename... Args>
+InFlightRequest issue_request(Fetch& fetch, Record record, const Args&... args) {
+    using clock = std::chrono::steady_clock;
+    using Result = std::decay_t<decltype(fetch(args...).get())>;
+
+    auto issued = clock::now();
+    auto response = std::make_shared<std::future<Result>>();
+    try {
+        *response = fetch(args...);
+    } catch (...) {
+        std::promise<Result> failed;
+        failed.set_exception(std::current_exception());
+        *response = failed.get_future();
+    }
+
+    return InFlightRequest{
+        [response] { return response->wait_for(std::chrono::seconds(0)) != std::future_status::timeout; },
+        [response, record = std::move(record), issued]() mutable {
+            std::optional<typename untimed<Result>::type> value;
+            std::string error;
+            std::optional<clock::time_point> completed;
+            try {
+                if constexpr (untimed<Result>::stamped) {
+                    auto timed = response->get();
+                    value = std::move(timed.value);
+                    completed = timed.completed;
+                } else {
+                    value = response->get();
+                }
+            } catch (const std::exception& e) {
+                error = e.what();
+            } catch (...) {
+                error = "unknown error";
+            }
+            if (!completed) {
+                completed = clock::now();
+            }
+            record(std::move(value), std::move(error),
+                   std::chrono::duration_cast<std::chrono::microseconds>(*completed - issued));
+        }};
+}
+
+struct InFlightStats {
+    std::chrono::microseconds budget_wait{0};
+    std::size_t budget_waits = 0;
+};
+
+// Issues `issue(i)` for every i in [0, count) from the calling thread, each
+// admitted by `budget`, with at most `max_in_flight` requests outstanding.
+// When the bound is reached every response already in is collected; if none
+// is, the caller waits on the oldest. No thread is started here: requests
+// run wherever their futures do.
+template<typename Issue>
+InFlightStats run_in_flight(std::size_t count, std::size_t max_in_flight,
+                            RequestWindowBudget& budget, Issue&& issue) {
+    const std::size_t limit = std::max<std::size_t>(1, max_in_flight);
+    std::vector<InFlightRequest> in_flight;
+    in_flight.reserve(std::min(count, limit));
+
+    auto drain_to = [&in_flight](std::size_t target) {
+        while (in_flight.size() > target) {
+            auto before = in_flight.size();
+            std::erase_if(in_flight, [](InFlightRequest& request) {
+                if (!request.ready()) {
+                    return false;
+                }
+                request.collect();
+                return true;
+            });
+            if (in_flight.size() == before) {
+                in_flight.front().collect();
+                in_flight.erase(in_flight.begin());
+            }
+        }
+    };
+
+    InFlightStats stats;
+    for (std::size_t i = 0; i < count; ++i) {
+        drain_to(limit - 1);
+        auto waited = budget.acquire();
+        if (waited > RequestWindowBudget::clock::duration::zero()) {
+            stats.budget_wait += std::chrono::duration_cast<std::chrono::microseconds>(waited);
+            ++stats.budget_waits;
+        }
+        in_flight.push_back(issue(i));
+    }
+    drain_to(0);
+    return stats;
+}
+
+// Fetches balances, positions and orders for every account with up to
+// `options.max_in_flight` requests outstanding at once, each admitted by
+// `budget`. Each fetch is `(const std::string& account_id) -> std::future<T>`,
+// or std::future<Timed<T>> to time each part by its completion stamp.
+// Requests are issued account by account, so when the budget runs dry the
+// accounts already started are complete rather than every account partial.
+template<typename FetchBalances, typename FetchPositions, typename FetchOrders>
+AccountsSnapshot gather_account_snapshots(std::span<const std::string> account_ids,
+                                          const AccountSnapshotOptions& options,
+                                          RequestWindowBudget& budget,
+                                          FetchBalances&& fetch_balances,
+                                          FetchPositions&& fetch_positions,
+                                          FetchOrders&& fetch_orders) {
+    using clock = std::chrono::steady_clock;
+    auto started = clock::now();
+
+    AccountsSnapshot snapshot;
+    snapshot.accounts.resize(account_ids.size());
+    for (std::size_t i = 0; i < account_ids.size(); ++i) {
+        snapshot.accounts[i].account_id = account_ids[i];
+    }
+
+    auto into = [](auto& part) {
+        return [&part](auto value, std::string error, std::chrono::microseconds latency) {
+            part.value = std::move(value);
+            part.error = std::move(error);
+            part.latency = latency;
+        };
+    };
+
+    const std::size_t tasks = account_ids.size() * 3;
+    auto stats = run_in_flight(tasks, options.max_in_flight, budget, [&](std::size_t task) {
+        auto& account = snapshot.accounts[task / 3];
+        switch (task % 3) {
+            case 0: return issue_request(fetch_balances, into(account.balances), account.account_id);
+            case 1: return issue_request(fetch_positions, into(account.positions), account.account_id);
+            default: return issue_request(fetch_orders, into(account.orders), account.account_id);
+        }
+    });
+
+    snapshot.requests = tasks;
+    snapshot.budget_wait = stats.budget_wait;
+    snapshot.budget_waits = stats.budget_waits;
+    snapshot.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - started);
+    return snapshot;
+}
+
+} // namespace oqd
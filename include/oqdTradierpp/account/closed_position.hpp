@@ -0,0 +1,42 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <simdjson.h>
+
+namespace oqd {
+
+// Compact realized gain/loss lot with parsed open and close dates.
+struct ClosedPosition {
+    std::chrono::sys_days open_date{};
+    std::chrono::sys_days close_date{};
+    double quantity = 0.0;
+    double cost = 0.0;
+    double proceeds = 0.0;
+    double gain_loss = 0.0;
+    double gain_loss_percent = 0.0;
+    std::int32_t term = 0;       // Holding period in days
+    std::string symbol;
+
+    static ClosedPosition from_json(const simdjson::dom::element& elem);
+    // Decodes every closed position of a /gainloss response; "null" and a
+    // single collapsed entry are handled.
+    static std::vector<ClosedPosition> list_from_json(const simdjson::dom::element& response);
+};
+
+} // namespace oqd
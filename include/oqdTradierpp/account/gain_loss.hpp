@@ -15,6 +15,7 @@
 
 #include <vector>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 #include "gain_loss_item.hpp"
 
 namespace oqd {
@@ -24,6 +25,7 @@ struct GainLoss {
     
     static GainLoss from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <simdjson.h>
+
+namespace oqd {
+
+enum class HistoryEventType : std::uint8_t {
+    Trade,
+    Option,
+    Ach,
+    Wire,
+    Dividend,
+    Fee,
+    Tax,
+    Journal,
+    Check,
+    Transfer,
+    Adjustment,
+    Interest,
+    Other
+};
+
+std::string_view to_string(HistoryEventType type);
+HistoryEventType history_event_type_from_string(std::string_view str);
+
+// Compact account history entry. Tradier nests the per-event details under a
+// key named after the event type ({"type":"trade","trade":{...}}); from_json
+// flattens them and parses the date once, so reconciliation code can compare
+// and bucket events without touching strings.
+struct HistoryEvent {
+    std::chrono::sys_days date{};
+    HistoryEventType type = HistoryEventType::Other;
+    double amount = 0.0;
+    double quantity = 0.0;
+    double price = 0.0;
+    double commission = 0.0;
+    std::string symbol;
+    std::string description;
+
+    static HistoryEvent from_json(const simdjson::dom::element& elem);
+    // Decodes every event of a /history response; "null" and a single
+    // collapsed event are handled.
+    static std::vector<HistoryEvent> list_from_json(const simdjson::dom::element& response);
+};
+
+} // namespace oqd
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 
 namespace oqd {
 
@@ -31,6 +32,7 @@ struct HistoryItem {
     
     static HistoryItem from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 }
\ No newline at end of file
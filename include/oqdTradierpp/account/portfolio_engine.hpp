@@ -0,0 +1,137 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "oqdTradierpp/api.hpp"
+#include "oqdTradierpp/streaming.hpp"
+#include "oqdTradierpp/trading/order_tracker.hpp"
+
+namespace oqd {
+
+struct PositionMark {
+    std::string symbol;
+    double quantity = 0.0;
+    double avg_cost = 0.0;          // per share / per contract unit, excluding multiplier
+    double multiplier = 1.0;
+    double mark_price = 0.0;
+    double market_value = 0.0;
+    double unrealized_pl = 0.0;
+    double realized_pl = 0.0;
+    bool marked = false;            // true once a quote has been applied
+    std::chrono::system_clock::time_point last_update;
+};
+
+struct PortfolioSnapshot {
+    double cash = 0.0;
+    double market_value = 0.0;
+    double long_market_value = 0.0;
+    double short_market_value = 0.0;
+    double gross_exposure = 0.0;
+    double net_exposure = 0.0;
+    double unrealized_pl = 0.0;
+    double realized_pl = 0.0;
+    double equity = 0.0;
+    std::size_t open_positions = 0;
+};
+
+// Incrementally marked book of an account's positions.
+//
+// The engine is seeded once from get_account_positions/get_account_balances and
+// afterwards applies fills (typically from an OrderTracker) and streaming quotes.
+// Each symbol owns a fixed slot; a tick only replaces that slot's contribution to
+// the running totals, so marking and reading totals are O(1) regardless of book
+// size. Realized P&L uses average cost and counts from the moment of seeding.
+class PortfolioEngine {
+public:
+    PortfolioEngine() = default;
+    PortfolioEngine(std::shared_ptr<ApiMethods> api, std::string account_id);
+
+    PortfolioEngine(const PortfolioEngine&) = delete;
+    PortfolioEngine& operator=(const PortfolioEngine&) = delete;
+
+    // Replaces the book with a REST snapshot of positions and balances.
+    void seed();
+    void seed(const std::vector<Position>& positions, const AccountBalances& balances);
+
+    // Applies an execution. Buys add to the position, sells reduce it.
+    void apply_fill(const OrderFill& fill);
+    void apply_fill(const std::string& symbol, OrderSide side, double quantity, double price);
+
+    // Marks a symbol at the quote midpoint, falling back to the last price.
+    // Returns false when the symbol is not held or the quote carries no price.
+    bool on_quote(const StreamingQuote& quote);
+    bool mark(const std::string& symbol, double price);
+
+    // Decodes and applies a raw market stream element; non-quote events are ignored.
+    bool on_stream_event(const simdjson::dom::element& elem);
+
+    // Callback suitable for StreamingSession::start_market_*_stream.
+    StreamingCallback stream_callback();
+
+    // Routes every fill reported by the tracker into this engine.
+    void attach(OrderTracker& tracker);
+
+    std::optional<PositionMark> position(const std::string& symbol) const;
+    std::vector<PositionMark> positions() const;
+    std::vector<std::string> symbols() const;
+    PortfolioSnapshot snapshot() const;
+
+    double cash() const;
+    double equity() const;
+    double unrealized_pl() const;
+    double realized_pl() const;
+    double gross_exposure() const;
+    double net_exposure() const;
+
+    void clear();
+
+    // 100 for OCC option symbols, 1 otherwise.
+    static double contract_multiplier(const std::string& symbol);
+    static double signed_quantity(OrderSide side, double quantity) { return is_buy(side) ? quantity : -quantity; }
+
+private:
+    struct Totals {
+        double market_value = 0.0;
+        double long_market_value = 0.0;
+        double short_market_value = 0.0;
+        double gross_exposure = 0.0;
+        double unrealized_pl = 0.0;
+        double realized_pl = 0.0;
+        std::size_t open_positions = 0;
+    };
+
+    PositionMark& slot_for(const std::string& symbol);
+    PositionMark* find_slot(const std::string& symbol);
+    void revalue(PositionMark& slot);
+    void add_contribution(const PositionMark& slot, double sign);
+    void reset_locked();
+
+    std::shared_ptr<ApiMethods> api_;
+    std::string account_id_;
+
+    mutable std::shared_mutex mutex_;
+    std::vector<PositionMark> slots_;
+    std::unordered_map<std::string, std::size_t> slot_index_;
+    Totals totals_;
+    double cash_ = 0.0;
+};
+
+} // namespace oqd
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 
 namespace oqd {
 
@@ -27,6 +28,7 @@ struct Position {
     
     static Position from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 }
\ No newline at end of file
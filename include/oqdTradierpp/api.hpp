@@ -13,18 +13,39 @@
 
 #pragma once
 
+#include "account/account_snapshot.hpp"
 #include "client.hpp"
+#include "core/price.hpp"
+#include "paged_range.hpp"
+#include "response_cache.hpp"
+#include "trading/order_batch.hpp"
+#include "trading/order_guard.hpp"
 #include "types.hpp"
 #include <vector>
 #include <string>
 #include <optional>
 #include <future>
+#include <functional>
+#include <span>
 
 namespace oqd {
 
 class ApiMethods {
 public:
     explicit ApiMethods(std::shared_ptr<TradierClient> client);
+
+    // Decoded responses from endpoints with a cache_ttl_seconds are kept in a
+    // ResponseCache. Pass nullptr to disable caching, or share one cache
+    // between several ApiMethods instances on the same account. Not
+    // synchronized: set it before requests are issued from other threads.
+    void set_response_cache(std::shared_ptr<ResponseCache> cache) { cache_ = std::move(cache); }
+    const std::shared_ptr<ResponseCache>& response_cache() const { return cache_; }
+
+    // Every place_*_order call is screened by the guard first; a rejected
+    // order fails with OrderGuardException without reaching the network.
+    // Share one guard between instances to rate-limit them together.
+    void set_submission_guard(std::shared_ptr<OrderSubmissionGuard> guard) { guard_ = std::move(guard); }
+    const std::shared_ptr<OrderSubmissionGuard>& submission_guard() const { return guard_; }
     
     // Authentication
     std::string get_oauth_url(const std::string& redirect_uri, const std::string& scope = "") const;
@@ -60,6 +81,19 @@ public:
     std::vector<Order> get_account_orders(const std::string& account_id, bool include_tags = false);
     Order get_individual_order(const std::string& account_id, const std::string& order_id);
 
+    // Paged history and realized gain/loss as compact records with parsed
+    // dates. The next `prefetch` pages are requested concurrently while the
+    // current one is consumed. The ranges share this client and may outlive
+    // the ApiMethods object.
+    PagedRange<HistoryEvent> history_pages(const std::string& account_id, int page_size = 100, int prefetch = 3);
+    PagedRange<ClosedPosition> gainloss_pages(const std::string& account_id, int page_size = 100, int prefetch = 3);
+
+    // Balances, positions and orders for many accounts at once. All requests
+    // run concurrently over the client's pooled connections, paced by the
+    // account rate budget; failures are reported per account and part.
+    AccountsSnapshot snapshot_accounts(std::span<const std::string> account_ids,
+                                       const AccountSnapshotOptions& options = {});
+
     // Trading
     std::future<OrderPreview> preview_order_async(const std::string& account_id, const OrderRequest& order);
     std::future<OrderResponse> place_equity_order_async(const std::string& account_id, const EquityOrderRequest& order);
@@ -68,6 +102,15 @@ public:
     std::future<OrderResponse> place_combo_order_async(const std::string& account_id, const ComboOrderRequest& order);
     std::future<OrderResponse> modify_order_async(const std::string& account_id, const std::string& order_id, const OrderModification& modification);
     std::future<OrderResponse> cancel_order_async(const std::string& account_id, const std::string& order_id);
+
+    // Exact-price variants: `price` (and `stop`, when given) replace the
+    // request's double fields and are sent with at most four decimals.
+    std::future<OrderResponse> place_equity_order_async(const std::string& account_id, const EquityOrderRequest& order,
+                                                        Price price, std::optional<Price> stop = std::nullopt);
+    std::future<OrderResponse> place_option_order_async(const std::string& account_id, const OptionOrderRequest& order,
+                                                        Price price, std::optional<Price> stop = std::nullopt);
+    std::future<OrderResponse> place_multileg_order_async(const std::string& account_id, const MultilegOrderRequest& order, Price price);
+    std::future<OrderResponse> place_combo_order_async(const std::string& account_id, const ComboOrderRequest& order, Price price);
     
     // Advanced Order Types
     std::future<OrderResponse> place_oto_order_async(const std::string& account_id, const OTOOrderRequest& order);
@@ -80,6 +123,12 @@ public:
     OrderResponse place_option_order(const std::string& account_id, const OptionOrderRequest& order);
     OrderResponse place_multileg_order(const std::string& account_id, const MultilegOrderRequest& order);
     OrderResponse place_combo_order(const std::string& account_id, const ComboOrderRequest& order);
+    OrderResponse place_equity_order(const std::string& account_id, const EquityOrderRequest& order,
+                                     Price price, std::optional<Price> stop = std::nullopt);
+    OrderResponse place_option_order(const std::string& account_id, const OptionOrderRequest& order,
+                                     Price price, std::optional<Price> stop = std::nullopt);
+    OrderResponse place_multileg_order(const std::string& account_id, const MultilegOrderRequest& order, Price price);
+    OrderResponse place_combo_order(const std::string& account_id, const ComboOrderRequest& order, Price price);
     
     // Advanced Order Types
     OrderResponse place_oto_order(const std::string& account_id, const OTOOrderRequest& order);
@@ -90,6 +139,22 @@ public:
     OrderResponse modify_order(const std::string& account_id, const std::string& order_id, const OrderModification& modification);
     OrderResponse cancel_order(const std::string& account_id, const std::string& order_id);
 
+    // Batches: every order is sent concurrently, up to options.max_in_flight
+    // at once and paced by the trading rate budget. Results come back per
+    // order, in input order; one failure never stops the rest. Cancels reuse
+    // pooled connections; placements get a fresh one each, as single orders do.
+    OrderBatchResult place_orders_batch(const std::string& account_id, std::span<const EquityOrderRequest> orders,
+                                        const OrderBatchOptions& options = {});
+    OrderBatchResult place_orders_batch(const std::string& account_id, std::span<const OptionOrderRequest> orders,
+                                        const OrderBatchOptions& options = {});
+    OrderBatchResult cancel_orders_batch(const std::string& account_id, std::span<const std::string> order_ids,
+                                         const OrderBatchOptions& options = {});
+    // Reads the live order list and cancels every working order `filter`
+    // accepts (all of them when it is empty).
+    OrderBatchResult cancel_all(const std::string& account_id,
+                                const std::function<bool(const Order&)>& filter = {},
+                                const OrderBatchOptions& options = {});
+
     // Market Data
     std::future<std::vector<Quote>> get_quotes_async(const std::vector<std::string>& symbols, bool include_greeks = false);
     std::future<OptionChain> get_option_chain_async(const std::string& symbol, const std::string& expiration, bool include_greeks = false);
@@ -103,6 +168,23 @@ public:
                                                                 const std::string& interval = "tick",
                                                                 std::optional<std::string> start = std::nullopt,
                                                                 std::optional<std::string> end = std::nullopt);
+    std::future<TimeSalesSeries> get_time_and_sales_series_async(const std::string& symbol,
+                                                                 const std::string& interval = "tick",
+                                                                 std::optional<std::string> start = std::nullopt,
+                                                                 std::optional<std::string> end = std::nullopt);
+    // Streaming variants for long ranges: each bar or tick is decoded and passed
+    // to `on_bar`/`on_tick` while the rest of the response is still arriving.
+    // The future yields the number of records delivered.
+    std::future<std::size_t> stream_historical_data_async(const std::string& symbol,
+                                                          std::function<void(const HistoricalData&)> on_bar,
+                                                          const std::string& interval = "daily",
+                                                          std::optional<std::string> start = std::nullopt,
+                                                          std::optional<std::string> end = std::nullopt);
+    std::future<std::size_t> stream_time_and_sales_async(const std::string& symbol,
+                                                         std::function<void(const TimeSales&)> on_tick,
+                                                         const std::string& interval = "tick",
+                                                         std::optional<std::string> start = std::nullopt,
+                                                         std::optional<std::string> end = std::nullopt);
     std::future<MarketClock> get_market_clock_async();
     std::future<std::vector<MarketDay>> get_market_calendar_async(std::optional<int> month = std::nullopt, std::optional<int> year = std::nullopt);
     std::future<std::vector<CompanySearch>> search_companies_async(const std::string& query, bool include_indexes = false);
@@ -121,6 +203,10 @@ public:
                                              const std::string& interval = "tick",
                                              std::optional<std::string> start = std::nullopt,
                                              std::optional<std::string> end = std::nullopt);
+    TimeSalesSeries get_time_and_sales_series(const std::string& symbol,
+                                              const std::string& interval = "tick",
+                                              std::optional<std::string> start = std::nullopt,
+                                              std::optional<std::string> end = std::nullopt);
     MarketClock get_market_clock();
     std::vector<MarketDay> get_market_calendar(std::optional<int> month = std::nullopt, std::optional<int> year = std::nullopt);
     std::vector<CompanySearch> search_companies(const std::string& query, bool include_indexes = false);
@@ -128,13 +214,20 @@ public:
     std::vector<std::string> get_etb_list();
 
     // Fundamentals (Beta)
-    std::future<std::vector<CompanyInfo>> get_company_info_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<FinancialRatios>> get_financial_ratios_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<CorporateActions>> get_corporate_actions_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<CorporateFinancials>> get_corporate_financials_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<PriceStatistics>> get_price_statistics_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<DividendInfo>> get_dividend_info_async(const std::vector<std::string>& symbols);
-    std::future<std::vector<CorporateCalendar>> get_corporate_calendar_async(const std::vector<std::string>& symbols);
+    std::future<std::vector<CompanyInfo>> get_company_info_async(const std::vector<std::string>& symbols,
+                                                                 const RequestOptions& options = {});
+    std::future<std::vector<FinancialRatios>> get_financial_ratios_async(const std::vector<std::string>& symbols,
+                                                                         const RequestOptions& options = {});
+    std::future<std::vector<CorporateActions>> get_corporate_actions_async(const std::vector<std::string>& symbols,
+                                                                           const RequestOptions& options = {});
+    std::future<std::vector<CorporateFinancials>> get_corporate_financials_async(const std::vector<std::string>& symbols,
+                                                                                 const RequestOptions& options = {});
+    std::future<std::vector<PriceStatistics>> get_price_statistics_async(const std::vector<std::string>& symbols,
+                                                                         const RequestOptions& options = {});
+    std::future<std::vector<DividendInfo>> get_dividend_info_async(const std::vector<std::string>& symbols,
+                                                                   const RequestOptions& options = {});
+    std::future<std::vector<CorporateCalendar>> get_corporate_calendar_async(const std::vector<std::string>& symbols,
+                                                                             const RequestOptions& options = {});
 
     std::vector<CompanyInfo> get_company_info(const std::vector<std::string>& symbols);
     std::vector<FinancialRatios> get_financial_ratios(const std::vector<std::string>& symbols);
@@ -167,9 +260,31 @@ public:
 
 private:
     std::shared_ptr<TradierClient> client_;
-    
-    template<typename T>
-    std::future<T> parse_response_async(std::future<simdjson::dom::element> response_future);
+    std::shared_ptr<ResponseCache> cache_;
+    std::shared_ptr<OrderSubmissionGuard> guard_;
+
+    template<typename Request>
+    GuardVerdict screen(const std::string& account_id, const Request& order) const;
+
+    // Request builders behind the *_async methods. `wrap` is applied to the
+    // decoder; the snapshot and batch paths use it to stamp completion.
+    template<typename Wrap>
+    auto request_account_balances(const std::string& account_id, Wrap wrap);
+    template<typename Wrap>
+    auto request_account_positions(const std::string& account_id, Wrap wrap);
+    template<typename Wrap>
+    auto request_account_orders(const std::string& account_id, bool include_tags, Wrap wrap);
+    template<typename Wrap>
+    auto submit_equity_order(const std::string& account_id, const EquityOrderRequest& order, Wrap wrap);
+    template<typename Wrap>
+    auto submit_option_order(const std::string& account_id, const OptionOrderRequest& order, Wrap wrap);
+    template<typename Wrap>
+    auto request_order_cancel(const std::string& account_id, const std::string& order_id, Wrap wrap);
+
+    template<typename T, typename Decode>
+    std::future<T> cached_get(const endpoints::EndpointConfig& endpoint,
+                              const std::unordered_map<std::string, std::string>& params,
+                              Decode decode, const RequestOptions& options = {});
     
     template<typename T>
     T parse_response(const simdjson::dom::element& response);
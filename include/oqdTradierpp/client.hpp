@@ -13,15 +13,20 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <future>
 #include <concepts>
 #include <ranges>
 #include <unordered_map>
+#include <vector>
 #include <chrono>
 #include <functional>
+#include <type_traits>
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
@@ -31,7 +36,11 @@
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/url.hpp>
 #include <simdjson.h>
+#include "connection_pool.hpp"
+#include "core/padded_body.hpp"
 #include "endpoints.hpp"
+#include "metrics.hpp"
+#include "single_flight.hpp"
 #include "utils.hpp"
 
 namespace oqd {
@@ -72,6 +81,12 @@ struct RequestOptions {
     std::unordered_map<std::string, std::string> headers;
     bool follow_redirects = true;
     int max_redirects = 5;
+    // Identical GETs issued while one is in flight share its response. Requests
+    // with custom headers never share.
+    bool share_in_flight = true;
+    // ApiMethods answers cacheable GETs from its response cache. Off skips the
+    // cache for both lookup and store, for reads that will not be repeated.
+    bool use_cache = true;
 };
 
 struct RateLimit {
@@ -87,12 +102,31 @@ public:
 
     TradierClient(const TradierClient&) = delete;
     TradierClient& operator=(const TradierClient&) = delete;
+    // Requests in flight run on workers that hold this client's address, so
+    // a client must not be moved or assigned to until they have completed.
+    // Share a client across owners through a shared_ptr instead.
     TradierClient(TradierClient&&) = default;
-    TradierClient& operator=(TradierClient&&) = default;
+    TradierClient& operator=(TradierClient&& other) noexcept;
 
     void set_access_token(const std::string& token);
     void set_client_credentials(const std::string& client_id, const std::string& client_secret);
     void set_environment(Environment env);
+    // Sends REST requests to another https origin, e.g. a proxy or a local
+    // test server. set_environment() restores the environment's URL.
+    void set_base_url(const std::string& url);
+    // Ask for gzip/deflate responses on requests read into padded buffers (the
+    // *_then, shared and streamed paths). On by default; bodies are inflated
+    // while they are read, so callers always see plain JSON.
+    void set_compression_enabled(bool enabled) { toggles_->compression.store(enabled, std::memory_order_relaxed); }
+    bool compression_enabled() const { return toggles_->compression.load(std::memory_order_relaxed); }
+    // Keep TLS connections open between requests and reuse them. On by
+    // default. A GET, PUT or DELETE that fails on a reused connection before
+    // the response starts is retried once on a fresh one; a POST always opens
+    // a fresh connection so an order is never sent twice, but hands it back
+    // to the pool afterwards. Disabling drops every idle connection.
+    void set_connection_pooling(bool enabled);
+    bool connection_pooling() const { return toggles_->connection_pooling.load(std::memory_order_acquire); }
+    std::size_t idle_connections() const { return connections_->idle_count(); }
     
     const std::string& get_access_token() const { return access_token_; }
 
@@ -128,11 +162,21 @@ public:
                                           const std::unordered_map<std::string, std::string>& params = {},
                                           const RequestOptions& options = {});
 
+    // Last X-Ratelimit reading for an endpoint group. The string overloads
+    // take a group name ("accounts", "trading", ...) or an endpoint path.
+    std::optional<RateLimit> get_rate_limit(EndpointGroup group) const;
     std::optional<RateLimit> get_rate_limit(const std::string& endpoint_group) const;
     
+    bool is_rate_limited(EndpointGroup group) const;
     bool is_rate_limited(const std::string& endpoint_group) const;
 
     const std::string& get_base_url() const { return base_url_; }
+
+    // Client-side metrics: per endpoint group request counts, errors, bytes,
+    // phase latencies and rate-limit waits.
+    MetricsSnapshot get_metrics() const { return metrics_->snapshot(); }
+    std::string get_metrics_prometheus() const { return to_prometheus(metrics_->snapshot()); }
+    MetricsRegistry& metrics_registry() const { return *metrics_; }
     
     template<typename Endpoint>
     std::future<simdjson::dom::element> get_endpoint_async(const Endpoint& endpoint,
@@ -151,11 +195,124 @@ public:
                                                            const RequestOptions& options = {}) {
         static_assert(std::is_same_v<std::string_view, decltype(endpoint.path)>,
                       "Endpoint must have constexpr path field");
-        std::string endpoint_group = std::string(endpoint.path);
-        check_rate_limit(endpoint_group);
+        check_rate_limit(std::string(endpoint.path), "POST");
         return post_async(std::string(endpoint.path), params, options);
     }
 
+    // Single-hop requests: the worker that performs the request also parses the
+    // body and runs `decode` on it, so a call costs one thread and the element
+    // never outlives the parser that produced it. The future carries whatever
+    // `decode` returns.
+    //
+    // GETs are de-duplicated on method, base URL, path and canonical query: a call made
+    // while an identical one is in flight sends nothing, and its decode runs
+    // against the leader's parsed document on the leader's worker, so its
+    // future becomes ready with the leader's.
+    template<typename Decode>
+    auto request_then(boost::beast::http::verb method,
+                      const std::string& endpoint,
+                      const std::unordered_map<std::string, std::string>& params,
+                      Decode decode,
+                      const RequestOptions& options = {})
+        -> std::future<std::invoke_result_t<Decode&, const simdjson::dom::element&>> {
+        using Result = std::invoke_result_t<Decode&, const simdjson::dom::element&>;
+        auto prepared = prepare_request(method, endpoint, params, options);
+
+        if (method == boost::beast::http::verb::get && options.share_in_flight && options.headers.empty()) {
+            auto ticket = in_flight_gets_->join("GET " + utils::canonical_request_key(endpoint, params, base_url_));
+            if (!ticket.leader()) {
+                metrics_->record_coalesced(prepared.group);
+                auto promise = std::make_shared<std::promise<Result>>();
+                auto future = promise->get_future();
+                in_flight_gets_->then(ticket, [promise, decode = std::move(decode)](const auto& shared) mutable {
+                    try {
+                        if constexpr (std::is_void_v<Result>) {
+                            decode(shared.get()->root);
+                            promise->set_value();
+                        } else {
+                            promise->set_value(decode(shared.get()->root));
+                        }
+                    } catch (...) {
+                        promise->set_exception(std::current_exception());
+                    }
+                });
+                return future;
+            }
+            return std::async(std::launch::async,
+                              [this, ticket, prepared = std::move(prepared), decode = std::move(decode)]() mutable -> Result {
+                std::shared_ptr<const SharedResponse> shared;
+                try {
+                    shared = fetch_shared(std::move(prepared));
+                } catch (...) {
+                    in_flight_gets_->fail(ticket, std::current_exception());
+                    throw;
+                }
+                in_flight_gets_->complete(ticket, shared);
+                return decode(shared->root);
+            });
+        }
+
+        return std::async(std::launch::async,
+                          [this, prepared = std::move(prepared), decode = std::move(decode)]() mutable -> Result {
+            simdjson::dom::parser parser;
+            auto element = fetch_into(parser, std::move(prepared));
+            return decode(element);
+        });
+    }
+
+    template<typename Decode>
+    auto get_then(const std::string& endpoint, const std::unordered_map<std::string, std::string>& params,
+                  Decode decode, const RequestOptions& options = {}) {
+        return request_then(boost::beast::http::verb::get, endpoint, params, std::move(decode), options);
+    }
+
+    template<typename Decode>
+    auto post_then(const std::string& endpoint, const std::unordered_map<std::string, std::string>& params,
+                   Decode decode, const RequestOptions& options = {}) {
+        return request_then(boost::beast::http::verb::post, endpoint, params, std::move(decode), options);
+    }
+
+    template<typename Decode>
+    auto put_then(const std::string& endpoint, const std::unordered_map<std::string, std::string>& params,
+                  Decode decode, const RequestOptions& options = {}) {
+        return request_then(boost::beast::http::verb::put, endpoint, params, std::move(decode), options);
+    }
+
+    template<typename Decode>
+    auto delete_then(const std::string& endpoint, const std::unordered_map<std::string, std::string>& params,
+                     Decode decode, const RequestOptions& options = {}) {
+        return request_then(boost::beast::http::verb::delete_, endpoint, params, std::move(decode), options);
+    }
+
+    template<typename Endpoint, typename Decode>
+    auto get_endpoint_then(const Endpoint& endpoint, const std::unordered_map<std::string, std::string>& params,
+                           Decode decode, const RequestOptions& options = {}) {
+        static_assert(std::is_same_v<std::string_view, decltype(endpoint.path)>,
+                      "Endpoint must have constexpr path field");
+        check_rate_limit(std::string(endpoint.path));
+        return get_then(std::string(endpoint.path), params, std::move(decode), options);
+    }
+
+    template<typename Endpoint, typename Decode>
+    auto post_endpoint_then(const Endpoint& endpoint, const std::unordered_map<std::string, std::string>& params,
+                            Decode decode, const RequestOptions& options = {}) {
+        static_assert(std::is_same_v<std::string_view, decltype(endpoint.path)>,
+                      "Endpoint must have constexpr path field");
+        check_rate_limit(std::string(endpoint.path), "POST");
+        return post_then(std::string(endpoint.path), params, std::move(decode), options);
+    }
+
+    // Streams a large GET: elements of the array at `array_path` (object keys
+    // from the root, e.g. {"history", "day"}) are parsed and handed to
+    // `on_element` as soon as each one has fully arrived, overlapping decoding
+    // with the network read. The element is only valid during the call. The
+    // future yields the number of elements delivered.
+    std::future<std::size_t> get_streamed_async(const std::string& endpoint,
+                                                const std::unordered_map<std::string, std::string>& params,
+                                                std::vector<std::string> array_path,
+                                                std::function<void(const simdjson::dom::element&)> on_element,
+                                                const RequestOptions& options = {});
+
 private:
     Environment environment_;
     std::string base_url_;
@@ -163,18 +320,56 @@ private:
     std::string access_token_;
     std::string client_id_;
     std::string client_secret_;
+    // Toggled by callers while workers build requests; held on the heap so the
+    // client stays movable.
+    struct RuntimeToggles {
+        std::atomic<bool> compression{true};
+        std::atomic<bool> connection_pooling{true};
+    };
+    std::unique_ptr<RuntimeToggles> toggles_;
     
-    mutable std::unordered_map<std::string, RateLimit> rate_limits_;
+    // Written by request workers, read by callers; one slot per endpoint group.
+    struct RateLimitTable {
+        std::mutex mutex;
+        std::array<std::optional<RateLimit>, static_cast<std::size_t>(EndpointGroup::Count)> limits;
+    };
+    std::unique_ptr<RateLimitTable> rate_limits_;
     
     std::unique_ptr<boost::asio::io_context> io_context_;
     std::unique_ptr<boost::asio::ssl::context> ssl_context_;
     simdjson::dom::parser json_parser_;
+    std::unique_ptr<MetricsRegistry> metrics_;
+
+    // One parsed GET body, read concurrently by every caller that joined it.
+    struct SharedResponse {
+        simdjson::dom::parser parser;
+        simdjson::dom::element root;
+    };
+    std::unique_ptr<SingleFlight<std::shared_ptr<const SharedResponse>>> in_flight_gets_;
+    std::unique_ptr<PaddedBufferPool> body_buffers_;
+    using TlsStream = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
+    // Declared after io_context_ so idle streams are closed before it goes away.
+    std::unique_ptr<ConnectionPool<TlsStream>> connections_;
 
     void initialize_ssl_context();
     void update_base_url();
-    void check_rate_limit(const std::string& endpoint_group) const;
-    void update_rate_limit(const std::string& endpoint_group, 
-                          const boost::beast::http::response<boost::beast::http::string_body>& response);
+    struct PreparedRequest {
+        boost::beast::http::request<boost::beast::http::string_body> request;
+        EndpointGroup group;
+    };
+
+    void check_rate_limit(const std::string& endpoint, std::string_view method = "GET") const;
+    PreparedRequest prepare_request(boost::beast::http::verb method,
+                                    const std::string& endpoint,
+                                    const std::unordered_map<std::string, std::string>& params,
+                                    const RequestOptions& options) const;
+    simdjson::dom::element parse_json(const std::string& body, EndpointGroup group);
+    simdjson::dom::element parse_json(simdjson::dom::parser& parser, const std::string& body, EndpointGroup group);
+    simdjson::dom::element parse_json(simdjson::dom::parser& parser, const PaddedBuffer& body, EndpointGroup group);
+    // Reads the response into a pooled padded buffer and parses it in place.
+    simdjson::dom::element fetch_into(simdjson::dom::parser& parser, PreparedRequest prepared);
+    std::shared_ptr<const SharedResponse> fetch_shared(PreparedRequest prepared);
+    void update_rate_limit(EndpointGroup group, const boost::beast::http::fields& headers);
     
     std::string build_url(const std::string& endpoint, 
                          const std::unordered_map<std::string, std::string>& params) const;
@@ -193,6 +388,16 @@ private:
 
     boost::beast::http::response<boost::beast::http::string_body>
     perform_request(boost::beast::http::request<boost::beast::http::string_body> request);
+
+    std::unique_ptr<TlsStream> open_connection(const std::string& host, const std::string& port,
+                                               RequestMetricsScope& scope);
+
+    // Shared transport for every body type; instantiated in oqdTradierpp.cpp
+    // for string_body and padded_body.
+    template<typename Body>
+    boost::beast::http::response<Body>
+    perform_request_into(boost::beast::http::request<boost::beast::http::string_body> request,
+                         typename Body::value_type body);
 };
 
 } // namespace oqd
\ No newline at end of file
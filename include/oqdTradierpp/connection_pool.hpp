@@ -0,0 +1,107 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace oqd {
+
+// Idle keep-alive connections, keyed by "host:port".
+//
+// A request takes the most recently returned connection for its host (the one
+// least likely to have been closed by the server) and hands it back once the
+// response has been read completely and the server agreed to keep it open.
+// Connections idle longer than `idle_timeout`, or beyond `max_idle_per_host`,
+// are dropped. The pool never opens connections itself.
+template<typename Stream>
+class ConnectionPool {
+public:
+    using clock = std::chrono::steady_clock;
+
+    explicit ConnectionPool(std::size_t max_idle_per_host = 32,
+                            clock::duration idle_timeout = std::chrono::seconds(30))
+        : max_idle_per_host_(max_idle_per_host), idle_timeout_(idle_timeout) {}
+
+    std::unique_ptr<Stream> acquire(const std::string& key) {
+        std::vector<Idle> expired;
+        std::unique_ptr<Stream> stream;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = idle_.find(key);
+            if (it == idle_.end()) {
+                return nullptr;
+            }
+            auto& idle = it->second;
+            auto cutoff = clock::now() - idle_timeout_;
+            while (!idle.empty()) {
+                Idle candidate = std::move(idle.back());
+                idle.pop_back();
+                if (candidate.since >= cutoff) {
+                    stream = std::move(candidate.stream);
+                    break;
+                }
+                expired.push_back(std::move(candidate));
+            }
+        }
+        // Expired connections are closed outside the lock.
+        return stream;
+    }
+
+    void release(const std::string& key, std::unique_ptr<Stream> stream) {
+        if (!stream || max_idle_per_host_ == 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& idle = idle_[key];
+        if (idle.size() >= max_idle_per_host_) {
+            idle.erase(idle.begin());
+        }
+        idle.push_back({std::move(stream), clock::now()});
+    }
+
+    void clear() {
+        std::unordered_map<std::string, std::vector<Idle>> dropped;
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropped.swap(idle_);
+    }
+
+    std::size_t idle_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t count = 0;
+        for (const auto& [key, idle] : idle_) {
+            count += idle.size();
+        }
+        return count;
+    }
+
+private:
+    struct Idle {
+        std::unique_ptr<Stream> stream;
+        clock::time_point since;
+    };
+
+    std::size_t max_idle_per_host_;
+    clock::duration idle_timeout_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::vector<Idle>> idle_;
+};
+
+} // namespace oqd
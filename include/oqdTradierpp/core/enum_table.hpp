@@ -0,0 +1,94 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace oqd {
+
+// Compile-time name table for a contiguous enum (0..N-1).
+//
+// name() is an array index. parse() hashes the length and the first, middle
+// and last characters into a slot table whose seed is searched at compile
+// time, so a lookup is one hash, one load and one comparison; the constructor
+// fails to compile if no collision-free seed exists.
+template<typename Enum, std::size_t N>
+class EnumTable {
+public:
+    static constexpr std::size_t slot_count = N <= 8 ? 16 : 64;
+
+    constexpr explicit EnumTable(const std::array<std::string_view, N>& names) : names_(names) {
+        for (std::uint32_t seed = 1; seed < 4096; ++seed) {
+            if (try_seed(seed)) {
+                return;
+            }
+        }
+        throw "EnumTable: no collision-free hash seed";
+    }
+
+    constexpr std::string_view name(Enum value, std::string_view fallback = "unknown") const {
+        auto index = static_cast<std::size_t>(value);
+        return index < N ? names_[index] : fallback;
+    }
+
+    constexpr std::optional<Enum> parse(std::string_view text) const {
+        if (text.empty()) {
+            return std::nullopt;
+        }
+        auto index = slots_[hash(text, seed_)];
+        if (index == empty_slot || names_[index] != text) {
+            return std::nullopt;
+        }
+        return static_cast<Enum>(index);
+    }
+
+    constexpr const std::array<std::string_view, N>& names() const { return names_; }
+
+private:
+    static constexpr std::uint8_t empty_slot = 0xFF;
+
+    static constexpr std::size_t hash(std::string_view text, std::uint32_t seed) {
+        std::uint32_t first = static_cast<unsigned char>(text.front());
+        std::uint32_t middle = static_cast<unsigned char>(text[text.size() / 2]);
+        std::uint32_t last = static_cast<unsigned char>(text.back());
+        std::uint32_t h = static_cast<std::uint32_t>(text.size()) * 0x9E3779B1u;
+        h ^= first * seed;
+        h ^= middle * (seed * 0x85EBCA6Bu + 1u);
+        h ^= last * (seed * 0xC2B2AE35u + 3u);
+        return (h ^ (h >> 15)) % slot_count;
+    }
+
+    constexpr bool try_seed(std::uint32_t seed) {
+        slots_.fill(empty_slot);
+        for (std::size_t i = 0; i < N; ++i) {
+            auto& slot = slots_[hash(names_[i], seed)];
+            if (slot != empty_slot) {
+                return false;
+            }
+            slot = static_cast<std::uint8_t>(i);
+        }
+        seed_ = seed;
+        return true;
+    }
+
+    std::array<std::string_view, N> names_;
+    std::array<std::uint8_t, slot_count> slots_{};
+    std::uint32_t seed_ = 0;
+};
+
+} // namespace oqd
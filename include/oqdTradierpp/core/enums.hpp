@@ -13,7 +13,8 @@
 
 #pragma once
 
-#include <string>
+#include <string_view>
+#include "enum_table.hpp"
 
 namespace oqd {
 
@@ -60,16 +61,37 @@ enum class OrderStatus {
     Pending,
     Rejected
 };
-std::string to_string(OrderClass order_class);
-std::string to_string(OrderType order_type);
-std::string to_string(OrderDuration duration);
-std::string to_string(OrderSide side);
-std::string to_string(OrderStatus status);
 
-OrderClass order_class_from_string(const std::string& str);
-OrderType order_type_from_string(const std::string& str);
-OrderDuration order_duration_from_string(const std::string& str);
-OrderSide order_side_from_string(const std::string& str);
-OrderStatus order_status_from_string(const std::string& str);
+// Wire names, indexed by enumerator. to_string() returns views into these
+// tables, so serializing an enum never allocates.
+inline constexpr EnumTable<OrderClass, 7> order_class_names{{
+    "equity", "option", "multileg", "combo", "oto", "oco", "otoco"}};
+inline constexpr EnumTable<OrderType, 4> order_type_names{{
+    "market", "limit", "stop", "stop_limit"}};
+inline constexpr EnumTable<OrderDuration, 4> order_duration_names{{
+    "day", "gtc", "pre", "post"}};
+inline constexpr EnumTable<OrderSide, 7> order_side_names{{
+    "buy", "sell", "sell_short", "buy_to_open", "buy_to_close", "sell_to_open", "sell_to_close"}};
+inline constexpr EnumTable<OrderStatus, 7> order_status_names{{
+    "open", "partially_filled", "filled", "expired", "canceled", "pending", "rejected"}};
+
+constexpr std::string_view to_string(OrderClass order_class) { return order_class_names.name(order_class); }
+constexpr std::string_view to_string(OrderType order_type) { return order_type_names.name(order_type); }
+constexpr std::string_view to_string(OrderDuration duration) { return order_duration_names.name(duration); }
+constexpr std::string_view to_string(OrderSide side) { return order_side_names.name(side); }
+constexpr std::string_view to_string(OrderStatus status) { return order_status_names.name(status); }
+
+// Buy, buy-to-open and buy-to-close add to a position; every other side reduces it.
+constexpr bool is_buy(OrderSide side) {
+    return side == OrderSide::Buy || side == OrderSide::BuyToOpen || side == OrderSide::BuyToClose;
+}
+
+// Unknown names fall back to the first enumerator; use the tables' parse()
+// to detect them instead.
+OrderClass order_class_from_string(std::string_view str);
+OrderType order_type_from_string(std::string_view str);
+OrderDuration order_duration_from_string(std::string_view str);
+OrderSide order_side_from_string(std::string_view str);
+OrderStatus order_status_from_string(std::string_view str);
 
 } // namespace oqd
\ No newline at end of file
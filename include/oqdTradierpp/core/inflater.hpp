@@ -0,0 +1,72 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string_view>
+
+namespace oqd {
+
+class PaddedBuffer;
+
+enum class ContentEncoding {
+    Identity,
+    Gzip,
+    Deflate
+};
+
+// Maps a Content-Encoding header value; empty means identity. Returns nullopt
+// for encodings the client cannot decode (e.g. "br").
+std::optional<ContentEncoding> content_encoding_from_string(std::string_view value);
+
+// Incremental gzip/deflate decoder writing straight into a PaddedBuffer.
+//
+// zlib's inflate state carries a 32 KB window and is costly to set up, so
+// instances are leased from a process-wide free list with acquire() and reset
+// with begin() for every response instead of being created per request.
+class Inflater {
+public:
+    struct Release {
+        void operator()(Inflater* inflater) const;
+    };
+    using Lease = std::unique_ptr<Inflater, Release>;
+
+    static Lease acquire();
+
+    Inflater();
+    ~Inflater();
+
+    Inflater(const Inflater&) = delete;
+    Inflater& operator=(const Inflater&) = delete;
+
+    void begin(ContentEncoding encoding);
+
+    // Decodes `size` bytes and appends the output to `out`. Returns false on
+    // corrupt input. Bytes after the end of the stream are ignored.
+    bool write(const char* data, std::size_t size, PaddedBuffer& out);
+
+    bool finished() const { return finished_; }
+
+private:
+    struct Stream;
+
+    std::unique_ptr<Stream> stream_;
+    ContentEncoding encoding_ = ContentEncoding::Identity;
+    bool started_ = false;
+    bool finished_ = false;
+};
+
+} // namespace oqd
@@ -0,0 +1,72 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace oqd {
+
+// Incremental scanner that finds the elements of one array in a JSON document
+// while the document is still arriving.
+//
+// The array is named by the object keys leading to it from the root, e.g.
+// {"history", "day"} for /v1/markets/history. Tradier collapses one-element
+// arrays into a bare object; that object is reported as the single element.
+// scan() is given the whole document received so far each time, resumes where
+// it stopped and appends the [begin, end) byte ranges of every element that has
+// become complete. Keys are compared without unescaping.
+class JsonArraySplitter {
+public:
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    explicit JsonArraySplitter(std::vector<std::string> path);
+
+    void scan(std::string_view document, std::vector<Range>& elements);
+    void reset();
+
+    bool found() const { return element_depth_ != npos; }
+    bool done() const { return done_; }
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    struct Level {
+        bool object;
+        bool expect_key;
+        std::string key;
+    };
+
+    void value_begin(std::string_view document, std::size_t at);
+    void value_end(std::size_t end, std::vector<Range>& elements);
+    bool at_path() const;
+
+    std::vector<std::string> path_;
+    std::vector<Level> stack_;
+    std::size_t position_ = 0;
+    std::size_t key_start_ = 0;
+    std::size_t scalar_start_ = npos;
+    std::size_t element_start_ = npos;
+    std::size_t element_depth_ = npos;
+    bool single_ = false;
+    bool in_string_ = false;
+    bool string_is_key_ = false;
+    bool escape_ = false;
+    bool done_ = false;
+};
+
+} // namespace oqd
@@ -14,14 +14,18 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <optional>
 #include <vector>
 #include <type_traits>
 #include <array>  
-#include <cstdio> 
+#include <cstring>
 #include <charconv>
-#include <sstream>
-#include <iomanip>
+#include <memory_resource>
+#include <span>
+#include "json_fwd.hpp"
+#include "number_format.hpp"
+#include "price.hpp"
 
 namespace oqd {
 namespace json {
@@ -29,9 +33,118 @@ namespace json {
 template<typename T>
 std::string to_string(const T& value); 
 
+// Types that serialize themselves into a caller's builder. Nested values are
+// appended to the parent's buffer in place instead of going through a
+// temporary to_json() string.
+template<typename T>
+concept JsonWritable = requires(const T& value, JsonBuilder& builder) {
+    value.write_json(builder);
+};
+
+// Where a JsonBuilder's output goes: a string it owns, or a caller-owned
+// std::string, std::pmr::string or fixed span. A fixed span that runs out of
+// room stops accepting writes and reports overflowed(); the bytes written so
+// far are then an incomplete document.
+class JsonSink {
+public:
+    JsonSink() = default;
+    explicit JsonSink(std::string& target) : kind_(Kind::String), string_(&target) {}
+    explicit JsonSink(std::pmr::string& target) : kind_(Kind::PmrString), pmr_(&target) {}
+    explicit JsonSink(std::span<char> target) : kind_(Kind::Fixed), fixed_(target) {}
+
+    void append(const char* data, std::size_t size) {
+        switch (kind_) {
+            case Kind::Owned: owned_.append(data, size); break;
+            case Kind::String: string_->append(data, size); break;
+            case Kind::PmrString: pmr_->append(data, size); break;
+            case Kind::Fixed:
+                if (overflow_ || size > fixed_.size() - fixed_size_) {
+                    overflow_ = true;
+                    break;
+                }
+                std::memcpy(fixed_.data() + fixed_size_, data, size);
+                fixed_size_ += size;
+                break;
+        }
+    }
+
+    JsonSink& operator+=(char c) {
+        append(&c, 1);
+        return *this;
+    }
+
+    JsonSink& operator+=(std::string_view text) {
+        append(text.data(), text.size());
+        return *this;
+    }
+
+    void reserve(std::size_t capacity) {
+        switch (kind_) {
+            case Kind::Owned: owned_.reserve(capacity); break;
+            case Kind::String: string_->reserve(capacity); break;
+            case Kind::PmrString: pmr_->reserve(capacity); break;
+            case Kind::Fixed: break;
+        }
+    }
+
+    std::string_view view() const {
+        switch (kind_) {
+            case Kind::Owned: return owned_;
+            case Kind::String: return *string_;
+            case Kind::PmrString: return *pmr_;
+            case Kind::Fixed: break;
+        }
+        return {fixed_.data(), fixed_size_};
+    }
+
+    std::size_t length() const { return view().size(); }
+    bool overflowed() const { return overflow_; }
+
+    // Empties the target but keeps its capacity.
+    void clear() {
+        switch (kind_) {
+            case Kind::Owned: owned_.clear(); break;
+            case Kind::String: string_->clear(); break;
+            case Kind::PmrString: pmr_->clear(); break;
+            case Kind::Fixed: fixed_size_ = 0; break;
+        }
+        overflow_ = false;
+    }
+
+    // The owned string, or the caller's std::string; other targets are copied
+    // into the owned string first.
+    const std::string& str() const {
+        if (kind_ == Kind::String) {
+            return *string_;
+        }
+        if (kind_ != Kind::Owned) {
+            owned_.assign(view());
+        }
+        return owned_;
+    }
+
+    std::string take() {
+        if (kind_ == Kind::Owned) {
+            return std::move(owned_);
+        }
+        return std::string(view());
+    }
+
+private:
+    enum class Kind : unsigned char { Owned, String, PmrString, Fixed };
+
+    Kind kind_ = Kind::Owned;
+    mutable std::string owned_;
+    std::string* string_ = nullptr;
+    std::pmr::string* pmr_ = nullptr;
+    std::span<char> fixed_;
+    std::size_t fixed_size_ = 0;
+    bool overflow_ = false;
+};
+
 class JsonBuilder {
 private:
-    std::string buffer_;
+    JsonSink buffer_;
     bool first_field_ = true;
     int precision_ = -1;
     bool fixed_notation_ = false;
@@ -54,6 +167,9 @@ public:
     JsonBuilder(JsonBuilder&&) = default;            
     JsonBuilder& operator=(JsonBuilder&&) = default; 
 
+    // Writes into a caller-owned target; see JsonWriter.
+    explicit JsonBuilder(JsonSink sink) : buffer_(std::move(sink)) {}
+
     JsonBuilder& set_precision(int p) { precision_ = p; return *this; }
     JsonBuilder& set_fixed(bool f = true) { fixed_notation_ = f; return *this; }
 
@@ -63,8 +179,11 @@ public:
         return *this;
     }
 
+    // A closed container is a value of its parent, so the next sibling needs
+    // a comma even when the container itself was empty.
     JsonBuilder& end_object() {
         buffer_ += '}';
+        first_field_ = false;
         return *this;
     }
 
@@ -76,11 +195,12 @@ public:
 
     JsonBuilder& end_array() {
         buffer_ += ']';
+        first_field_ = false;
         return *this;
     }
 
     template<typename T>
-    JsonBuilder& field(const std::string& key, const T& value) {
+    JsonBuilder& field(std::string_view key, const T& value) {
         add_comma();
         add_key(key);
         add_value(value);
@@ -88,7 +208,7 @@ public:
     }
 
     template<typename T>
-    JsonBuilder& field_optional(const std::string& key, const std::optional<T>& value) {
+    JsonBuilder& field_optional(std::string_view key, const std::optional<T>& value) {
         if (value.has_value()) {
             field(key, value.value());
         }
@@ -103,7 +223,7 @@ public:
     }
 
     template<typename T>
-    JsonBuilder& array_field(const std::string& key, const std::vector<T>& values) {
+    JsonBuilder& array_field(std::string_view key, const std::vector<T>& values) {
         add_comma();
         add_key(key);
         start_array();
@@ -114,8 +234,11 @@ public:
         return *this;
     }
 
-    const std::string& str() const & { return buffer_; } 
-    std::string str() && { return std::move(buffer_); }  
+    const std::string& str() const & { return buffer_.str(); } 
+    std::string str() && { return buffer_.take(); }  
+    // Everything written so far, without copying, whatever the target.
+    std::string_view view() const { return buffer_.view(); }
+    bool overflowed() const { return buffer_.overflowed(); }
 
     void clear() {
         buffer_.clear();
@@ -130,7 +253,7 @@ private:
         first_field_ = false;
     }
 
-    void add_key(const std::string& key) {
+    void add_key(std::string_view key) {
         buffer_ += '"';
         buffer_ += key; 
         buffer_ += "\":";
@@ -168,27 +291,32 @@ private:
 
 
     void add_value(double value) {
-        if (precision_ >= 0 && fixed_notation_) {
-            std::array<char, 64> temp_buf;
-            int len = std::snprintf(temp_buf.data(), temp_buf.size(), "%.*f", precision_, value);
-            if (len > 0 && len < static_cast<int>(temp_buf.size())) {
-                buffer_.append(temp_buf.data(), len);
-            } else {
-                std::ostringstream oss;
-                oss << std::fixed << std::setprecision(precision_) << value;
-                buffer_ += oss.str();
-            }
+        std::array<char, 64> temp_buf;
+        auto [ptr, ec] = precision_ >= 0 && fixed_notation_
+            ? format_fixed(temp_buf.data(), temp_buf.data() + temp_buf.size(), value, precision_)
+            : format_shortest(temp_buf.data(), temp_buf.data() + temp_buf.size(), value);
+        if (ec == std::errc()) {
+            buffer_.append(temp_buf.data(), ptr - temp_buf.data());
         } else {
-            std::array<char, 64> temp_buf;
-            auto [ptr, ec] = std::to_chars(temp_buf.data(), temp_buf.data() + temp_buf.size(), value);
-            if (ec == std::errc()) {
-                buffer_.append(temp_buf.data(), ptr - temp_buf.data());
-            } else {
-                buffer_ += std::to_string(value);
-            }
+            add_wide_fixed(value);
+        }
+    }
+
+    // Fixed notation of a huge magnitude (1e300 has 301 integer digits).
+    void add_wide_fixed(double value) {
+        std::string wide(320 + static_cast<std::size_t>(precision_), '\0');
+        auto [ptr, ec] = format_fixed(wide.data(), wide.data() + wide.size(), value, precision_);
+        if (ec == std::errc()) {
+            buffer_.append(wide.data(), ptr - wide.data());
         }
     }
 
+    void add_value(Price value) {
+        std::array<char, 32> temp_buf;
+        auto [ptr, ec] = value.to_chars(temp_buf.data(), temp_buf.data() + temp_buf.size());
+        buffer_.append(temp_buf.data(), ptr - temp_buf.data());
+    }
+
     void add_value(bool value) {
         buffer_ += value ? "true" : "false";
     }
@@ -206,8 +334,20 @@ private:
         buffer_ += '"';
     }
 
+    // Nested writable objects: the child keeps its own number format, so the
+    // parent's is restored afterwards.
+    template<JsonWritable T>
+    void add_value(const T& value) {
+        int precision = precision_;
+        bool fixed = fixed_notation_;
+        value.write_json(*this);
+        precision_ = precision;
+        fixed_notation_ = fixed;
+    }
+
     // Handle objects with to_json() method (fallback)
     template<typename T>
+        requires (!JsonWritable<T>)
     auto add_value(const T& value)
         -> std::enable_if_t<!std::is_enum_v<T>, decltype(value.to_json(), void())>
     {
@@ -262,10 +402,46 @@ private:
 
 template<typename T>
 std::enable_if_t<std::is_enum_v<T>, JsonBuilder&>
-add_enum_field(JsonBuilder& builder, const std::string& key, const T& value) {
+add_enum_field(JsonBuilder& builder, std::string_view key, const T& value) {
     return builder.field(key, to_string(value));
 }
 
+// A JsonBuilder over storage the caller owns, for serialization loops that
+// should not allocate once warmed up: reuse one std::string (thread_scratch()
+// gives a per-thread one), draw from a std::pmr arena, or fill a fixed span
+// and check overflowed(). Output is appended to whatever the target holds;
+// clear() empties it without releasing capacity.
+class JsonWriter : public JsonBuilder {
+public:
+    explicit JsonWriter(std::string& target) : JsonBuilder(JsonSink(target)) {}
+    explicit JsonWriter(std::pmr::string& target) : JsonBuilder(JsonSink(target)) {}
+    explicit JsonWriter(std::span<char> target) : JsonBuilder(JsonSink(target)) {}
+};
+
+// Per-thread scratch string, emptied on every call. A view taken from it is
+// valid until the next call on the same thread, so nested users need their
+// own buffer.
+inline std::string& thread_scratch() {
+    thread_local std::string scratch;
+    scratch.clear();
+    return scratch;
+}
+
+// Appends `value` to `writer` and returns everything the writer holds.
+template<JsonWritable T>
+std::string_view to_json_into(JsonBuilder& writer, const T& value) {
+    value.write_json(writer);
+    return writer.view();
+}
+
+// Backs to_json() for JsonWritable types.
+template<JsonWritable T>
+std::string write_to_string(const T& value) {
+    JsonBuilder builder;
+    value.write_json(builder);
+    return std::move(builder).str();
+}
+
 inline JsonBuilder create_object() {
     JsonBuilder builder;
     builder.start_object();
@@ -0,0 +1,84 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+
+namespace oqd::json {
+
+namespace detail {
+
+inline constexpr std::array<std::uint64_t, 5> decimal_scales{1, 10, 100, 1000, 10000};
+
+// Below this the scaled product is within 2^-14 of the exact one, so a
+// fraction more than 1e-3 away from one half rounds the same way.
+inline constexpr double max_scaled_integer = 1e12;
+inline constexpr double tie_margin = 1e-3;
+
+inline std::to_chars_result write_scaled(char* first, char* last, bool negative,
+                                         std::uint64_t units, int precision) {
+    const std::uint64_t scale = decimal_scales[precision];
+    if (negative) {
+        if (first == last) {
+            return {last, std::errc::value_too_large};
+        }
+        *first++ = '-';
+    }
+    auto result = std::to_chars(first, last, units / scale);
+    if (result.ec != std::errc() || precision == 0) {
+        return result;
+    }
+    if (last - result.ptr < precision + 1) {
+        return {last, std::errc::value_too_large};
+    }
+    char* out = result.ptr;
+    *out++ = '.';
+    std::uint64_t fraction = units % scale;
+    for (int digit = precision - 1; digit >= 0; --digit) {
+        out[digit] = static_cast<char>('0' + fraction % 10);
+        fraction /= 10;
+    }
+    return {out + precision, std::errc()};
+}
+
+} // namespace detail
+
+// Formats `value` with `precision` decimals, digit for digit what
+// printf("%.*f") prints but independent of the locale. Prices and
+// quantities (up to four decimals, below 10^12 once scaled) are rounded as
+// scaled integers; ties and everything else go through std::to_chars.
+inline std::to_chars_result format_fixed(char* first, char* last, double value, int precision) {
+    if (precision >= 0 && precision < static_cast<int>(detail::decimal_scales.size())) {
+        const double scaled = std::fabs(value) * static_cast<double>(detail::decimal_scales[precision]);
+        if (scaled < detail::max_scaled_integer) {
+            const double whole = std::floor(scaled);
+            const double fraction = scaled - whole;
+            if (std::fabs(fraction - 0.5) > detail::tie_margin) {
+                auto units = static_cast<std::uint64_t>(whole) + (fraction > 0.5 ? 1 : 0);
+                return detail::write_scaled(first, last, std::signbit(value), units, precision);
+            }
+        }
+    }
+    return std::to_chars(first, last, value, std::chars_format::fixed, precision);
+}
+
+// Shortest text that parses back to the same double.
+inline std::to_chars_result format_shortest(char* first, char* last, double value) {
+    return std::to_chars(first, last, value);
+}
+
+} // namespace oqd::json
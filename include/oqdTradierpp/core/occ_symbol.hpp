@@ -0,0 +1,267 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include "oqdTradierpp/core/price.hpp"
+
+namespace oqd {
+
+// Shares per standard listed option contract.
+inline constexpr double option_multiplier = 100.0;
+
+// OCC option symbol (root + YYMMDD + C/P + strike in thousandths, e.g.
+// SPY240119C00450000) packed into 96 bits: the root as a base-37 number,
+// the expiry as days since 2000-01-01 and the right and strike in one word.
+// Parsing and formatting are single passes with no allocation, and the
+// packed fields order exactly as the symbol strings do, so it works as a
+// key for sorted chains, hash maps and flat tables alike.
+class OccSymbol {
+public:
+    enum class Right : std::uint8_t { Call, Put };
+
+    static constexpr std::size_t max_root_length = 6;
+    // Unpadded text: root + 15 fixed characters.
+    static constexpr std::size_t max_length = max_root_length + 15;
+    static constexpr std::int64_t max_strike_thousandths = 99999999;
+
+    constexpr OccSymbol() = default;
+
+    // Accepts the compact form Tradier uses and the space-padded 21-character
+    // OCC form. Rejects impossible dates, roots not starting with a letter
+    // and anything but A-Z/0-9 in the root.
+    static constexpr std::optional<OccSymbol> parse(std::string_view text) {
+        if (text.size() < 16 || text.size() > max_length) {
+            return std::nullopt;
+        }
+        const std::size_t tail = text.size() - 15;
+        std::size_t root_length = tail;
+        while (root_length > 0 && text[root_length - 1] == ' ') {
+            --root_length;
+        }
+        auto root = encode_root(text.substr(0, root_length));
+        if (!root) {
+            return std::nullopt;
+        }
+
+        int date[3] = {};
+        for (std::size_t i = 0; i < 6; ++i) {
+            const char c = text[tail + i];
+            if (c < '0' || c > '9') {
+                return std::nullopt;
+            }
+            date[i / 2] = date[i / 2] * 10 + (c - '0');
+        }
+        const char right = text[tail + 6];
+        if (right != 'C' && right != 'P') {
+            return std::nullopt;
+        }
+        std::uint32_t strike = 0;
+        for (std::size_t i = tail + 7; i < text.size(); ++i) {
+            const char c = text[i];
+            if (c < '0' || c > '9') {
+                return std::nullopt;
+            }
+            strike = strike * 10 + static_cast<std::uint32_t>(c - '0');
+        }
+
+        auto expiry = encode_expiry(date[0], date[1], date[2]);
+        if (!expiry || strike == 0) {
+            return std::nullopt;
+        }
+        return OccSymbol(*root, *expiry, right == 'P' ? Right::Put : Right::Call, strike);
+    }
+
+    // Expiry must fall in 2000-2099 and the strike on the 1/1000 grid OCC uses.
+    static constexpr std::optional<OccSymbol> make(std::string_view root, std::chrono::year_month_day expiry,
+                                                   Right right, Price strike) {
+        auto code = encode_root(root);
+        if (!code || !expiry.ok()) {
+            return std::nullopt;
+        }
+        const int year = static_cast<int>(expiry.year());
+        if (year < 2000 || year > 2099) {
+            return std::nullopt;
+        }
+        const auto days = std::chrono::sys_days(expiry) - epoch();
+        const std::int64_t ticks = strike.ticks();
+        if (ticks <= 0 || ticks % 10 != 0 || ticks / 10 > max_strike_thousandths) {
+            return std::nullopt;
+        }
+        return OccSymbol(*code, static_cast<std::uint16_t>(days.count()), right, static_cast<std::uint32_t>(ticks / 10));
+    }
+
+    constexpr bool valid() const { return root_ != 0; }
+
+    constexpr std::uint32_t root_code() const { return root_; }
+    constexpr std::size_t root_length() const {
+        std::size_t length = 0;
+        while (length < max_root_length && (root_ / root_scale(length)) % radix != 0) {
+            ++length;
+        }
+        return length;
+    }
+    // Compares without decoding; false for anything that is not a valid root.
+    constexpr bool has_root(std::string_view root) const {
+        auto code = encode_root(root);
+        return code && *code == root_;
+    }
+    std::string root() const {
+        std::array<char, max_root_length> text;
+        return std::string(text.data(), write_root(text.data()));
+    }
+
+    constexpr std::chrono::sys_days expiry_date() const { return epoch() + std::chrono::days(expiry_); }
+    constexpr std::chrono::year_month_day expiry() const { return std::chrono::year_month_day(expiry_date()); }
+
+    constexpr Right right() const { return (right_strike_ & put_bit) != 0 ? Right::Put : Right::Call; }
+    constexpr bool is_call() const { return right() == Right::Call; }
+    constexpr bool is_put() const { return right() == Right::Put; }
+
+    constexpr std::int64_t strike_thousandths() const { return right_strike_ & ~put_bit; }
+    constexpr Price strike() const { return Price::from_ticks(strike_thousandths() * 10); }
+
+    // Compact form, at most max_length characters.
+    std::to_chars_result to_chars(char* first, char* last) const {
+        std::array<char, max_length> text;
+        char* out = text.data() + write_root(text.data());
+        const auto ymd = expiry();
+        write_two(out, static_cast<int>(ymd.year()) - 2000);
+        write_two(out + 2, static_cast<int>(static_cast<unsigned>(ymd.month())));
+        write_two(out + 4, static_cast<int>(static_cast<unsigned>(ymd.day())));
+        out[6] = is_put() ? 'P' : 'C';
+        std::uint32_t strike = right_strike_ & ~put_bit;
+        for (int i = 14; i >= 7; --i) {
+            out[i] = static_cast<char>('0' + strike % 10);
+            strike /= 10;
+        }
+        out += 15;
+
+        const auto size = static_cast<std::size_t>(out - text.data());
+        if (static_cast<std::size_t>(last - first) < size) {
+            return {last, std::errc::value_too_large};
+        }
+        std::copy(text.data(), out, first);
+        return {first + size, std::errc()};
+    }
+
+    std::string to_string() const {
+        std::array<char, max_length> text;
+        return std::string(text.data(), to_chars(text.data(), text.data() + text.size()).ptr);
+    }
+
+    constexpr std::size_t hash() const {
+        std::uint64_t h = (static_cast<std::uint64_t>(root_) << 32 | right_strike_) ^
+                          (static_cast<std::uint64_t>(expiry_) * 0x9e3779b97f4a7c15ull);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    // Root, then expiry, then calls before puts, then strike: the order of
+    // the space-padded OCC strings.
+    constexpr auto operator<=>(const OccSymbol&) const = default;
+
+private:
+    static constexpr std::uint32_t put_bit = 1u << 31;
+    static constexpr std::uint32_t radix = 37;   // pad, 0-9, A-Z
+
+    constexpr OccSymbol(std::uint32_t root, std::uint16_t expiry, Right right, std::uint32_t strike)
+        : root_(root), expiry_(expiry), right_strike_(strike | (right == Right::Put ? put_bit : 0)) {}
+
+    static constexpr std::chrono::sys_days epoch() {
+        return std::chrono::sys_days(std::chrono::year(2000) / std::chrono::January / 1);
+    }
+
+    // Weight of the character at `position`, counted from the left.
+    static constexpr std::uint32_t root_scale(std::size_t position) {
+        constexpr std::array<std::uint32_t, max_root_length> scales = {
+            radix * radix * radix * radix * radix, radix * radix * radix * radix, radix * radix * radix,
+            radix * radix, radix, 1};
+        return scales[position];
+    }
+
+    static constexpr std::optional<std::uint32_t> encode_root(std::string_view root) {
+        if (root.empty() || root.size() > max_root_length || root[0] < 'A' || root[0] > 'Z') {
+            return std::nullopt;
+        }
+        std::uint32_t code = 0;
+        for (std::size_t i = 0; i < max_root_length; ++i) {
+            std::uint32_t digit = 0;
+            if (i < root.size()) {
+                const char c = root[i];
+                if (c >= '0' && c <= '9') {
+                    digit = 1 + static_cast<std::uint32_t>(c - '0');
+                } else if (c >= 'A' && c <= 'Z') {
+                    digit = 11 + static_cast<std::uint32_t>(c - 'A');
+                } else {
+                    return std::nullopt;
+                }
+            }
+            code = code * radix + digit;
+        }
+        return code;
+    }
+
+    static constexpr std::optional<std::uint16_t> encode_expiry(int yy, int mm, int dd) {
+        const std::chrono::year_month_day ymd{std::chrono::year(2000 + yy), std::chrono::month(static_cast<unsigned>(mm)),
+                                              std::chrono::day(static_cast<unsigned>(dd))};
+        if (!ymd.ok()) {
+            return std::nullopt;
+        }
+        return static_cast<std::uint16_t>((std::chrono::sys_days(ymd) - epoch()).count());
+    }
+
+    std::size_t write_root(char* out) const {
+        std::size_t length = 0;
+        std::uint32_t code = root_;
+        for (std::size_t i = 0; i < max_root_length; ++i) {
+            const std::uint32_t scale = root_scale(i);
+            const std::uint32_t digit = code / scale;
+            code %= scale;
+            if (digit == 0) {
+                break;
+            }
+            out[length++] = digit <= 10 ? static_cast<char>('0' + digit - 1) : static_cast<char>('A' + digit - 11);
+        }
+        return length;
+    }
+
+    static void write_two(char* out, int value) {
+        out[0] = static_cast<char>('0' + value / 10);
+        out[1] = static_cast<char>('0' + value % 10);
+    }
+
+    std::uint32_t root_ = 0;
+    std::uint16_t expiry_ = 0;
+    std::uint32_t right_strike_ = 0;
+};
+
+} // namespace oqd
+
+template<>
+struct std::hash<oqd::OccSymbol> {
+    std::size_t operator()(const oqd::OccSymbol& symbol) const noexcept { return symbol.hash(); }
+};
@@ -0,0 +1,232 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/beast/core/error.hpp>
+#include <boost/beast/http/error.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/optional.hpp>
+#include <simdjson.h>
+
+#include "inflater.hpp"
+
+namespace oqd {
+
+// Contiguous byte buffer that always keeps simdjson::SIMDJSON_PADDING readable
+// bytes past its capacity, so a body read into it can be parsed in place.
+class PaddedBuffer {
+public:
+    PaddedBuffer() = default;
+    PaddedBuffer(PaddedBuffer&&) noexcept = default;
+    PaddedBuffer& operator=(PaddedBuffer&&) noexcept = default;
+
+    void reserve(std::size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        auto grown = std::make_unique<char[]>(capacity + simdjson::SIMDJSON_PADDING);
+        if (size_ > 0) {
+            std::memcpy(grown.get(), data_.get(), size_);
+        }
+        data_ = std::move(grown);
+        capacity_ = capacity;
+    }
+
+    void append(const char* bytes, std::size_t count) {
+        std::memcpy(prepare(count), bytes, count);
+        size_ += count;
+    }
+
+    // Returns room for at least `count` bytes past the end; commit() then
+    // marks how many of them were written.
+    char* prepare(std::size_t count) {
+        if (size_ + count > capacity_) {
+            reserve(std::max(size_ + count, capacity_ * 2));
+        }
+        return data_.get() + size_;
+    }
+
+    void commit(std::size_t count) { size_ += count; }
+
+    void clear() {
+        size_ = 0;
+        encoded_bytes = 0;
+        decode_time = std::chrono::nanoseconds{0};
+    }
+
+    const char* data() const { return data_.get(); }
+    std::size_t size() const { return size_; }
+    std::size_t capacity() const { return capacity_; }
+    bool empty() const { return size_ == 0; }
+    std::string_view view() const { return {data_.get(), size_}; }
+
+    // Called after every append while a body is being read; used to decode
+    // complete elements before the rest of the body arrives.
+    std::function<void(const PaddedBuffer&)> on_append;
+
+    // Filled in by padded_body when the body arrived gzip/deflate encoded:
+    // bytes received before inflating and the time spent inflating them.
+    std::uint64_t encoded_bytes = 0;
+    std::chrono::nanoseconds decode_time{0};
+
+private:
+    std::unique_ptr<char[]> data_;
+    std::size_t size_ = 0;
+    std::size_t capacity_ = 0;
+};
+
+// Free list of PaddedBuffers so steady-state requests reuse already grown
+// allocations. Oversized buffers are dropped instead of being retained.
+class PaddedBufferPool {
+public:
+    explicit PaddedBufferPool(std::size_t max_buffers = 8, std::size_t max_buffer_bytes = 64u << 20)
+        : max_buffers_(max_buffers), max_buffer_bytes_(max_buffer_bytes) {}
+
+    PaddedBuffer acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.empty()) {
+            return {};
+        }
+        PaddedBuffer buffer = std::move(free_.back());
+        free_.pop_back();
+        return buffer;
+    }
+
+    void release(PaddedBuffer buffer) {
+        if (buffer.capacity() == 0 || buffer.capacity() > max_buffer_bytes_) {
+            return;
+        }
+        buffer.clear();
+        buffer.on_append = nullptr;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_.size() < max_buffers_) {
+            free_.push_back(std::move(buffer));
+        }
+    }
+
+    std::size_t available() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return free_.size();
+    }
+
+private:
+    const std::size_t max_buffers_;
+    const std::size_t max_buffer_bytes_;
+    mutable std::mutex mutex_;
+    std::vector<PaddedBuffer> free_;
+};
+
+// Beast Body that reads a message body into a PaddedBuffer, reserving the
+// whole Content-Length up front when the server sends one. A gzip or deflate
+// Content-Encoding is removed on the fly, so the buffer (and on_append) only
+// ever sees the decoded JSON.
+struct padded_body {
+    using value_type = PaddedBuffer;
+
+    // Cap on the decoded size of an encoded body.
+    static constexpr std::size_t max_decoded_bytes = std::size_t{1} << 30;
+
+    static std::uint64_t size(const value_type& body) { return body.size(); }
+
+    class reader {
+    public:
+        // The parser builds its reader before any header arrives, so only
+        // remember how to find Content-Encoding and look at it in init().
+        template<bool isRequest, class Fields>
+        reader(boost::beast::http::header<isRequest, Fields>& header, value_type& body)
+            : body_(body)
+            , content_encoding_([&header] {
+                auto value = header[boost::beast::http::field::content_encoding];
+                return std::string_view(value.data(), value.size());
+            }) {}
+
+        void init(const boost::optional<std::uint64_t>& length, boost::beast::error_code& ec) {
+            body_.clear();
+            auto encoding = content_encoding_from_string(content_encoding_());
+            if (!encoding) {
+                ec = boost::beast::http::error::bad_field;
+                return;
+            }
+            if (*encoding != ContentEncoding::Identity) {
+                inflater_ = Inflater::acquire();
+                inflater_->begin(*encoding);
+            }
+            if (length) {
+                // JSON usually shrinks 5-10x, so start an encoded body at 4x
+                // and let it grow from there.
+                auto expected = inflater_ ? *length * 4 : *length;
+                body_.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(expected, max_decoded_bytes)));
+            }
+            ec = {};
+        }
+
+        template<class ConstBufferSequence>
+        std::size_t put(const ConstBufferSequence& buffers, boost::beast::error_code& ec) {
+            std::size_t total = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (auto it = boost::asio::buffer_sequence_begin(buffers); it != boost::asio::buffer_sequence_end(buffers); ++it) {
+                boost::asio::const_buffer buffer = *it;
+                if (inflater_) {
+                    if (!inflater_->write(static_cast<const char*>(buffer.data()), buffer.size(), body_)) {
+                        ec = boost::beast::http::error::bad_chunk;
+                        return total;
+                    }
+                    body_.encoded_bytes += buffer.size();
+                } else {
+                    body_.append(static_cast<const char*>(buffer.data()), buffer.size());
+                }
+                total += buffer.size();
+            }
+            if (inflater_) {
+                body_.decode_time += std::chrono::steady_clock::now() - start;
+                if (body_.size() > max_decoded_bytes) {
+                    ec = boost::beast::http::error::body_limit;
+                    return total;
+                }
+            }
+            if (body_.on_append) {
+                body_.on_append(body_);
+            }
+            ec = {};
+            return total;
+        }
+
+        void finish(boost::beast::error_code& ec) {
+            ec = {};
+            if (inflater_ && !inflater_->finished()) {
+                ec = boost::beast::http::error::partial_message;
+            }
+        }
+
+    private:
+        value_type& body_;
+        std::function<std::string_view()> content_encoding_;
+        Inflater::Lease inflater_;
+    };
+};
+
+} // namespace oqd
@@ -0,0 +1,195 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <simdjson.h>
+
+namespace oqd {
+
+// Price as a signed count of 1/10000 ticks, the finest increment Tradier
+// accepts. Arithmetic, comparison and tick rounding are exact integer
+// operations; doubles only enter through from_double() and leave through
+// to_double(). Opt-in: order and quote structs keep their double fields.
+class Price {
+public:
+    static constexpr std::int64_t ticks_per_unit = 10000;
+    // Magnitude from_double() and parse() accept, in whole units.
+    static constexpr std::int64_t max_units = std::numeric_limits<std::int64_t>::max() / ticks_per_unit - 1;
+
+    constexpr Price() = default;
+
+    static constexpr Price from_ticks(std::int64_t ticks) {
+        Price price;
+        price.ticks_ = ticks;
+        return price;
+    }
+
+    static constexpr Price from_cents(std::int64_t cents) { return from_ticks(cents * 100); }
+
+    // Whether from_double() accepts `value`: finite and within max_units.
+    static bool representable(double value) {
+        return std::fabs(value) <= static_cast<double>(max_units);
+    }
+
+    // Nearest tick; `value` must be representable().
+    static Price from_double(double value) {
+        return from_ticks(std::llround(value * static_cast<double>(ticks_per_unit)));
+    }
+
+    // Decimal text such as "150", "-0.05" or "1.23456". Digits past the
+    // fourth decimal round half away from zero; exponents are rejected.
+    static constexpr std::optional<Price> parse(std::string_view text) {
+        std::size_t i = 0;
+        const bool negative = !text.empty() && text[0] == '-';
+        i += negative ? 1 : 0;
+
+        std::int64_t units = 0;
+        std::size_t digits = 0;
+        for (; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i, ++digits) {
+            units = units * 10 + (text[i] - '0');
+            if (units > max_units) {
+                return std::nullopt;
+            }
+        }
+
+        std::int64_t fraction = 0;
+        int decimals = 0;
+        bool round_up = false;
+        if (i < text.size() && text[i] == '.') {
+            for (++i; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i, ++digits) {
+                if (decimals < 4) {
+                    fraction = fraction * 10 + (text[i] - '0');
+                    ++decimals;
+                } else if (decimals == 4) {
+                    round_up = text[i] >= '5';
+                    ++decimals;
+                }
+            }
+        }
+        if (digits == 0 || i != text.size()) {
+            return std::nullopt;
+        }
+        for (; decimals < 4; ++decimals) {
+            fraction *= 10;
+        }
+        std::int64_t ticks = units * ticks_per_unit + fraction + (round_up ? 1 : 0);
+        return from_ticks(negative ? -ticks : ticks);
+    }
+
+    // A JSON number or numeric string. Integers convert exactly; doubles go
+    // to the nearest tick.
+    static std::optional<Price> from_json(const simdjson::dom::element& elem) {
+        std::int64_t integer;
+        if (elem.get(integer) == simdjson::SUCCESS) {
+            if (integer > max_units || integer < -max_units) {
+                return std::nullopt;
+            }
+            return from_ticks(integer * ticks_per_unit);
+        }
+        double real;
+        if (elem.get(real) == simdjson::SUCCESS) {
+            if (!representable(real)) {
+                return std::nullopt;
+            }
+            return from_double(real);
+        }
+        std::string_view text;
+        if (elem.get(text) == simdjson::SUCCESS) {
+            return parse(text);
+        }
+        return std::nullopt;
+    }
+
+    constexpr std::int64_t ticks() const { return ticks_; }
+    constexpr double to_double() const { return static_cast<double>(ticks_) / static_cast<double>(ticks_per_unit); }
+
+    // Writes two to four decimals ("150.00", "0.05", "1.2345"): as many as
+    // the value needs, never fewer than two.
+    std::to_chars_result to_chars(char* first, char* last) const {
+        std::array<char, 32> text;
+        const bool negative = ticks_ < 0;
+        const std::uint64_t magnitude = negative ? 0 - static_cast<std::uint64_t>(ticks_)
+                                                 : static_cast<std::uint64_t>(ticks_);
+        const auto fraction = static_cast<unsigned>(magnitude % ticks_per_unit);
+
+        text[0] = '-';
+        char* end = std::to_chars(text.data() + negative, text.data() + text.size(),
+                                  magnitude / ticks_per_unit).ptr;
+        end[0] = '.';
+        end[1] = static_cast<char>('0' + fraction / 1000);
+        end[2] = static_cast<char>('0' + fraction / 100 % 10);
+        end[3] = static_cast<char>('0' + fraction / 10 % 10);
+        end[4] = static_cast<char>('0' + fraction % 10);
+        end += 3 + (fraction % 100 != 0) + (fraction % 10 != 0);
+
+        const auto size = static_cast<std::size_t>(end - text.data());
+        if (static_cast<std::size_t>(last - first) < size) {
+            return {last, std::errc::value_too_large};
+        }
+        std::memcpy(first, text.data(), size);
+        return {first + size, std::errc()};
+    }
+
+    std::string to_string() const {
+        std::array<char, 32> text;
+        return std::string(text.data(), to_chars(text.data(), text.data() + text.size()).ptr);
+    }
+
+    // Tick-grid helpers; `tick` must be positive.
+    constexpr bool is_multiple_of(Price tick) const { return ticks_ % tick.ticks_ == 0; }
+
+    constexpr Price round_down(Price tick) const {
+        std::int64_t steps = ticks_ / tick.ticks_;
+        steps -= (ticks_ % tick.ticks_ < 0) ? 1 : 0;
+        return from_ticks(steps * tick.ticks_);
+    }
+
+    constexpr Price round_up(Price tick) const {
+        std::int64_t steps = ticks_ / tick.ticks_;
+        steps += (ticks_ % tick.ticks_ > 0) ? 1 : 0;
+        return from_ticks(steps * tick.ticks_);
+    }
+
+    // Halves round away from zero.
+    constexpr Price round_nearest(Price tick) const {
+        const std::int64_t half = tick.ticks_ / 2;
+        return ticks_ < 0 ? from_ticks(-from_ticks(-ticks_ + half).round_down(tick).ticks_)
+                          : from_ticks(ticks_ + half).round_down(tick);
+    }
+
+    constexpr auto operator<=>(const Price&) const = default;
+
+    constexpr Price operator-() const { return from_ticks(-ticks_); }
+    constexpr Price& operator+=(Price other) { ticks_ += other.ticks_; return *this; }
+    constexpr Price& operator-=(Price other) { ticks_ -= other.ticks_; return *this; }
+    friend constexpr Price operator+(Price a, Price b) { return a += b; }
+    friend constexpr Price operator-(Price a, Price b) { return a -= b; }
+    friend constexpr Price operator*(Price price, std::int64_t quantity) { return from_ticks(price.ticks_ * quantity); }
+    friend constexpr Price operator*(std::int64_t quantity, Price price) { return price * quantity; }
+
+private:
+    std::int64_t ticks_ = 0;
+};
+
+} // namespace oqd
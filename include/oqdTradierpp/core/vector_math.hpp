@@ -0,0 +1,137 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Kernels built on these functions are plain loops over contiguous arrays
+// made only of inlinable arithmetic, so the compiler vectorizes them. On
+// x86-64 Linux with GCC, a kernel marked OQD_SIMD_CLONES is additionally
+// compiled for AVX-512 and AVX2+FMA and the best variant is selected at load
+// time; everywhere else the scalar build is used. Translation units holding
+// such kernels are built with -fno-math-errno.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define OQD_SIMD_CLONES __attribute__((target_clones("arch=x86-64-v4", "arch=x86-64-v3", "default")))
+#define OQD_SIMD_DISPATCH 1
+#else
+#define OQD_SIMD_CLONES
+#define OQD_SIMD_DISPATCH 0
+#endif
+
+namespace oqd::vmath {
+
+inline constexpr double inv_sqrt_2pi = 0.39894228040143267794;
+inline constexpr double sqrt_2pi = 2.50662827463100050242;
+inline constexpr double ln2_hi = 6.93147180369123816490e-01;
+inline constexpr double ln2_lo = 1.90821492927058770002e-10;
+inline constexpr double log2e = 1.44269504088896338700e+00;
+inline constexpr double sqrt2 = 1.41421356237309504880;
+inline constexpr double round_shifter = 6755399441055744.0;      // 1.5 * 2^52
+inline constexpr double exponent_bias = 4503599627371519.0;      // 2^52 + 1023
+
+// exp(x) via Cody-Waite reduction to |r| <= ln2/2 and a degree-12 Taylor
+// polynomial; relative error is below 2e-16 over the clamped range.
+[[gnu::always_inline]] inline double vexp(double x) {
+    x = std::min(708.0, std::max(-708.0, x));
+    double t = x * log2e + round_shifter;
+    double k = t - round_shifter;
+    double r = x - k * ln2_hi - k * ln2_lo;
+
+    double p = 2.08767569878680989792e-09;
+    p = p * r + 2.50521083854417187751e-08;
+    p = p * r + 2.75573192239858906526e-07;
+    p = p * r + 2.75573192239858906526e-06;
+    p = p * r + 2.48015873015873015873e-05;
+    p = p * r + 1.98412698412698412698e-04;
+    p = p * r + 1.38888888888888888889e-03;
+    p = p * r + 8.33333333333333333333e-03;
+    p = p * r + 4.16666666666666666667e-02;
+    p = p * r + 1.66666666666666666667e-01;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    std::uint64_t ki = std::bit_cast<std::uint64_t>(t) - std::bit_cast<std::uint64_t>(round_shifter);
+    double scale = std::bit_cast<double>((ki + 1023) << 52);
+    return p * scale;
+}
+
+// log(x) for positive normal x: split off the binary exponent, then
+// log(m) = 2 atanh((m - 1) / (m + 1)) with m in [sqrt(1/2), sqrt(2)).
+[[gnu::always_inline]] inline double vlog(double x) {
+    std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+    double e = std::bit_cast<double>((bits >> 52) | 0x4330000000000000ULL) - exponent_bias;
+    double m = std::bit_cast<double>((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+    bool high = m > sqrt2;
+    m = high ? m * 0.5 : m;
+    e = high ? e + 1.0 : e;
+
+    double s = (m - 1.0) / (m + 1.0);
+    double s2 = s * s;
+    double p = 1.0 / 19.0;
+    p = p * s2 + 1.0 / 17.0;
+    p = p * s2 + 1.0 / 15.0;
+    p = p * s2 + 1.0 / 13.0;
+    p = p * s2 + 1.0 / 11.0;
+    p = p * s2 + 1.0 / 9.0;
+    p = p * s2 + 1.0 / 7.0;
+    p = p * s2 + 1.0 / 5.0;
+    p = p * s2 + 1.0 / 3.0;
+    p = p * s2 + 1.0;
+    return e * ln2_hi + (e * ln2_lo + 2.0 * s * p);
+}
+
+[[gnu::always_inline]] inline double norm_pdf(double x) {
+    return inv_sqrt_2pi * vexp(-0.5 * x * x);
+}
+
+// Cumulative normal after Hart (1968) as given by West (2005): a rational
+// approximation for |x| < 7.07 and a continued fraction in the tail, both
+// evaluated and blended so the loop stays branch-free.
+[[gnu::always_inline]] inline double norm_cdf(double x) {
+    double a = std::min(std::abs(x), 37.0);
+    double exponential = vexp(-0.5 * a * a);
+
+    double num = 3.52624965998911e-02;
+    num = num * a + 0.700383064443688;
+    num = num * a + 6.37396220353165;
+    num = num * a + 33.912866078383;
+    num = num * a + 112.079291497871;
+    num = num * a + 221.213596169931;
+    num = num * a + 220.206867912376;
+    double den = 8.83883476483184e-02;
+    den = den * a + 1.75566716318264;
+    den = den * a + 16.064177579207;
+    den = den * a + 86.7807322029461;
+    den = den * a + 296.564248779674;
+    den = den * a + 637.333633378831;
+    den = den * a + 793.826512519948;
+    den = den * a + 440.413735824752;
+    double central = exponential * num / den;
+
+    double cf = a + 0.65;
+    cf = a + 4.0 / cf;
+    cf = a + 3.0 / cf;
+    cf = a + 2.0 / cf;
+    cf = a + 1.0 / cf;
+    double tail = exponential / (cf * sqrt_2pi);
+
+    double lower = a < 7.07106781186547 ? central : tail;
+    return x > 0.0 ? 1.0 - lower : lower;
+}
+
+} // namespace oqd::vmath
@@ -26,9 +26,10 @@ struct EndpointConfig {
     std::string_view method;
     std::string_view auth_type;
     int rate_limit_per_second = 60;
+    int cache_ttl_seconds = 0;      // 0: responses are never served from ApiMethods' response cache
     
-    constexpr EndpointConfig(std::string_view p, std::string_view m, std::string_view a, int r = 60)
-        : path(p), method(m), auth_type(a), rate_limit_per_second(r) {}
+    constexpr EndpointConfig(std::string_view p, std::string_view m, std::string_view a, int r = 60, int ttl = 0)
+        : path(p), method(m), auth_type(a), rate_limit_per_second(r), cache_ttl_seconds(ttl) {}
 };
 
 namespace base_urls {
@@ -71,6 +72,26 @@ namespace accounts {
         }
     };
     
+    struct history {
+        static constexpr std::string_view method = "GET";
+        static constexpr std::string_view auth_type = "bearer";
+        static constexpr int rate_limit = 120;
+        static std::string path(const std::string& account_id) {
+            std::string validated_id = PathValidator::validate_account_id(account_id);
+            return "/v1/accounts/" + validated_id + "/history";
+        }
+    };
+    
+    struct gainloss {
+        static constexpr std::string_view method = "GET";
+        static constexpr std::string_view auth_type = "bearer";
+        static constexpr int rate_limit = 120;
+        static std::string path(const std::string& account_id) {
+            std::string validated_id = PathValidator::validate_account_id(account_id);
+            return "/v1/accounts/" + validated_id + "/gainloss";
+        }
+    };
+    
     struct orders {
         static constexpr std::string_view method = "GET";
         static constexpr std::string_view auth_type = "bearer";
@@ -105,15 +126,18 @@ namespace accounts {
 
 namespace markets {
     constexpr EndpointConfig quotes{"/v1/markets/quotes", "GET", "bearer", 120};
-    constexpr EndpointConfig clock{"/v1/markets/clock", "GET", "bearer", 60};
+    constexpr EndpointConfig clock{"/v1/markets/clock", "GET", "bearer", 60, 5};
     constexpr EndpointConfig search{"/v1/markets/search", "GET", "bearer", 60};
-    constexpr EndpointConfig lookup{"/v1/markets/lookup", "GET", "bearer", 60};
+    constexpr EndpointConfig lookup{"/v1/markets/lookup", "GET", "bearer", 60, 3600};
+    constexpr EndpointConfig calendar{"/v1/markets/calendar", "GET", "bearer", 60, 3600};
+    constexpr EndpointConfig etb{"/v1/markets/etb", "GET", "bearer", 60, 3600};
     constexpr EndpointConfig history{"/v1/markets/history", "GET", "bearer", 120};
+    constexpr EndpointConfig timesales{"/v1/markets/timesales", "GET", "bearer", 120};
     
     namespace options {
         constexpr EndpointConfig chains{"/v1/markets/options/chains", "GET", "bearer", 60};
-        constexpr EndpointConfig expirations{"/v1/markets/options/expirations", "GET", "bearer", 60};
-        constexpr EndpointConfig strikes{"/v1/markets/options/strikes", "GET", "bearer", 60};
+        constexpr EndpointConfig expirations{"/v1/markets/options/expirations", "GET", "bearer", 60, 300};
+        constexpr EndpointConfig strikes{"/v1/markets/options/strikes", "GET", "bearer", 60, 300};
     };
     
     namespace events {
@@ -134,12 +158,13 @@ namespace markets {
 
 namespace beta {
     namespace fundamentals {
-        constexpr EndpointConfig company{"/beta/markets/fundamentals/company", "GET", "bearer", 30};
-        constexpr EndpointConfig ratios{"/beta/markets/fundamentals/ratios", "GET", "bearer", 30};
-        constexpr EndpointConfig financials{"/beta/markets/fundamentals/financials", "GET", "bearer", 30};
-        constexpr EndpointConfig price_stats{"/beta/markets/fundamentals/price_stats", "GET", "bearer", 30};
-        constexpr EndpointConfig corporate_calendar{"/beta/markets/fundamentals/corporate_calendar", "GET", "bearer", 30};
-        constexpr EndpointConfig dividend{"/beta/markets/fundamentals/dividend", "GET", "bearer", 30};
+        constexpr EndpointConfig company{"/beta/markets/fundamentals/company", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig ratios{"/beta/markets/fundamentals/ratios", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig financials{"/beta/markets/fundamentals/financials", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig price_stats{"/beta/markets/fundamentals/price_stats", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig corporate_calendar{"/beta/markets/fundamentals/corporate_calendar", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig corporate_actions{"/beta/markets/fundamentals/corporate_actions", "GET", "bearer", 30, 3600};
+        constexpr EndpointConfig dividend{"/beta/markets/fundamentals/dividend", "GET", "bearer", 30, 3600};
     };
 }
 
@@ -183,7 +208,10 @@ namespace registry {
         &markets::clock,
         &markets::search,
         &markets::lookup,
+        &markets::calendar,
+        &markets::etb,
         &markets::history,
+        &markets::timesales,
         &markets::options::chains,
         &markets::options::expirations,
         &markets::options::strikes,
@@ -193,6 +221,7 @@ namespace registry {
         &beta::fundamentals::financials,
         &beta::fundamentals::price_stats,
         &beta::fundamentals::corporate_calendar,
+        &beta::fundamentals::corporate_actions,
         &beta::fundamentals::dividend
     };
 }
@@ -0,0 +1,146 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "oqdTradierpp/api.hpp"
+
+namespace oqd {
+
+struct BulkFetchOptions {
+    std::size_t max_symbols_per_request = 100;
+    std::size_t max_query_length = 4000;      // URL-encoded length of the symbols parameter
+    std::size_t max_in_flight = 8;
+    int requests_per_second = endpoints::beta::fundamentals::company.rate_limit_per_second;
+};
+
+// Rows keyed by symbol; endpoints such as dividends or the corporate calendar
+// return several rows per symbol. Symbols from chunks whose request failed are
+// listed in failed_symbols with one entry per failure in errors.
+template<typename T>
+struct BulkFetchResult {
+    std::unordered_map<std::string, std::vector<T>> by_symbol;
+    std::vector<std::string> failed_symbols;
+    std::vector<std::string> errors;
+    std::size_t requests = 0;
+
+    bool ok() const { return failed_symbols.empty(); }
+};
+
+// Scatter-gather front end for the fundamentals endpoints.
+//
+// A symbol universe is de-duplicated and split into chunks that fit the URL
+// and per-request limits, sized evenly so the last request is not a straggler.
+// Chunks are dispatched with at most max_in_flight outstanding and starts paced
+// to requests_per_second; each finished chunk is merged into the result and
+// released before the next one is collected.
+class FundamentalsFetcher {
+public:
+    explicit FundamentalsFetcher(std::shared_ptr<ApiMethods> api, BulkFetchOptions options = {});
+
+    BulkFetchResult<CompanyInfo> company_info(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<FinancialRatios> financial_ratios(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<CorporateActions> corporate_actions(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<CorporateFinancials> corporate_financials(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<PriceStatistics> price_statistics(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<DividendInfo> dividend_info(const std::vector<std::string>& symbols) const;
+    BulkFetchResult<CorporateCalendar> corporate_calendar(const std::vector<std::string>& symbols) const;
+
+    const BulkFetchOptions& options() const { return options_; }
+
+    static std::vector<std::vector<std::string>> make_chunks(const std::vector<std::string>& symbols,
+                                                             const BulkFetchOptions& options);
+
+    // Runs `fetch(chunk) -> std::future<std::vector<T>>` over every chunk.
+    template<typename T, typename Fetch>
+    BulkFetchResult<T> scatter_gather(const std::vector<std::string>& symbols, Fetch&& fetch) const;
+
+private:
+    template<typename T>
+    BulkFetchResult<T> fetch_with(const std::vector<std::string>& symbols,
+                                  std::future<std::vector<T>> (ApiMethods::*method)(const std::vector<std::string>&,
+                                                                                    const RequestOptions&)) const;
+
+    std::shared_ptr<ApiMethods> api_;
+    BulkFetchOptions options_;
+};
+
+template<typename T, typename Fetch>
+BulkFetchResult<T> FundamentalsFetcher::scatter_gather(const std::vector<std::string>& symbols, Fetch&& fetch) const {
+    struct Pending {
+        std::size_t chunk;
+        std::future<std::vector<T>> rows;
+    };
+
+    BulkFetchResult<T> result;
+    auto chunks = make_chunks(symbols, options_);
+    std::deque<Pending> in_flight;
+
+    auto fail = [&](std::size_t chunk, const std::string& error) {
+        result.failed_symbols.insert(result.failed_symbols.end(), chunks[chunk].begin(), chunks[chunk].end());
+        result.errors.push_back(error);
+    };
+
+    auto collect_oldest = [&]() {
+        Pending pending = std::move(in_flight.front());
+        in_flight.pop_front();
+        try {
+            auto rows = pending.rows.get();
+            for (auto& row : rows) {
+                result.by_symbol[row.symbol].push_back(std::move(row));
+            }
+        } catch (const std::exception& e) {
+            fail(pending.chunk, e.what());
+        }
+    };
+
+    using clock = std::chrono::steady_clock;
+    auto spacing = options_.requests_per_second > 0
+        ? std::chrono::duration_cast<clock::duration>(std::chrono::seconds(1)) / options_.requests_per_second
+        : clock::duration::zero();
+    auto next_start = clock::now();
+    std::size_t max_in_flight = std::max<std::size_t>(1, options_.max_in_flight);
+
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        while (in_flight.size() >= max_in_flight) {
+            collect_oldest();
+        }
+        if (spacing > clock::duration::zero()) {
+            std::this_thread::sleep_until(next_start);
+            next_start = std::max(next_start, clock::now()) + spacing;
+        }
+        try {
+            in_flight.push_back({i, fetch(chunks[i])});
+            ++result.requests;
+        } catch (const std::exception& e) {
+            fail(i, e.what());
+        }
+    }
+    while (!in_flight.empty()) {
+        collect_oldest();
+    }
+    return result;
+}
+
+} // namespace oqd
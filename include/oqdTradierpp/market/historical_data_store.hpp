@@ -0,0 +1,130 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+#include "oqdTradierpp/api.hpp"
+#include "historical_data.hpp"
+
+namespace oqd {
+
+// Read-only, memory-mapped view of one bar file. Columns are packed arrays of
+// equal length; time is the bar date as UTC epoch seconds. The view keeps the
+// mapping alive and is unaffected by later writes to the store.
+class BarSeries {
+public:
+    BarSeries() = default;
+    ~BarSeries();
+
+    BarSeries(BarSeries&& other) noexcept;
+    BarSeries& operator=(BarSeries&& other) noexcept;
+    BarSeries(const BarSeries&) = delete;
+    BarSeries& operator=(const BarSeries&) = delete;
+
+    std::size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    std::span<const std::int64_t> time() const;
+    std::span<const double> open() const { return column(0); }
+    std::span<const double> high() const { return column(1); }
+    std::span<const double> low() const { return column(2); }
+    std::span<const double> close() const { return column(3); }
+    std::span<const double> volume() const { return column(4); }
+
+    std::vector<HistoricalData> to_historical_data() const;
+
+    static BarSeries map(const std::filesystem::path& path);
+
+private:
+    std::span<const double> column(std::size_t index) const;
+    void release();
+
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+    std::size_t count_ = 0;
+    std::size_t capacity_ = 0;
+};
+
+// Local bar cache in front of get_historical_data.
+//
+// Each (symbol, interval) pair is one file under the root directory holding a
+// 64-byte header followed by six fixed-capacity columns (time, open, high, low,
+// close, volume). New bars are appended in place; the file is only rewritten
+// when it runs out of capacity or older history is back-filled. The header
+// records which calendar range has been fetched so only the missing head or
+// tail of a request goes to the network. The current day is never marked as
+// covered, so its still-forming bar is refreshed on the next request.
+class HistoricalDataStore {
+public:
+    struct Coverage {
+        std::int64_t first = 0;           // UTC epoch seconds, inclusive
+        std::int64_t last = 0;
+        std::size_t bars = 0;
+    };
+
+    HistoricalDataStore(std::shared_ptr<ApiMethods> api, std::filesystem::path root);
+
+    // Bars already on disk, without touching the network.
+    BarSeries load(const std::string& symbol, const std::string& interval) const;
+    std::optional<Coverage> coverage(const std::string& symbol, const std::string& interval) const;
+
+    // Fetches whatever part of [start, end] (YYYY-MM-DD) is not cached, merges
+    // it in and returns the mapped series.
+    BarSeries get(const std::string& symbol, const std::string& interval,
+                  const std::string& start, const std::string& end);
+
+    // Same for many symbols; missing ranges are fetched concurrently.
+    std::vector<BarSeries> get_many(const std::vector<std::string>& symbols, const std::string& interval,
+                                    const std::string& start, const std::string& end);
+
+    // Merges bars into the file and extends the covered range to [start, end]
+    // when that range overlaps or adjoins it; the bars of a disjoint range are
+    // kept but the range is not marked covered.
+    void merge(const std::string& symbol, const std::string& interval,
+               const std::vector<HistoricalData>& bars,
+               const std::string& start, const std::string& end);
+
+    // Date ranges (YYYY-MM-DD, inclusive) that still need fetching. Ranges
+    // always reach the covered range, so fetching them keeps it contiguous.
+    std::vector<std::pair<std::string, std::string>> missing_ranges(const std::string& symbol,
+                                                                    const std::string& interval,
+                                                                    const std::string& start,
+                                                                    const std::string& end) const;
+
+    std::filesystem::path path_for(const std::string& symbol, const std::string& interval) const;
+
+    void set_max_concurrent_fetches(std::size_t limit) { max_concurrent_fetches_ = limit == 0 ? 1 : limit; }
+
+    static std::int64_t parse_date(const std::string& date);
+    static std::string format_date(std::int64_t epoch_seconds);
+
+private:
+    void merge_epochs(const std::filesystem::path& path, const std::vector<HistoricalData>& bars,
+                      std::int64_t covered_start, std::int64_t covered_end);
+
+    std::shared_ptr<ApiMethods> api_;
+    std::filesystem::path root_;
+    std::size_t max_concurrent_fetches_ = 8;
+    mutable std::mutex write_mutex_;
+};
+
+} // namespace oqd
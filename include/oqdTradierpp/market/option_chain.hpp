@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 #include "quote.hpp"
 
 namespace oqd {
@@ -26,6 +27,7 @@ struct OptionChain {
     
     static OptionChain from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 } // namespace oqd
\ No newline at end of file
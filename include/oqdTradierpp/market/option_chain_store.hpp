@@ -0,0 +1,185 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "oqdTradierpp/api.hpp"
+#include "oqdTradierpp/streaming.hpp"
+#include "option_chain.hpp"
+
+namespace oqd {
+
+// One side (calls or puts) of a page, stored column by column.
+struct OptionSideColumns {
+    std::vector<double> bid;
+    std::vector<double> ask;
+    std::vector<double> last;
+    std::vector<double> volume;
+    std::vector<double> open_interest;
+    std::vector<int> bid_size;
+    std::vector<int> ask_size;
+    std::vector<std::int64_t> updated_ns;
+    std::vector<std::uint8_t> listed;
+
+    void resize(std::size_t n);
+};
+
+// A fixed run of consecutive strikes. Pages are the unit of copy-on-write: a
+// stream update copies only the page it touches, and only when a snapshot has
+// been taken since the store last copied it.
+struct OptionChainPage {
+    static constexpr std::size_t capacity = 32;
+
+    OptionSideColumns call;
+    OptionSideColumns put;
+};
+
+struct OptionQuoteView {
+    std::string_view symbol;
+    double strike = 0.0;
+    double bid = 0.0;
+    double ask = 0.0;
+    double last = 0.0;
+    double volume = 0.0;
+    double open_interest = 0.0;
+    int bid_size = 0;
+    int ask_size = 0;
+    std::chrono::system_clock::time_point updated;
+
+    double mid() const { return (bid > 0.0 && ask > 0.0) ? 0.5 * (bid + ask) : last; }
+};
+
+// Immutable, strike-sorted view of one (underlying, expiration) chain. Rows pair
+// the call and put at the same strike; a snapshot never changes after it is
+// taken, no matter how many stream updates follow.
+class OptionChainSnapshot {
+public:
+    const std::string& underlying() const { return underlying_; }
+    const std::string& expiration() const { return expiration_; }
+    std::uint64_t version() const { return version_; }
+
+    std::size_t size() const { return strikes_->size(); }
+    double strike(std::size_t row) const { return (*strikes_)[row]; }
+    const std::vector<double>& strikes() const { return *strikes_; }
+
+    // Row of an exact strike, or of the first strike not below it. O(log n).
+    std::optional<std::size_t> find_strike(double strike) const;
+    std::size_t lower_bound(double strike) const;
+
+    std::optional<OptionQuoteView> call(std::size_t row) const;
+    std::optional<OptionQuoteView> put(std::size_t row) const;
+
+    // Raw column access; row r lives in page r / capacity at slot r % capacity.
+    std::size_t page_count() const { return pages_.size(); }
+    const OptionChainPage& page(std::size_t index) const { return *pages_[index]; }
+
+private:
+    friend class OptionChainStore;
+
+    std::optional<OptionQuoteView> view(std::size_t row, bool is_call) const;
+
+    std::string underlying_;
+    std::string expiration_;
+    std::uint64_t version_ = 0;
+    std::shared_ptr<const std::vector<double>> strikes_;
+    std::shared_ptr<const std::vector<std::string>> call_symbols_;
+    std::shared_ptr<const std::vector<std::string>> put_symbols_;
+    std::vector<std::shared_ptr<const OptionChainPage>> pages_;
+};
+
+// Option chains keyed by (underlying, expiration), seeded once from REST and
+// kept current from the market quote stream.
+//
+// Contract symbols map to their chain row in O(1), so applying a quote is a hash
+// lookup plus a few column writes. Readers take snapshots that share pages with
+// the store. A page handed to a snapshot is never written again: the writer
+// first copies any page published since its last copy, so readers need no
+// synchronization beyond holding the snapshot.
+class OptionChainStore {
+public:
+    using SnapshotPtr = std::shared_ptr<const OptionChainSnapshot>;
+
+    OptionChainStore() = default;
+    explicit OptionChainStore(std::shared_ptr<ApiMethods> api);
+
+    OptionChainStore(const OptionChainStore&) = delete;
+    OptionChainStore& operator=(const OptionChainStore&) = delete;
+
+    // Fetches the chain once and replaces any stored copy.
+    SnapshotPtr seed(const std::string& underlying, const std::string& expiration);
+    SnapshotPtr load(const std::string& underlying, const std::string& expiration, const OptionChain& chain);
+
+    // Applies a stream update to a stored contract. Returns false for unknown symbols.
+    bool apply(const StreamingQuote& quote);
+    bool apply(const StreamingTrade& trade);
+
+    // Decodes and applies a raw market stream element.
+    bool on_stream_event(const simdjson::dom::element& elem);
+
+    // Callback suitable for StreamingSession::start_market_*_stream.
+    StreamingCallback stream_callback();
+
+    SnapshotPtr snapshot(const std::string& underlying, const std::string& expiration) const;
+    bool contains(const std::string& underlying, const std::string& expiration) const;
+
+    // Contract symbols of one chain, or of every stored chain, for subscribing.
+    std::vector<std::string> symbols(const std::string& underlying, const std::string& expiration) const;
+    std::vector<std::string> symbols() const;
+
+    bool erase(const std::string& underlying, const std::string& expiration);
+    void clear();
+    std::size_t chain_count() const;
+
+private:
+    struct Chain {
+        std::string underlying;
+        std::string expiration;
+        std::uint64_t version = 0;
+        std::shared_ptr<const std::vector<double>> strikes;
+        std::shared_ptr<const std::vector<std::string>> call_symbols;
+        std::shared_ptr<const std::vector<std::string>> put_symbols;
+        std::vector<std::shared_ptr<OptionChainPage>> pages;
+        // Bumped by every snapshot, under the shared lock. A page is private
+        // to the store while its entry in private_epochs still equals it.
+        mutable std::atomic<std::uint64_t> snapshot_epoch{0};
+        std::vector<std::uint64_t> private_epochs;
+    };
+
+    struct Location {
+        Chain* chain = nullptr;
+        std::uint32_t row = 0;
+        bool is_call = true;
+    };
+
+    static std::string make_key(const std::string& underlying, const std::string& expiration);
+    OptionSideColumns* writable_side(const Location& location);
+    void unindex(const Chain& chain);
+
+    std::shared_ptr<ApiMethods> api_;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::unique_ptr<Chain>> chains_;
+    std::unordered_map<std::string, Location> contracts_;
+};
+
+} // namespace oqd
@@ -0,0 +1,87 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "option_chain.hpp"
+
+namespace oqd {
+
+// Columnar view of an option chain. Every field is a contiguous array so the
+// pricing kernels can run over the whole chain without touching Quote objects.
+struct OptionColumns {
+    std::vector<double> strike;
+    std::vector<double> expiry_years;     // time to expiration in years (ACT/365)
+    std::vector<double> sign;             // +1 for calls, -1 for puts
+    std::vector<double> price;            // market price used for implied volatility
+    std::vector<std::size_t> source_index;
+
+    std::size_t size() const { return strike.size(); }
+    void reserve(std::size_t n);
+    void clear();
+    void push_back(double strike_price, double years, bool is_call, double market_price,
+                   std::size_t index = 0);
+
+    // Options without a strike, expiration or type are skipped; the price is the
+    // bid/ask midpoint, or the last trade when either side is missing.
+    static OptionColumns from_chain(const OptionChain& chain,
+                                    std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+};
+
+struct GreeksParams {
+    double spot = 0.0;
+    double rate = 0.0;                    // continuously compounded risk-free rate
+    double dividend_yield = 0.0;
+    double iv_tolerance = 1e-8;           // absolute price error
+    int max_iterations = 32;
+};
+
+// Per-contract results, index-aligned with OptionColumns. Theta is per calendar
+// day, vega and rho are per 1% move. Contracts whose price violates no-arbitrage
+// bounds get a NaN implied volatility and NaN greeks.
+struct GreeksColumns {
+    std::vector<double> iv;
+    std::vector<double> theoretical;
+    std::vector<double> delta;
+    std::vector<double> gamma;
+    std::vector<double> theta;
+    std::vector<double> vega;
+    std::vector<double> rho;
+
+    std::size_t size() const { return iv.size(); }
+    void resize(std::size_t n);
+};
+
+// Solves implied volatility for every contract with a safeguarded Newton
+// iteration seeded from the Corrado-Miller approximation.
+void compute_implied_volatility(const OptionColumns& options, const GreeksParams& params,
+                                std::vector<double>& iv);
+
+// Black-Scholes-Merton price and greeks for the given volatilities.
+void compute_greeks(const OptionColumns& options, const std::vector<double>& volatility,
+                    const GreeksParams& params, GreeksColumns& out);
+
+GreeksColumns analyze_chain(const OptionColumns& options, const GreeksParams& params);
+
+// Recomputes mid_iv and delta/gamma/theta/vega/rho on every option in the chain.
+GreeksColumns refresh_greeks(OptionChain& chain, const GreeksParams& params,
+                             std::chrono::system_clock::time_point now = std::chrono::system_clock::now());
+
+// Instruction set picked for the kernels on this CPU: "avx512", "avx2" or "scalar".
+const char* greeks_kernel_isa();
+
+} // namespace oqd
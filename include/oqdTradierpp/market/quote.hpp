@@ -16,6 +16,7 @@
 #include <string>
 #include <optional>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 
 namespace oqd {
 
@@ -71,6 +72,7 @@ struct Quote {
     
     static Quote from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 } // namespace oqd
\ No newline at end of file
@@ -0,0 +1,76 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <simdjson.h>
+#include "time_sales.hpp"
+
+namespace oqd {
+
+// Columnar time and sales. Timestamps are UTC epoch nanoseconds; every price
+// column is filled for every row, so tick rows carry their trade price in
+// open/high/low/close/vwap as well.
+struct TimeSalesSeries {
+    std::vector<std::int64_t> timestamp_ns;
+    std::vector<double> price;
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+    std::vector<double> volume;
+    std::vector<double> vwap;
+
+    struct PriceRange {
+        double low = 0.0;
+        double high = 0.0;
+    };
+
+    std::size_t size() const { return timestamp_ns.size(); }
+    bool empty() const { return timestamp_ns.empty(); }
+    void reserve(std::size_t n);
+    void clear();
+    void push_back(std::int64_t time_ns, double trade_price, double bar_open, double bar_high,
+                   double bar_low, double bar_close, double bar_volume, double bar_vwap);
+
+    // Accepts the full response, its "series" object, or the "data" array or
+    // object, and appends rows without materialising per-row strings. Rows
+    // without a "timestamp" use "time", read as US Eastern exchange time.
+    void append_json(const simdjson::dom::element& elem);
+    static TimeSalesSeries from_json(const simdjson::dom::element& elem);
+
+    static TimeSalesSeries from_records(const std::vector<TimeSales>& records);
+    // Each record's `time` is rebuilt from its timestamp in UTC, not the
+    // exchange-local string Tradier sent; decode with TimeSales::from_json to keep that.
+    std::vector<TimeSales> to_records() const;
+
+    // First row at or after the given time; rows are expected in time order.
+    std::size_t lower_bound(std::int64_t time_ns) const;
+
+    // Volume-weighted average price and low/high over rows [begin, end).
+    double volume_weighted_price() const { return volume_weighted_price(0, size()); }
+    double volume_weighted_price(std::size_t begin, std::size_t end) const;
+    double total_volume(std::size_t begin, std::size_t end) const;
+    PriceRange range() const { return range(0, size()); }
+    PriceRange range(std::size_t begin, std::size_t end) const;
+
+    // Aggregates rows into bars of the given width, aligned to the epoch. Empty
+    // buckets are skipped; each bar's price is its close.
+    TimeSalesSeries resample(std::chrono::nanoseconds bucket) const;
+};
+
+} // namespace oqd
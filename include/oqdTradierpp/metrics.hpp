@@ -0,0 +1,175 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace oqd {
+
+enum class EndpointGroup : std::uint8_t {
+    Auth,
+    User,
+    Accounts,
+    Trading,
+    Markets,
+    Options,
+    Fundamentals,
+    Watchlists,
+    Streaming,
+    Other,
+    Count
+};
+
+enum class RequestPhase : std::uint8_t {
+    Dns,
+    Connect,
+    Tls,
+    TimeToFirstByte,
+    Decompress,
+    Parse,
+    Total,
+    Count
+};
+
+std::string_view to_string(EndpointGroup group);
+std::string_view to_string(RequestPhase phase);
+
+// Maps an HTTP method and request path (with or without query) onto the
+// endpoint group used for rate limits and metrics.
+EndpointGroup classify_endpoint(std::string_view method, std::string_view path);
+
+namespace metrics {
+    constexpr std::size_t group_count = static_cast<std::size_t>(EndpointGroup::Count);
+    constexpr std::size_t phase_count = static_cast<std::size_t>(RequestPhase::Count);
+
+    // Latency histogram upper bounds in microseconds; the last bucket is +Inf.
+    constexpr std::array<std::uint64_t, 16> bucket_bounds_us = {
+        100, 250, 500, 1000, 2500, 5000, 10000, 25000,
+        50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000
+    };
+    constexpr std::size_t bucket_count = bucket_bounds_us.size() + 1;
+
+    // HTTP error statuses 400-599 are tracked individually, status 0 means a
+    // transport failure (DNS, connect, TLS, read/write).
+    constexpr int min_error_status = 400;
+    constexpr int max_error_status = 599;
+    constexpr std::size_t status_slots = max_error_status - min_error_status + 2;
+}
+
+struct PhaseStats {
+    std::uint64_t count = 0;
+    std::chrono::nanoseconds total{0};
+    std::array<std::uint64_t, metrics::bucket_count> buckets{};
+
+    double mean_microseconds() const {
+        return count == 0 ? 0.0 : static_cast<double>(total.count()) / 1000.0 / static_cast<double>(count);
+    }
+};
+
+struct EndpointGroupMetrics {
+    EndpointGroup group = EndpointGroup::Other;
+    std::uint64_t requests = 0;
+    std::int64_t in_flight = 0;
+    std::map<int, std::uint64_t> errors_by_status;
+    std::uint64_t bytes_in = 0;
+    std::uint64_t bytes_out = 0;
+    std::uint64_t decoded_bytes = 0;        // body bytes after removing gzip/deflate encoding
+    std::uint64_t rate_limit_waits = 0;
+    std::chrono::nanoseconds rate_limit_wait_time{0};
+    std::uint64_t coalesced_requests = 0;   // GETs that shared an identical in-flight request
+    std::uint64_t reused_connections = 0;   // requests sent on a pooled keep-alive connection
+    std::array<PhaseStats, metrics::phase_count> phases{};
+
+    std::uint64_t error_count() const;
+    const PhaseStats& phase(RequestPhase p) const { return phases[static_cast<std::size_t>(p)]; }
+    bool empty() const { return requests == 0 && in_flight == 0 && rate_limit_waits == 0 && coalesced_requests == 0; }
+};
+
+struct MetricsSnapshot {
+    std::chrono::system_clock::time_point taken_at;
+    std::array<EndpointGroupMetrics, metrics::group_count> groups{};
+
+    const EndpointGroupMetrics& group(EndpointGroup g) const { return groups[static_cast<std::size_t>(g)]; }
+    std::uint64_t total_requests() const;
+    std::uint64_t total_errors() const;
+};
+
+// Low-overhead metrics registry. Every recording thread owns a private shard
+// of relaxed atomic counters, so the hot path never contends; snapshot() merges
+// all shards on read. Shards are recycled when their thread exits.
+class MetricsRegistry {
+public:
+    MetricsRegistry();
+    ~MetricsRegistry();
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    void record_request_start(EndpointGroup group);
+    void record_request_end(EndpointGroup group, int http_status);
+    void record_phase(EndpointGroup group, RequestPhase phase, std::chrono::nanoseconds duration);
+    void record_bytes(EndpointGroup group, std::uint64_t bytes_in, std::uint64_t bytes_out);
+    void record_rate_limit_wait(EndpointGroup group, std::chrono::nanoseconds waited = std::chrono::nanoseconds{0});
+    void record_coalesced(EndpointGroup group);
+    void record_connection_reused(EndpointGroup group);
+    void record_decompression(EndpointGroup group, std::uint64_t decoded_bytes, std::chrono::nanoseconds duration);
+
+    MetricsSnapshot snapshot() const;
+
+    struct Shard;
+    struct State;
+
+private:
+    Shard& local_shard();
+
+    std::shared_ptr<State> state_;
+};
+
+// RAII helper that tracks one request: in-flight gauge, total latency and the
+// final status. Phases are recorded as the request progresses.
+class RequestMetricsScope {
+public:
+    RequestMetricsScope(MetricsRegistry* registry, EndpointGroup group);
+    ~RequestMetricsScope();
+
+    RequestMetricsScope(const RequestMetricsScope&) = delete;
+    RequestMetricsScope& operator=(const RequestMetricsScope&) = delete;
+
+    // Records the time elapsed since the previous mark (or the start) against phase.
+    void mark(RequestPhase phase);
+    void add_bytes(std::uint64_t bytes_in, std::uint64_t bytes_out);
+    void set_status(int http_status) { status_ = http_status; }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    MetricsRegistry* registry_;
+    EndpointGroup group_;
+    clock::time_point start_;
+    clock::time_point last_mark_;
+    int status_ = 0;
+};
+
+// Renders a snapshot in the Prometheus text exposition format (version 0.0.4).
+std::string to_prometheus(const MetricsSnapshot& snapshot, std::string_view prefix = "oqd_tradier");
+
+} // namespace oqd
\ No newline at end of file
@@ -0,0 +1,146 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace oqd {
+
+// Single-pass range over a page/limit endpoint that keeps the next `prefetch`
+// pages in flight while the caller works on the current one.
+//
+//     for (const auto& page : api.history_pages(account_id)) {
+//         for (const auto& event : page) { ... }
+//     }
+//
+// Pages are numbered from 1. The range ends after the first page holding fewer
+// than `page_size` items; requests already issued past that point are waited
+// for and discarded. A failed page rethrows from begin() or ++ and ends the
+// range. The range must stay in place while it is iterated.
+template<typename Item>
+class PagedRange {
+public:
+    using Page = std::vector<Item>;
+    using Fetch = std::function<std::future<Page>(int page)>;
+
+    class iterator {
+    public:
+        using iterator_concept = std::input_iterator_tag;
+        using value_type = Page;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        const Page& operator*() const { return range_->current_; }
+        const Page* operator->() const { return &range_->current_; }
+
+        iterator& operator++() {
+            range_->advance();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return range_ == nullptr || !range_->has_current_; }
+
+    private:
+        friend class PagedRange;
+        explicit iterator(PagedRange* range) : range_(range) {}
+
+        PagedRange* range_ = nullptr;
+    };
+
+    PagedRange(Fetch fetch, int page_size, int prefetch = 3)
+        : fetch_(std::move(fetch)), page_size_(page_size), prefetch_(prefetch < 0 ? 0 : prefetch) {
+        if (page_size_ <= 0) {
+            throw std::invalid_argument("PagedRange page size must be positive");
+        }
+    }
+
+    PagedRange(PagedRange&&) = default;
+    PagedRange& operator=(PagedRange&&) = default;
+
+    iterator begin() {
+        if (!started_) {
+            started_ = true;
+            advance();
+        }
+        return iterator(this);
+    }
+
+    std::default_sentinel_t end() const { return {}; }
+
+    // Drains the remaining pages into one vector.
+    Page collect() {
+        Page items;
+        for (auto it = begin(); it != end(); ++it) {
+            items.insert(items.end(), std::make_move_iterator(current_.begin()), std::make_move_iterator(current_.end()));
+        }
+        return items;
+    }
+
+    int pages_requested() const { return next_page_ - 1; }
+
+private:
+    void advance() {
+        has_current_ = false;
+        current_.clear();
+        if (last_) {
+            pending_.clear();
+            return;
+        }
+        while (static_cast<int>(pending_.size()) <= prefetch_) {
+            pending_.push_back(fetch_(next_page_++));
+        }
+        auto next = std::move(pending_.front());
+        pending_.pop_front();
+        try {
+            current_ = next.get();
+        } catch (...) {
+            finish();
+            throw;
+        }
+        if (current_.empty()) {
+            finish();
+            return;
+        }
+        has_current_ = true;
+        if (static_cast<int>(current_.size()) < page_size_) {
+            finish();
+        }
+    }
+
+    void finish() {
+        last_ = true;
+        pending_.clear();
+    }
+
+    Fetch fetch_;
+    int page_size_;
+    int prefetch_;
+    int next_page_ = 1;
+    std::deque<std::future<Page>> pending_;
+    Page current_;
+    bool started_ = false;
+    bool has_current_ = false;
+    bool last_ = false;
+};
+
+} // namespace oqd
@@ -0,0 +1,150 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <unordered_map>
+
+namespace oqd {
+
+struct ResponseCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t coalesced = 0;     // misses that joined a request already in flight
+    std::uint64_t evictions = 0;
+    std::size_t entries = 0;
+};
+
+// Typed cache for slow-changing GET responses.
+//
+// Entries hold the decoded result, so a hit is a map lookup and a copy with no
+// parsing. Keys come from make_key(), which sorts and percent-encodes the query
+// parameters so the same request always maps to the same entry; the origin
+// keeps production and sandbox responses apart in a shared cache. Concurrent
+// misses on one key are single-flight: the first caller's request is shared
+// with everyone who asks before it completes, and a failed request is never
+// cached.
+class ResponseCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit ResponseCache(std::size_t max_entries = 1024);
+
+    ResponseCache(const ResponseCache&) = delete;
+    ResponseCache& operator=(const ResponseCache&) = delete;
+
+    static std::string make_key(std::string_view path,
+                                const std::unordered_map<std::string, std::string>& params,
+                                std::string_view origin = {});
+
+    // Returns the cached value for `key` or joins the pending request for it.
+    // Otherwise calls `load(publish)`, which must start the request and return
+    // its std::future<T>; `publish(const T&)` has to be called with the decoded
+    // value on the worker before that future becomes ready. `load` runs under
+    // the cache lock, so it should only dispatch.
+    template<typename T, typename Load>
+    std::future<T> get_or_load(const std::string& key, Clock::duration ttl, Load&& load);
+
+    void invalidate(const std::string& key);
+    // Drops every entry for an endpoint path regardless of its parameters or origin.
+    void invalidate_path(std::string_view path);
+    void clear();
+
+    std::size_t max_entries() const { return max_entries_; }
+    ResponseCacheStats stats() const;
+
+private:
+    struct Entry {
+        std::type_index type = typeid(void);
+        std::uint64_t generation = 0;
+        std::shared_ptr<const void> value;
+        Clock::time_point expires{};
+        std::shared_ptr<void> pending;   // std::shared_future<T> while a request is in flight
+    };
+
+    template<typename T>
+    static std::future<T> ready(const T& value) {
+        std::promise<T> promise;
+        promise.set_value(value);
+        return promise.get_future();
+    }
+
+    template<typename T>
+    static std::future<T> join(std::shared_future<T> shared) {
+        return std::async(std::launch::deferred, [shared = std::move(shared)]() { return shared.get(); });
+    }
+
+    // Both expect mutex_ to be held.
+    Entry& begin_load(const std::string& key, std::type_index type);
+    void erase_if_generation(const std::string& key, std::uint64_t generation);
+
+    void publish(const std::string& key, std::uint64_t generation,
+                 std::shared_ptr<const void> value, Clock::duration ttl);
+
+    const std::size_t max_entries_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::uint64_t next_generation_ = 0;
+    ResponseCacheStats stats_;
+};
+
+template<typename T, typename Load>
+std::future<T> ResponseCache::get_or_load(const std::string& key, Clock::duration ttl, Load&& load) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.type == std::type_index(typeid(T))) {
+        Entry& entry = it->second;
+        if (entry.value && Clock::now() < entry.expires) {
+            ++stats_.hits;
+            return ready(*std::static_pointer_cast<const T>(entry.value));
+        }
+        if (entry.pending) {
+            // publish() clears pending before the request's future is ready, so a
+            // ready future still parked here means the request failed.
+            auto shared = *std::static_pointer_cast<std::shared_future<T>>(entry.pending);
+            if (shared.wait_for(std::chrono::seconds(0)) == std::future_status::timeout) {
+                ++stats_.coalesced;
+                return join(std::move(shared));
+            }
+        }
+    }
+
+    ++stats_.misses;
+    Entry& entry = begin_load(key, typeid(T));
+    std::uint64_t generation = entry.generation;
+
+    auto publish_value = [this, key, generation, ttl](const T& value) {
+        publish(key, generation, std::make_shared<const T>(value), ttl);
+    };
+
+    std::shared_future<T> shared;
+    try {
+        shared = load(std::move(publish_value)).share();
+    } catch (...) {
+        erase_if_generation(key, generation);
+        throw;
+    }
+    entry.pending = std::make_shared<std::shared_future<T>>(shared);
+    return join(std::move(shared));
+}
+
+} // namespace oqd
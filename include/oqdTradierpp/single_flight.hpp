@@ -0,0 +1,132 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace oqd {
+
+// Collapses concurrent work on the same key into one execution.
+//
+// The first caller to join() a key becomes the leader and must finish its
+// ticket with complete() or fail(); every caller that joins before then gets a
+// follower ticket sharing the leader's result. Finishing removes the key before
+// waking the followers, so anyone arriving afterwards starts fresh work rather
+// than reading a result that is already stale. A follower can also register a
+// callback with then() to run once the result is in, so it need not block on
+// the shared future to act on it.
+template<typename T>
+class SingleFlight {
+    struct Flight;
+
+public:
+    using Callback = std::function<void(const std::shared_future<T>&)>;
+
+    class Ticket {
+    public:
+        bool leader() const { return static_cast<bool>(promise_); }
+        const std::shared_future<T>& result() const { return flight_->result; }
+
+    private:
+        friend class SingleFlight;
+
+        std::string key_;
+        std::shared_ptr<Flight> flight_;
+        std::shared_ptr<std::promise<T>> promise_;
+    };
+
+    Ticket join(std::string key) {
+        Ticket ticket;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = in_flight_.find(key);
+        if (it != in_flight_.end()) {
+            ticket.flight_ = it->second;
+            return ticket;
+        }
+        ticket.promise_ = std::make_shared<std::promise<T>>();
+        ticket.flight_ = std::make_shared<Flight>();
+        ticket.flight_->result = ticket.promise_->get_future().share();
+        in_flight_.emplace(key, ticket.flight_);
+        ticket.key_ = std::move(key);
+        return ticket;
+    }
+
+    void complete(Ticket& ticket, T value) {
+        release(ticket.key_);
+        ticket.promise_->set_value(std::move(value));
+        notify(*ticket.flight_);
+    }
+
+    void fail(Ticket& ticket, std::exception_ptr error) {
+        release(ticket.key_);
+        ticket.promise_->set_exception(std::move(error));
+        notify(*ticket.flight_);
+    }
+
+    // Runs `callback` with the ticket's result on the thread that finishes the
+    // leader, or right away on this thread if it has already finished.
+    // `callback` must not throw.
+    void then(const Ticket& ticket, Callback callback) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!ticket.flight_->done) {
+                ticket.flight_->callbacks.push_back(std::move(callback));
+                return;
+            }
+        }
+        callback(ticket.flight_->result);
+    }
+
+    std::size_t in_flight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return in_flight_.size();
+    }
+
+private:
+    struct Flight {
+        std::shared_future<T> result;
+        bool done = false;
+        std::vector<Callback> callbacks;
+    };
+
+    void release(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        in_flight_.erase(key);
+    }
+
+    void notify(Flight& flight) {
+        std::vector<Callback> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            flight.done = true;
+            callbacks.swap(flight.callbacks);
+        }
+        for (auto& callback : callbacks) {
+            callback(flight.result);
+        }
+    }
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Flight>> in_flight_;
+};
+
+} // namespace oqd
@@ -15,6 +15,7 @@
 
 #include "client.hpp"
 #include "types.hpp"
+#include "core/json_fwd.hpp"
 #include <functional>
 #include <memory>
 #include <thread>
@@ -223,6 +224,7 @@ struct StreamingQuote {
     
     static StreamingQuote from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct StreamingTrade {
@@ -235,6 +237,7 @@ struct StreamingTrade {
     
     static StreamingTrade from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct StreamingSummary {
@@ -249,22 +252,25 @@ struct StreamingSummary {
     
     static StreamingSummary from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct StreamingOrderStatus {
     std::string order_id;
     std::string status;
     std::string symbol;
-    OrderType order_type;
-    OrderSide side;
-    double quantity;
-    double filled_quantity;
-    double avg_fill_price;
-    double remaining_quantity;
+    OrderType order_type = OrderType::Market;
+    OrderSide side = OrderSide::Buy;
+    double quantity = 0.0;
+    double filled_quantity = 0.0;
+    double avg_fill_price = 0.0;
+    double remaining_quantity = 0.0;
+    std::optional<std::string> tag;
     std::chrono::system_clock::time_point timestamp;
     
     static StreamingOrderStatus from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 // Factory function for creating streaming sessions
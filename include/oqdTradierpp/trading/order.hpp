@@ -17,6 +17,7 @@
 #include <vector>
 #include <optional>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 #include "oqdTradierpp/core/enums.hpp"
 
 namespace oqd {
@@ -28,6 +29,7 @@ struct Leg {
     
     static Leg from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct Order {
@@ -49,9 +51,11 @@ struct Order {
     std::string transaction_date;
     OrderClass order_class;
     std::vector<Leg> legs;
+    std::optional<std::string> tag;
     
     static Order from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 } // namespace oqd
\ No newline at end of file
@@ -0,0 +1,124 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+#include "oqdTradierpp/account/account_snapshot.hpp"
+#include "oqdTradierpp/endpoints.hpp"
+#include "oqdTradierpp/trading/order.hpp"
+#include "oqdTradierpp/trading/order_management.hpp"
+
+namespace oqd {
+
+// One order of a batch: the broker's response, or the error that replaced it.
+struct OrderBatchItem {
+    std::string order_id;                   // cancels: the id given; placements: the id assigned
+    std::optional<OrderResponse> response;
+    std::string error;
+    std::chrono::microseconds latency{0};   // request issued to response decoded
+
+    bool ok() const { return response.has_value(); }
+};
+
+struct OrderBatchResult {
+    std::vector<OrderBatchItem> items;      // in the order the requests were given
+    std::chrono::microseconds elapsed{0};   // wall time for the whole batch
+    std::chrono::microseconds budget_wait{0};
+    std::size_t budget_waits = 0;           // requests the budget held back
+
+    std::size_t succeeded() const {
+        return static_cast<std::size_t>(std::count_if(items.begin(), items.end(),
+                                                      [](const OrderBatchItem& item) { return item.ok(); }));
+    }
+    bool ok() const { return succeeded() == items.size(); }
+    std::vector<std::size_t> failed() const {
+        std::vector<std::size_t> indices;
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            if (!items[i].ok()) {
+                indices.push_back(i);
+            }
+        }
+        return indices;
+    }
+};
+
+struct OrderBatchOptions {
+    std::size_t max_in_flight = 64;
+    // Order placement and cancellation share the trading budget. The client's
+    // last X-Ratelimit-Available/Expiry reading, when current, caps the first window.
+    int requests_per_window = endpoints::accounts::orders::create::rate_limit;
+    std::chrono::seconds window{60};
+};
+
+// Ids of the orders still working at the broker (open, partially filled or
+// pending) that `filter` accepts; an empty filter accepts every one.
+inline std::vector<std::string> working_order_ids(std::span<const Order> orders,
+                                                  const std::function<bool(const Order&)>& filter = {}) {
+    std::vector<std::string> ids;
+    for (const auto& order : orders) {
+        bool working = order.status == OrderStatus::Open || order.status == OrderStatus::PartiallyFilled ||
+                       order.status == OrderStatus::Pending;
+        if (working && !order.id.empty() && (!filter || filter(order))) {
+            ids.push_back(order.id);
+        }
+    }
+    return ids;
+}
+
+// Issues `submit(i)` for every i in [0, count) from the calling thread with
+// up to `options.max_in_flight` requests outstanding, each admitted by `budget`.
+// `submit` is `(std::size_t index) -> std::future<OrderResponse>`, or a
+// future of Timed<OrderResponse> for per-order latency that does not depend
+// on collection order (see stamp_completion()). Its failures are recorded on
+// the item and never stop the rest of the batch.
+// `items` may arrive pre-sized with order ids filled in.
+template<typename Submit>
+OrderBatchResult dispatch_order_batch(std::size_t count, const OrderBatchOptions& options,
+                                      RequestWindowBudget& budget, Submit&& submit,
+                                      std::vector<OrderBatchItem> items = {}) {
+    using clock = std::chrono::steady_clock;
+    auto started = clock::now();
+
+    OrderBatchResult result;
+    result.items = std::move(items);
+    result.items.resize(count);
+
+    auto stats = run_in_flight(count, options.max_in_flight, budget, [&](std::size_t index) {
+        auto& item = result.items[index];
+        auto record = [&item](std::optional<OrderResponse> response, std::string error,
+                              std::chrono::microseconds latency) {
+            if (response && item.order_id.empty()) {
+                item.order_id = response->id;
+            }
+            item.response = std::move(response);
+            item.error = std::move(error);
+            item.latency = latency;
+        };
+        return issue_request(submit, std::move(record), index);
+    });
+
+    result.budget_wait = stats.budget_wait;
+    result.budget_waits = stats.budget_waits;
+    result.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - started);
+    return result;
+}
+
+} // namespace oqd
@@ -0,0 +1,138 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "oqdTradierpp/trading/advanced_orders.hpp"
+#include "oqdTradierpp/trading/multileg_orders.hpp"
+#include "oqdTradierpp/trading/order_requests.hpp"
+#include "oqdTradierpp/trading/spread_orders.hpp"
+
+namespace oqd {
+
+// Client-side limits on order submission. A zero disables the check.
+struct OrderGuardLimits {
+    std::uint32_t max_orders_per_account = 0;       // per rate_window
+    std::uint32_t max_orders_per_symbol = 0;        // per rate_window
+    std::chrono::milliseconds rate_window{1000};
+    std::chrono::milliseconds duplicate_window{0};  // identical orders inside it are rejected
+    std::size_t rate_buckets = 1024;                // hashed per-symbol counters, power of two
+    std::size_t duplicate_slots = 4096;             // remembered recent orders, power of two
+};
+
+enum class GuardVerdict : std::uint8_t {
+    Allowed,
+    AccountRate,
+    SymbolRate,
+    Duplicate
+};
+
+std::string_view to_string(GuardVerdict verdict);
+
+class OrderGuardException : public std::runtime_error {
+public:
+    OrderGuardException(GuardVerdict verdict, const std::string& msg)
+        : std::runtime_error(msg), verdict_(verdict) {}
+    GuardVerdict verdict() const { return verdict_; }
+
+private:
+    GuardVerdict verdict_;
+};
+
+// Word-at-a-time FNV-1a over the fields that make two orders the same order.
+class OrderFingerprint {
+public:
+    OrderFingerprint& add(std::string_view text);
+    OrderFingerprint& add(std::int64_t value);
+    // Prices hash on the 1/10000 tick grid, so 1.1 and 1.10000001 match.
+    OrderFingerprint& add_price(std::optional<double> price);
+    std::uint64_t value() const;
+
+private:
+    std::uint64_t hash_ = 14695981039346656037ull;
+};
+
+// Brake for runaway strategy loops, checked before an order leaves the
+// process. Rates are counted over a sliding window split into eight
+// sub-windows, per account and per symbol; duplicates are found by order
+// fingerprint in a fixed table of recent submissions.
+//
+// Every structure is a flat array of packed 64-bit atomics updated with
+// compare-and-swap, so admit() never locks or allocates. Counters are
+// reserved before the limit is compared and handed back on rejection, so
+// concurrent callers can only be refused early, never admitted past a
+// limit. Symbols (and accounts) that hash to one bucket share a counter;
+// that too can only refuse early.
+class OrderSubmissionGuard {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit OrderSubmissionGuard(OrderGuardLimits limits = {});
+    ~OrderSubmissionGuard();
+
+    OrderSubmissionGuard(const OrderSubmissionGuard&) = delete;
+    OrderSubmissionGuard& operator=(const OrderSubmissionGuard&) = delete;
+
+    GuardVerdict admit(std::string_view account_id, std::string_view symbol, std::uint64_t fingerprint,
+                       Clock::time_point now = Clock::now());
+
+    template<typename Request>
+    GuardVerdict admit(std::string_view account_id, const Request& order, Clock::time_point now = Clock::now()) {
+        return admit(account_id, rate_symbol(order), fingerprint(account_id, order), now);
+    }
+
+    const OrderGuardLimits& limits() const { return limits_; }
+
+    // Symbol each order type is rate-limited under.
+    static std::string_view rate_symbol(const OrderRequest& order) { return order.symbol; }
+    static std::string_view rate_symbol(const OptionOrderRequest& order) { return order.option_symbol; }
+    static std::string_view rate_symbol(const MultilegOrderRequest& order);
+    static std::string_view rate_symbol(const ComboOrderRequest& order);
+    static std::string_view rate_symbol(const OTOOrderRequest& order) { return order.first_order.symbol; }
+    static std::string_view rate_symbol(const OCOOrderRequest& order) { return order.first_order.symbol; }
+    static std::string_view rate_symbol(const OTOCOOrderRequest& order) { return order.primary_order.symbol; }
+    static std::string_view rate_symbol(const SpreadOrderRequest& order);
+
+    static std::uint64_t fingerprint(std::string_view account_id, const OrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const OptionOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const MultilegOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const ComboOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const OTOOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const OCOOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const OTOCOOrderRequest& order);
+    static std::uint64_t fingerprint(std::string_view account_id, const SpreadOrderRequest& order);
+
+private:
+    static constexpr std::size_t sub_windows = 8;
+    static constexpr std::size_t account_buckets = 64;
+
+    bool try_acquire(std::atomic<std::uint64_t>* bucket, std::uint32_t limit, std::uint64_t epoch);
+    void give_back(std::atomic<std::uint64_t>* bucket, std::uint64_t epoch);
+    static std::uint64_t clock_milliseconds(Clock::time_point now);
+
+    OrderGuardLimits limits_;
+    std::uint64_t sub_window_ms_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> account_counts_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> symbol_counts_;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> recent_orders_;
+};
+
+} // namespace oqd
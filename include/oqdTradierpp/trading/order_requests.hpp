@@ -15,6 +15,7 @@
 
 #include <string>
 #include <optional>
+#include "oqdTradierpp/core/json_fwd.hpp"
 #include "oqdTradierpp/core/enums.hpp"
 
 namespace oqd {
@@ -32,6 +33,7 @@ struct OrderRequest {
     std::optional<std::string> tag;
     
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct EquityOrderRequest : public OrderRequest {
@@ -43,6 +45,7 @@ struct OptionOrderRequest : public OrderRequest {
     
     OptionOrderRequest() { order_class = OrderClass::Option; }
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 } // namespace oqd
\ No newline at end of file
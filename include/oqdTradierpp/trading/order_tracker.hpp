@@ -0,0 +1,152 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "oqdTradierpp/api.hpp"
+#include "oqdTradierpp/streaming.hpp"
+
+namespace oqd {
+
+struct TrackedOrder {
+    std::string id;
+    std::optional<std::string> tag;
+    std::string symbol;
+    OrderSide side = OrderSide::Buy;
+    OrderType type = OrderType::Market;
+    OrderStatus status = OrderStatus::Pending;
+    double quantity = 0.0;
+    double filled_quantity = 0.0;
+    double remaining_quantity = 0.0;
+    double avg_fill_price = 0.0;
+    std::uint64_t sequence = 0;
+    std::chrono::system_clock::time_point last_update;
+
+    bool is_terminal() const;
+};
+
+struct OrderFill {
+    std::string order_id;
+    std::optional<std::string> tag;
+    std::string symbol;
+    OrderSide side = OrderSide::Buy;
+    double quantity = 0.0;
+    double price = 0.0;
+    double cumulative_quantity = 0.0;
+    double remaining_quantity = 0.0;
+    OrderStatus status = OrderStatus::PartiallyFilled;
+    std::chrono::system_clock::time_point timestamp;
+};
+
+// Live view of an account's orders driven by the account event stream.
+//
+// The tracker is seeded once from get_account_orders and afterwards only applies
+// streaming order events, so callers never need to poll the orders endpoint.
+// Every order runs through a small state machine:
+//
+//   pending -> open -> partially_filled -> filled
+//                 \-------------------\--> canceled / expired / rejected
+//
+// Terminal states are never left, regressions (a late "open" after a partial
+// fill) are ignored and fill quantities only move forward, so duplicated or
+// reordered events are harmless. Lookups by order id and by tag are O(1).
+class OrderTracker {
+public:
+    using FillCallback = std::function<void(const OrderFill&)>;
+    using StatusCallback = std::function<void(const TrackedOrder&, OrderStatus previous)>;
+
+    OrderTracker() = default;
+    OrderTracker(std::shared_ptr<ApiMethods> api, std::string account_id);
+
+    OrderTracker(const OrderTracker&) = delete;
+    OrderTracker& operator=(const OrderTracker&) = delete;
+
+    // Loads the current orders (with tags) from the REST API. Orders already
+    // known to the tracker keep their streamed state.
+    std::size_t seed();
+    std::size_t seed(const std::vector<Order>& orders);
+
+    // Applies one order event. Returns true when the tracked state changed.
+    bool apply(const StreamingOrderStatus& event);
+
+    // Decodes and applies a raw account stream element; non-order events are ignored.
+    bool on_stream_event(const simdjson::dom::element& elem);
+
+    // Callback suitable for StreamingSession::start_account_*_stream.
+    StreamingCallback stream_callback();
+
+    // Callbacks run on the thread applying the event, after the book lock is
+    // released; they may query the tracker or register further callbacks.
+    void on_fill(FillCallback callback);
+    void on_status_change(StatusCallback callback);
+
+    std::optional<TrackedOrder> find(const std::string& order_id) const;
+    std::optional<TrackedOrder> find_by_tag(const std::string& tag) const;
+    std::optional<OrderStatus> status_of(const std::string& order_id) const;
+
+    std::vector<TrackedOrder> open_orders() const;
+    std::vector<TrackedOrder> all_orders() const;
+    std::size_t size() const;
+    std::size_t open_count() const;
+
+    // Drops orders in a terminal state, returning how many were removed. The
+    // last pruned_history ids are remembered, so events replayed after a
+    // reconnect and later seeds do not bring them back; older ids are
+    // forgotten first.
+    std::size_t prune_terminal();
+    void clear();
+
+    static bool is_terminal(OrderStatus status);
+    static bool can_transition(OrderStatus from, OrderStatus to);
+
+    static constexpr std::size_t pruned_history = 4096;
+
+private:
+    struct Update {
+        std::optional<OrderFill> fill;
+        std::optional<std::pair<TrackedOrder, OrderStatus>> status_change;
+    };
+
+    Update apply_locked(const StreamingOrderStatus& event);
+    void index_tag(const TrackedOrder& order);
+    void dispatch(const Update& update) const;
+
+    std::shared_ptr<ApiMethods> api_;
+    std::string account_id_;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, TrackedOrder> orders_;
+    std::unordered_map<std::string, std::string> tag_index_;
+    std::unordered_set<std::string> pruned_;
+    std::deque<std::string> pruned_order_;
+    std::size_t open_count_ = 0;
+    std::uint64_t sequence_ = 0;
+
+    mutable std::mutex callback_mutex_;
+    std::vector<FillCallback> fill_callbacks_;
+    std::vector<StatusCallback> status_callbacks_;
+};
+
+} // namespace oqd
\ No newline at end of file
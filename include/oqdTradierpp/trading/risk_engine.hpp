@@ -0,0 +1,148 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "oqdTradierpp/account/position.hpp"
+#include "oqdTradierpp/core/enums.hpp"
+#include "oqdTradierpp/streaming.hpp"
+#include "oqdTradierpp/trading/order_requests.hpp"
+
+namespace oqd {
+
+// Account-wide pre-trade limits. A zero disables the check.
+struct RiskLimits {
+    double max_order_notional = 0.0;     // price * quantity * multiplier of one order
+    double max_open_notional = 0.0;      // sum over accepted, unreleased orders
+    double max_position = 0.0;           // |held + pending| per symbol, unless overridden
+    double max_orders_per_second = 0.0;  // token bucket, bursts up to one second's worth
+    double price_band = 0.0;             // max |limit - last| / last, e.g. 0.05
+};
+
+enum class RiskVerdict : std::uint8_t {
+    Accepted,
+    InvalidOrder,       // unknown symbol, non-positive or NaN quantity/price
+    NoReferencePrice,   // market order on a symbol without a last price
+    PriceBand,
+    OrderNotional,
+    OpenNotional,
+    PositionLimit,
+    OrderRate
+};
+
+std::string_view to_string(RiskVerdict verdict);
+
+// Hot-path order ticket: the symbol is a dense id from symbol_id(), so a check
+// touches only flat arrays.
+struct RiskOrder {
+    std::uint32_t symbol = 0;
+    OrderSide side = OrderSide::Buy;
+    double quantity = 0.0;
+    double limit_price = 0.0;   // 0 for market and stop orders: valued at the last price
+};
+
+struct RiskDecision {
+    RiskVerdict verdict = RiskVerdict::InvalidOrder;
+    double notional = 0.0;      // reserved against max_open_notional when accepted
+
+    bool accepted() const { return verdict == RiskVerdict::Accepted; }
+};
+
+// Pre-trade risk gate meant to sit inline before every place_*_order call.
+//
+// Per-symbol state (last price, multiplier, held and pending quantity,
+// position limit) lives in parallel arrays indexed by symbol id, and every
+// check is a fixed sequence of arithmetic on one slot plus the account
+// totals: no allocation, lookup or loop. An accepted order reserves its
+// quantity and notional until apply_fill() or release() hands them back;
+// rejected orders reserve nothing and consume no rate budget. check_batch()
+// takes the lock once for the whole batch.
+class PreTradeRiskEngine {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit PreTradeRiskEngine(RiskLimits limits = {});
+
+    PreTradeRiskEngine(const PreTradeRiskEngine&) = delete;
+    PreTradeRiskEngine& operator=(const PreTradeRiskEngine&) = delete;
+
+    // Dense id for `symbol`, creating its slot (multiplier 100 for OCC
+    // option symbols) on first use.
+    std::uint32_t symbol_id(const std::string& symbol);
+    std::optional<std::uint32_t> find_symbol(const std::string& symbol) const;
+
+    void set_limits(const RiskLimits& limits);
+    RiskLimits limits() const;
+    void set_position_limit(std::uint32_t symbol, double max_position);
+
+    // Replaces held quantities with a positions snapshot; pending reservations stay.
+    void seed(const std::vector<Position>& positions);
+    void set_position(std::uint32_t symbol, double quantity);
+    void set_last_price(std::uint32_t symbol, double price);
+    // Takes the last trade, falling back to the midpoint. Unknown symbols are ignored.
+    bool on_quote(const StreamingQuote& quote);
+
+    RiskDecision check(const RiskOrder& order, Clock::time_point now = Clock::now());
+    // Checks orders in sequence, each seeing the reservations of the ones
+    // accepted before it. Returns the number accepted.
+    std::size_t check_batch(std::span<const RiskOrder> orders, std::span<RiskDecision> decisions,
+                            Clock::time_point now = Clock::now());
+    // Convenience path that resolves the symbol by name first.
+    RiskDecision check(const OrderRequest& order, Clock::time_point now = Clock::now());
+    RiskDecision check(const OptionOrderRequest& order, Clock::time_point now = Clock::now());
+
+    // Moves a filled quantity from pending to held.
+    void apply_fill(std::uint32_t symbol, OrderSide side, double quantity);
+    // Returns an accepted order's unfilled quantity and its notional, once
+    // the order is filled, canceled or rejected downstream.
+    void release(const RiskOrder& order, const RiskDecision& decision, double unfilled_quantity);
+
+    double open_notional() const;
+    double position(std::uint32_t symbol) const;
+    // Net working quantity: pending buys minus pending sells.
+    double pending(std::uint32_t symbol) const;
+    std::size_t symbol_count() const;
+
+private:
+    static RiskOrder to_risk_order(std::uint32_t symbol, const OrderRequest& order);
+    RiskDecision check_locked(const RiskOrder& order, Clock::time_point now);
+    void refill_locked(Clock::time_point now);
+    void unreserve_locked(std::uint32_t symbol, OrderSide side, double quantity);
+    std::uint32_t slot_for(const std::string& symbol);
+
+    mutable std::mutex mutex_;
+    RiskLimits limits_;
+
+    std::unordered_map<std::string, std::uint32_t> symbol_index_;
+    std::vector<double> last_price_;
+    std::vector<double> multiplier_;
+    std::vector<double> held_;
+    std::vector<double> pending_buy_;    // quantity reserved by accepted, working buys
+    std::vector<double> pending_sell_;   // likewise for sells, kept apart so neither offsets the other
+    std::vector<double> max_position_;   // 0 falls back to limits_.max_position
+
+    double open_notional_ = 0.0;
+    double tokens_ = 0.0;
+    Clock::time_point refilled_{};
+};
+
+} // namespace oqd
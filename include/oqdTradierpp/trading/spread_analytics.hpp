@@ -0,0 +1,114 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "oqdTradierpp/trading/spread_orders.hpp"
+
+namespace oqd {
+
+enum class SpreadStrategy : std::uint8_t {
+    Invalid,        // a leg is not an OCC option symbol, or there are no legs
+    Single,
+    Vertical,
+    Ratio,
+    Calendar,
+    Diagonal,
+    Straddle,
+    Strangle,
+    Butterfly,
+    Condor,
+    IronButterfly,
+    IronCondor,
+    Custom
+};
+
+std::string_view to_string(SpreadStrategy strategy);
+
+// Recognizes the common structures from the legs alone, ignoring the
+// request's spread_type label.
+SpreadStrategy classify_spread(const SpreadOrderRequest& order);
+
+struct SpreadAnalyticsParams {
+    double spot = 0.0;                  // underlying price now
+    double rate = 0.0;                  // continuously compounded risk-free rate
+    double dividend_yield = 0.0;
+    double volatility = 0.25;           // implied volatility applied to every leg
+    // Price axis: price_points values evenly spaced over spot * (1 +/- price_range).
+    double price_range = 0.5;
+    std::size_t price_points = 201;
+    // Volatility axis of the surface: vol_points absolute shifts of
+    // `volatility` from vol_shift_low to vol_shift_high.
+    double vol_shift_low = -0.10;
+    double vol_shift_high = 0.10;
+    std::size_t vol_points = 5;
+    double horizon_days = 0.0;          // the surface values the spread this far ahead
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    unsigned threads = 0;               // 0: one per hardware thread
+};
+
+// Dollar P&L for the whole order. The net price follows the order's sign
+// convention: positive is a debit paid, negative a credit received.
+struct SpreadAnalysis {
+    SpreadStrategy strategy = SpreadStrategy::Invalid;
+    std::string error;                  // why the spread could not be analyzed
+
+    double net_premium = 0.0;           // cash at entry, positive when received
+    // Extremes and breakevens at the first expiry. Later-dated legs are valued
+    // with Black-Scholes there, so for calendars and diagonals they come from
+    // the price grid; otherwise they are exact. Unbounded sides are infinite.
+    double max_profit = 0.0;
+    double max_loss = 0.0;              // positive magnitude
+    std::vector<double> breakevens;     // ascending underlying prices
+    // Risk-neutral lognormal odds at the first expiry, using `volatility`.
+    double probability_of_profit = 0.0;
+    double probability_of_max_profit = 0.0;
+    double probability_of_max_loss = 0.0;
+
+    // Position greeks now: delta and gamma per $1, theta per day, vega per 1 vol point.
+    double delta = 0.0;
+    double gamma = 0.0;
+    double theta = 0.0;
+    double vega = 0.0;
+
+    std::vector<double> expiry_pnl;     // P&L at the first expiry, per price point
+    // P&L at the horizon, vol_points rows of price_points, row-major.
+    std::vector<double> surface;
+
+    bool ok() const { return strategy != SpreadStrategy::Invalid; }
+    double surface_at(std::size_t vol_index, std::size_t price_index) const {
+        return surface[vol_index * expiry_pnl.size() + price_index];
+    }
+};
+
+// Axes shared by every analysis run with `params`: underlying prices, and the
+// absolute volatility of each surface row.
+std::vector<double> spread_price_axis(const SpreadAnalyticsParams& params);
+std::vector<double> spread_vol_axis(const SpreadAnalyticsParams& params);
+
+SpreadAnalysis analyze_spread(const SpreadOrderRequest& order, const SpreadAnalyticsParams& params);
+
+// Screens many candidates at once, spreading them over params.threads
+// workers. Results are index-aligned with `orders`. The grid kernels use the
+// same instruction-set dispatch as the greeks (see greeks_kernel_isa()).
+std::vector<SpreadAnalysis> analyze_spreads(std::span<const SpreadOrderRequest> orders,
+                                            const SpreadAnalyticsParams& params);
+
+} // namespace oqd
@@ -17,6 +17,7 @@
 #include <vector>
 #include <optional>
 #include <simdjson.h>
+#include "oqdTradierpp/core/json_fwd.hpp"
 #include "oqdTradierpp/core/enums.hpp"
 
 namespace oqd {
@@ -29,6 +30,7 @@ struct SpreadLeg {
     
     static SpreadLeg from_json(const simdjson::dom::element& elem);
     std::string to_json() const;
+    void write_json(json::JsonBuilder& builder) const;
 };
 
 struct SpreadOrderRequest {
@@ -27,6 +27,8 @@
 #include "account/account_history.hpp"
 #include "account/gain_loss_item.hpp"
 #include "account/gain_loss.hpp"
+#include "account/history_event.hpp"
+#include "account/closed_position.hpp"
 #include "trading/order.hpp"
 #include "trading/order_requests.hpp"
 #include "trading/multileg_orders.hpp"
@@ -37,6 +39,7 @@
 #include "market/option_chain.hpp"
 #include "market/historical_data.hpp"
 #include "market/time_sales.hpp"
+#include "market/time_sales_series.hpp"
 #include "market/market_status.hpp"
 #include "market/symbol_search.hpp"
 #include "fundamentals/corp_actions.hpp"
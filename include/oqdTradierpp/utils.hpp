@@ -13,12 +13,16 @@
 
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include <array>
 #include <unordered_map>
+#include <vector>
 
 namespace oqd::utils {
 
@@ -202,4 +206,76 @@ inline std::string build_form_data(const std::unordered_map<std::string, std::st
     return build_query_string(params); // Same format for form data
 }
 
+/**
+ * @brief Build a canonical key for a request: the path followed by the
+ *        parameters sorted by name, so equal requests give equal keys
+ * @param path Endpoint path
+ * @param params Query parameters in any order
+ * @param origin Base URL the request goes to; empty for a path-only key
+ * @return "path?a=1&b=2", or "path?a=1&b=2@origin" when an origin is given.
+ *         Names and values are percent-encoded as in build_query_string, so
+ *         a '&', '=' or '@' inside a value cannot make two requests collide
+ */
+
+inline std::string canonical_request_key(std::string_view path,
+                                         const std::unordered_map<std::string, std::string>& params,
+                                         std::string_view origin = {}) {
+    std::vector<const std::pair<const std::string, std::string>*> sorted;
+    sorted.reserve(params.size());
+    for (const auto& param : params) {
+        sorted.push_back(&param);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    std::string key(path);
+    key.push_back('?');
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        if (i > 0) {
+            key.push_back('&');
+        }
+        key += url_encode(sorted[i]->first);
+        key.push_back('=');
+        key += url_encode(sorted[i]->second);
+    }
+    if (!origin.empty()) {
+        key.push_back('@');
+        key.append(origin);
+    }
+    return key;
+}
+
+/**
+ * @brief Parse the calendar date at the start of an ISO 8601 string
+ * @param text "YYYY-MM-DD", optionally followed by a time ("T00:00:00.000Z")
+ * @return The date, or std::nullopt if the prefix is not a valid date
+ */
+
+inline std::optional<std::chrono::sys_days> parse_iso_date(std::string_view text) {
+    if (text.size() < 10 || text[4] != '-' || text[7] != '-') {
+        return std::nullopt;
+    }
+    auto digits = [&text](std::size_t pos, std::size_t count, int& value) {
+        value = 0;
+        for (std::size_t i = pos; i < pos + count; ++i) {
+            if (text[i] < '0' || text[i] > '9') {
+                return false;
+            }
+            value = value * 10 + (text[i] - '0');
+        }
+        return true;
+    };
+    int year = 0;
+    int month = 0;
+    int day = 0;
+    if (!digits(0, 4, year) || !digits(5, 2, month) || !digits(8, 2, day)) {
+        return std::nullopt;
+    }
+    std::chrono::year_month_day ymd{std::chrono::year{year}, std::chrono::month{static_cast<unsigned>(month)},
+                                    std::chrono::day{static_cast<unsigned>(day)}};
+    if (!ymd.ok()) {
+        return std::nullopt;
+    }
+    return std::chrono::sys_days{ymd};
+}
+
 } // namespace oqd::utils
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "types.hpp"
+#include "core/price.hpp"
 #include <string>
 #include <vector>
 #include <optional>
@@ -114,6 +115,10 @@ public:
     static bool is_valid_option_price(double price);
     static bool is_valid_price_increment(double price, const std::string& symbol);
     static bool is_reasonable_price_range(double price, const std::string& symbol);
+    // Exact tick grid: stocks trade in $0.01 from $1.00 and $0.0001 below;
+    // options in $0.05 from $3.00 and $0.01 below.
+    static Price tick_size(Price price, const std::string& symbol);
+    static bool is_valid_price_increment(Price price, const std::string& symbol);
     
     // Enhanced quantity validation
     static bool is_valid_stock_quantity(int quantity);
@@ -44,8 +44,12 @@ AccountBalances AccountBalances::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string AccountBalances::to_json() const {
-    return json::create_object()
-        .set_fixed().set_precision(2)
+    return json::write_to_string(*this);
+}
+
+void AccountBalances::write_json(json::JsonBuilder& builder) const {
+    builder.set_fixed().set_precision(2)
+        .start_object()
         .field("account_number", account_number)
         .field("total_equity", total_equity)
         .field("long_market_value", long_market_value)
@@ -66,8 +70,7 @@ std::string AccountBalances::to_json() const {
         .field("dividend", dividend)
         .field("cash", cash)
         .field("market_value", market_value)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
@@ -36,10 +36,13 @@ AccountHistory AccountHistory::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string AccountHistory::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void AccountHistory::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .array_field("history", history)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
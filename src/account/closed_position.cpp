@@ -0,0 +1,78 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/account/closed_position.hpp"
+#include "oqdTradierpp/utils.hpp"
+
+namespace oqd {
+
+namespace {
+
+void read_date(const simdjson::dom::element& elem, const char* key, std::chrono::sys_days& out) {
+    std::string_view text;
+    if (elem[key].get(text) == simdjson::SUCCESS) {
+        if (auto date = utils::parse_iso_date(text)) {
+            out = *date;
+        }
+    }
+}
+
+void read_double(const simdjson::dom::element& elem, const char* key, double& out) {
+    double value;
+    if (elem[key].get(value) == simdjson::SUCCESS) {
+        out = value;
+    }
+}
+
+} // namespace
+
+ClosedPosition ClosedPosition::from_json(const simdjson::dom::element& elem) {
+    ClosedPosition position;
+    read_date(elem, "open_date", position.open_date);
+    read_date(elem, "close_date", position.close_date);
+    read_double(elem, "quantity", position.quantity);
+    read_double(elem, "cost", position.cost);
+    read_double(elem, "proceeds", position.proceeds);
+    read_double(elem, "gain_loss", position.gain_loss);
+    read_double(elem, "gain_loss_percent", position.gain_loss_percent);
+
+    std::int64_t term;
+    if (elem["term"].get(term) == simdjson::SUCCESS) {
+        position.term = static_cast<std::int32_t>(term);
+    }
+    std::string_view symbol;
+    if (elem["symbol"].get(symbol) == simdjson::SUCCESS) {
+        position.symbol.assign(symbol);
+    }
+    return position;
+}
+
+std::vector<ClosedPosition> ClosedPosition::list_from_json(const simdjson::dom::element& response) {
+    std::vector<ClosedPosition> positions;
+    simdjson::dom::element closed;
+    if (response["gainloss"]["closed_position"].get(closed) != simdjson::SUCCESS) {
+        return positions;
+    }
+    simdjson::dom::array closed_array;
+    if (closed.get(closed_array) == simdjson::SUCCESS) {
+        positions.reserve(closed_array.size());
+        for (auto entry : closed_array) {
+            positions.push_back(from_json(entry));
+        }
+    } else if (closed.is_object()) {
+        positions.push_back(from_json(closed));
+    }
+    return positions;
+}
+
+} // namespace oqd
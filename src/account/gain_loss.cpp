@@ -36,10 +36,13 @@ GainLoss GainLoss::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string GainLoss::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void GainLoss::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .array_field("gainloss", gainloss)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
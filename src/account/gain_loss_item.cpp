@@ -68,7 +68,11 @@ GainLossItem GainLossItem::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string GainLossItem::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void GainLossItem::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .set_fixed().set_precision(2)
         .field("close_date", close_date)
         .field("cost", cost)
@@ -79,8 +83,7 @@ std::string GainLossItem::to_json() const {
         .field("quantity", quantity)
         .field("symbol", symbol)
         .field("term", term)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/account/history_event.hpp"
+#include "oqdTradierpp/core/enum_table.hpp"
+#include "oqdTradierpp/utils.hpp"
+
+namespace oqd {
+
+namespace {
+
+constexpr EnumTable<HistoryEventType, 12> event_types{{
+    "trade", "option", "ach", "wire", "dividend", "fee",
+    "tax", "journal", "check", "transfer", "adjustment", "interest"}};
+
+void read_double(const simdjson::dom::element& elem, const char* key, double& out) {
+    double value;
+    if (elem[key].get(value) == simdjson::SUCCESS) {
+        out = value;
+    }
+}
+
+void read_string(const simdjson::dom::element& elem, const char* key, std::string& out) {
+    std::string_view value;
+    if (elem[key].get(value) == simdjson::SUCCESS) {
+        out.assign(value);
+    }
+}
+
+} // namespace
+
+std::string_view to_string(HistoryEventType type) {
+    return event_types.name(type, "other");
+}
+
+HistoryEventType history_event_type_from_string(std::string_view str) {
+    return event_types.parse(str).value_or(HistoryEventType::Other);
+}
+
+HistoryEvent HistoryEvent::from_json(const simdjson::dom::element& elem) {
+    HistoryEvent event;
+    read_double(elem, "amount", event.amount);
+
+    std::string_view text;
+    if (elem["date"].get(text) == simdjson::SUCCESS) {
+        if (auto date = utils::parse_iso_date(text)) {
+            event.date = *date;
+        }
+    }
+
+    std::string_view type_name;
+    if (elem["type"].get(type_name) == simdjson::SUCCESS) {
+        event.type = history_event_type_from_string(type_name);
+    }
+
+    // Details live under the type key; older payloads put them at the top.
+    simdjson::dom::element details = elem;
+    simdjson::dom::element nested;
+    if (!type_name.empty() && elem[type_name].get(nested) == simdjson::SUCCESS && nested.is_object()) {
+        details = nested;
+    }
+    read_double(details, "quantity", event.quantity);
+    read_double(details, "price", event.price);
+    read_double(details, "commission", event.commission);
+    read_string(details, "symbol", event.symbol);
+    read_string(details, "description", event.description);
+    return event;
+}
+
+std::vector<HistoryEvent> HistoryEvent::list_from_json(const simdjson::dom::element& response) {
+    std::vector<HistoryEvent> events;
+    simdjson::dom::element event_elem;
+    if (response["history"]["event"].get(event_elem) != simdjson::SUCCESS) {
+        return events;
+    }
+    simdjson::dom::array event_array;
+    if (event_elem.get(event_array) == simdjson::SUCCESS) {
+        events.reserve(event_array.size());
+        for (auto event : event_array) {
+            events.push_back(from_json(event));
+        }
+    } else if (event_elem.is_object()) {
+        events.push_back(from_json(event_elem));
+    }
+    return events;
+}
+
+} // namespace oqd
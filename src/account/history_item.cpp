@@ -31,7 +31,11 @@ HistoryItem HistoryItem::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string HistoryItem::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void HistoryItem::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .set_fixed().set_precision(2)
         .field("amount", amount)
         .field("date", date)
@@ -42,8 +46,7 @@ std::string HistoryItem::to_json() const {
         .field("price", price)
         .field("commission", commission)
         .field("symbol", symbol)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,299 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/account/portfolio_engine.hpp"
+#include "oqdTradierpp/core/occ_symbol.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace oqd {
+
+namespace {
+
+constexpr double quantity_epsilon = 1e-9;
+
+} // namespace
+
+PortfolioEngine::PortfolioEngine(std::shared_ptr<ApiMethods> api, std::string account_id)
+    : api_(std::move(api))
+    , account_id_(std::move(account_id)) {
+}
+
+double PortfolioEngine::contract_multiplier(const std::string& symbol) {
+    // OCC symbols end in YYMMDD + C/P + 8-digit strike, e.g. SPY250620C00500000.
+    return OccSymbol::parse(symbol) ? option_multiplier : 1.0;
+}
+
+void PortfolioEngine::seed() {
+    if (!api_) {
+        throw std::runtime_error("PortfolioEngine::seed requires an ApiMethods instance");
+    }
+    auto positions_future = api_->get_account_positions_async(account_id_);
+    auto balances_future = api_->get_account_balances_async(account_id_);
+    seed(positions_future.get(), balances_future.get());
+}
+
+void PortfolioEngine::seed(const std::vector<Position>& positions, const AccountBalances& balances) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    reset_locked();
+    cash_ = balances.total_cash;
+    slots_.reserve(positions.size());
+
+    auto now = std::chrono::system_clock::now();
+    for (const auto& position : positions) {
+        auto& slot = slot_for(position.symbol);
+        add_contribution(slot, -1.0);
+        // cost_basis is the total paid, signed like the quantity.
+        double total_cost = slot.avg_cost * slot.quantity * slot.multiplier + position.cost_basis;
+        slot.quantity += position.quantity;
+        slot.avg_cost = std::abs(slot.quantity) > quantity_epsilon
+            ? total_cost / (slot.quantity * slot.multiplier)
+            : 0.0;
+        // Until the first quote arrives the position is carried at cost.
+        slot.mark_price = slot.avg_cost;
+        slot.last_update = now;
+        revalue(slot);
+        add_contribution(slot, 1.0);
+    }
+}
+
+void PortfolioEngine::apply_fill(const OrderFill& fill) {
+    apply_fill(fill.symbol, fill.side, fill.quantity, fill.price);
+}
+
+void PortfolioEngine::apply_fill(const std::string& symbol, OrderSide side, double quantity, double price) {
+    if (symbol.empty() || quantity <= 0.0) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto& slot = slot_for(symbol);
+    add_contribution(slot, -1.0);
+
+    double delta = signed_quantity(side, quantity);
+    double held = slot.quantity;
+    cash_ -= delta * price * slot.multiplier;
+
+    if (std::abs(held) <= quantity_epsilon || (held > 0.0) == (delta > 0.0)) {
+        // Opening or adding: blend into the average cost.
+        double total = std::abs(held) + quantity;
+        slot.avg_cost = (slot.avg_cost * std::abs(held) + price * quantity) / total;
+        slot.quantity = held + delta;
+    } else {
+        // Reducing, possibly through zero into the opposite side.
+        double closed = std::min(quantity, std::abs(held));
+        double direction = held > 0.0 ? 1.0 : -1.0;
+        slot.realized_pl += closed * (price - slot.avg_cost) * direction * slot.multiplier;
+        slot.quantity = held + delta;
+        if (std::abs(slot.quantity) <= quantity_epsilon) {
+            slot.quantity = 0.0;
+            slot.avg_cost = 0.0;
+        } else if ((slot.quantity > 0.0) != (held > 0.0)) {
+            slot.avg_cost = price;
+        }
+    }
+
+    if (!slot.marked) {
+        slot.mark_price = price;
+    }
+    slot.last_update = std::chrono::system_clock::now();
+    revalue(slot);
+    add_contribution(slot, 1.0);
+}
+
+bool PortfolioEngine::on_quote(const StreamingQuote& quote) {
+    double price = 0.0;
+    if (quote.bid > 0.0 && quote.ask > 0.0) {
+        price = (quote.bid + quote.ask) * 0.5;
+    } else if (quote.last > 0.0) {
+        price = quote.last;
+    }
+    return mark(quote.symbol, price);
+}
+
+bool PortfolioEngine::mark(const std::string& symbol, double price) {
+    if (price <= 0.0 || !std::isfinite(price)) {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto* slot = find_slot(symbol);
+    if (slot == nullptr) {
+        return false;
+    }
+    add_contribution(*slot, -1.0);
+    slot->mark_price = price;
+    slot->marked = true;
+    slot->last_update = std::chrono::system_clock::now();
+    revalue(*slot);
+    add_contribution(*slot, 1.0);
+    return true;
+}
+
+bool PortfolioEngine::on_stream_event(const simdjson::dom::element& elem) {
+    if (StreamingSession::determine_data_type_static(elem) != StreamingDataType::Quote) {
+        return false;
+    }
+    return on_quote(StreamingQuote::from_json(elem));
+}
+
+StreamingCallback PortfolioEngine::stream_callback() {
+    return [this](const simdjson::dom::element& elem) {
+        on_stream_event(elem);
+    };
+}
+
+void PortfolioEngine::attach(OrderTracker& tracker) {
+    tracker.on_fill([this](const OrderFill& fill) {
+        apply_fill(fill);
+    });
+}
+
+PositionMark& PortfolioEngine::slot_for(const std::string& symbol) {
+    auto it = slot_index_.find(symbol);
+    if (it != slot_index_.end()) {
+        return slots_[it->second];
+    }
+    PositionMark slot;
+    slot.symbol = symbol;
+    slot.multiplier = contract_multiplier(symbol);
+    slot_index_.emplace(symbol, slots_.size());
+    slots_.push_back(std::move(slot));
+    return slots_.back();
+}
+
+PositionMark* PortfolioEngine::find_slot(const std::string& symbol) {
+    auto it = slot_index_.find(symbol);
+    if (it == slot_index_.end()) {
+        return nullptr;
+    }
+    return &slots_[it->second];
+}
+
+void PortfolioEngine::revalue(PositionMark& slot) {
+    slot.market_value = slot.quantity * slot.mark_price * slot.multiplier;
+    slot.unrealized_pl = slot.quantity * (slot.mark_price - slot.avg_cost) * slot.multiplier;
+}
+
+void PortfolioEngine::add_contribution(const PositionMark& slot, double sign) {
+    totals_.market_value += sign * slot.market_value;
+    if (slot.market_value >= 0.0) {
+        totals_.long_market_value += sign * slot.market_value;
+    } else {
+        totals_.short_market_value += sign * slot.market_value;
+    }
+    totals_.gross_exposure += sign * std::abs(slot.market_value);
+    totals_.unrealized_pl += sign * slot.unrealized_pl;
+    totals_.realized_pl += sign * slot.realized_pl;
+    if (slot.quantity != 0.0) {
+        if (sign > 0.0) {
+            ++totals_.open_positions;
+        } else {
+            --totals_.open_positions;
+        }
+    }
+}
+
+std::optional<PositionMark> PortfolioEngine::position(const std::string& symbol) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = slot_index_.find(symbol);
+    if (it == slot_index_.end()) {
+        return std::nullopt;
+    }
+    return slots_[it->second];
+}
+
+std::vector<PositionMark> PortfolioEngine::positions() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<PositionMark> result;
+    result.reserve(totals_.open_positions);
+    for (const auto& slot : slots_) {
+        if (slot.quantity != 0.0) {
+            result.push_back(slot);
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> PortfolioEngine::symbols() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> result;
+    result.reserve(totals_.open_positions);
+    for (const auto& slot : slots_) {
+        if (slot.quantity != 0.0) {
+            result.push_back(slot.symbol);
+        }
+    }
+    return result;
+}
+
+PortfolioSnapshot PortfolioEngine::snapshot() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    PortfolioSnapshot snapshot;
+    snapshot.cash = cash_;
+    snapshot.market_value = totals_.market_value;
+    snapshot.long_market_value = totals_.long_market_value;
+    snapshot.short_market_value = totals_.short_market_value;
+    snapshot.gross_exposure = totals_.gross_exposure;
+    snapshot.net_exposure = totals_.market_value;
+    snapshot.unrealized_pl = totals_.unrealized_pl;
+    snapshot.realized_pl = totals_.realized_pl;
+    snapshot.equity = cash_ + totals_.market_value;
+    snapshot.open_positions = totals_.open_positions;
+    return snapshot;
+}
+
+double PortfolioEngine::cash() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return cash_;
+}
+
+double PortfolioEngine::equity() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return cash_ + totals_.market_value;
+}
+
+double PortfolioEngine::unrealized_pl() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return totals_.unrealized_pl;
+}
+
+double PortfolioEngine::realized_pl() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return totals_.realized_pl;
+}
+
+double PortfolioEngine::gross_exposure() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return totals_.gross_exposure;
+}
+
+double PortfolioEngine::net_exposure() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return totals_.market_value;
+}
+
+void PortfolioEngine::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    reset_locked();
+}
+
+void PortfolioEngine::reset_locked() {
+    slots_.clear();
+    slot_index_.clear();
+    totals_ = Totals{};
+    cash_ = 0.0;
+}
+
+} // namespace oqd
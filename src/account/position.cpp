@@ -27,14 +27,17 @@ Position Position::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string Position::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void Position::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .field("cost_basis", cost_basis)
         .field("date_acquired", date_acquired)
         .field("id", id)
         .field("quantity", quantity)
         .field("symbol", symbol)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 }
\ No newline at end of file
@@ -14,11 +14,134 @@
 #include "oqdTradierpp/api.hpp"
 #include <algorithm>
 #include <regex>
+#include <stdexcept>
+#include <type_traits>
 
 namespace oqd {
 
+namespace {
+
+template<typename T>
+T decode(const simdjson::dom::element& response) {
+    return T::from_json(response);
+}
+
+// Decoder wrappers for the request builders: the plain *_async methods decode
+// as is, the snapshot and batch paths stamp completion on the worker.
+struct as_is {
+    template<typename Decode>
+    Decode operator()(Decode decode) const { return decode; }
+};
+
+struct stamped {
+    template<typename Decode>
+    auto operator()(Decode decode) const { return stamp_completion(std::move(decode)); }
+};
+
+// Prices go out on the 1/10000 tick grid ("150.25", not "150.250000").
+// Callers check prices_representable() first; this throw is only a backstop.
+std::string price_param(double price) {
+    if (!Price::representable(price)) {
+        throw std::invalid_argument("Order price " + std::to_string(price) + " is not a finite, representable price");
+    }
+    return Price::from_double(price).to_string();
+}
+
+// Every price an order would send must survive price_param(). Checked before
+// the submission guard, so an order that can never be sent takes no rate
+// slot and leaves no duplicate stamp.
+bool representable(std::optional<double> price) {
+    return !price || Price::representable(*price);
+}
+
+bool prices_representable(const OrderRequest& order) {
+    return representable(order.price) && representable(order.stop);
+}
+
+bool prices_representable(const OrderComponent& order) {
+    return representable(order.price) && representable(order.stop);
+}
+
+bool prices_representable(const OrderModification& modification) {
+    return representable(modification.price) && representable(modification.stop);
+}
+
+bool prices_representable(const MultilegOrderRequest& order) { return representable(order.price); }
+bool prices_representable(const ComboOrderRequest& order) { return representable(order.price); }
+bool prices_representable(const SpreadOrderRequest& order) { return representable(order.price); }
+
+bool prices_representable(const OTOOrderRequest& order) {
+    return prices_representable(order.first_order) && prices_representable(order.second_order);
+}
+
+bool prices_representable(const OCOOrderRequest& order) {
+    return prices_representable(order.first_order) && prices_representable(order.second_order);
+}
+
+bool prices_representable(const OTOCOOrderRequest& order) {
+    return prices_representable(order.primary_order) && prices_representable(order.profit_order) &&
+           prices_representable(order.stop_order);
+}
+
+// Ready future carrying the invalid price error; no request is sent.
+template<typename T>
+std::future<T> invalid_price() {
+    std::promise<T> promise;
+    promise.set_exception(std::make_exception_ptr(
+        std::invalid_argument("Order price is NaN, infinite or beyond Price::max_units")));
+    return promise.get_future();
+}
+
+// Ready future carrying a submission guard rejection; no request is sent.
+template<typename T = OrderResponse>
+std::future<T> rejected_order(GuardVerdict verdict) {
+    std::promise<T> promise;
+    promise.set_exception(std::make_exception_ptr(
+        OrderGuardException(verdict, "Order rejected by submission guard: " + std::string(to_string(verdict)))));
+    return promise.get_future();
+}
+
+RequestWindowBudget trading_budget(const TradierClient& client, const OrderBatchOptions& options) {
+    std::optional<int> available;
+    RequestWindowBudget::clock::time_point window_end{};
+    if (auto limit = client.get_rate_limit(EndpointGroup::Trading)) {
+        available = limit->available;
+        window_end = limit->expiry;
+    }
+    return RequestWindowBudget(options.requests_per_window, options.window, available, window_end);
+}
+
+} // namespace
+
 ApiMethods::ApiMethods(std::shared_ptr<TradierClient> client) 
-    : client_(std::move(client)) {
+    : client_(std::move(client)), cache_(std::make_shared<ResponseCache>()) {
+}
+
+template<typename Request>
+GuardVerdict ApiMethods::screen(const std::string& account_id, const Request& order) const {
+    return guard_ ? guard_->admit(account_id, order) : GuardVerdict::Allowed;
+}
+
+template<typename T, typename Decode>
+std::future<T> ApiMethods::cached_get(const endpoints::EndpointConfig& endpoint,
+                                      const std::unordered_map<std::string, std::string>& params,
+                                      Decode decode, const RequestOptions& options) {
+    if (!cache_ || !options.use_cache || endpoint.cache_ttl_seconds <= 0) {
+        return client_->get_endpoint_then(endpoint, params, std::move(decode), options);
+    }
+    // Keyed by base URL too: a client switched to another environment must not
+    // be served the other environment's responses.
+    auto key = ResponseCache::make_key(endpoint.path, params, client_->get_base_url());
+    return cache_->get_or_load<T>(key, std::chrono::seconds(endpoint.cache_ttl_seconds), [&](auto publish) {
+        // The worker holds the cache it was issued against, so replacing the
+        // cache while the request runs cannot leave publish dangling.
+        return client_->get_endpoint_then(endpoint, params,
+            [cache = cache_, decode = std::move(decode), publish = std::move(publish)](const simdjson::dom::element& response) -> T {
+                T value = decode(response);
+                publish(value);
+                return value;
+            }, options);
+    });
 }
 
 std::string ApiMethods::get_oauth_url(const std::string& redirect_uri, const std::string& scope) const {
@@ -38,9 +161,7 @@ std::future<AccessToken> ApiMethods::create_access_token_async(const std::string
         {"redirect_uri", redirect_uri}
     };
     
-    return parse_response_async<AccessToken>(
-        client_->post_endpoint_async(endpoints::authentication::oauth_accesstoken, params)
-    );
+    return client_->post_endpoint_then(endpoints::authentication::oauth_accesstoken, params, decode<AccessToken>);
 }
 
 AccessToken ApiMethods::create_access_token(const std::string& code, const std::string& redirect_uri) {
@@ -53,9 +174,7 @@ std::future<AccessToken> ApiMethods::refresh_access_token_async(const std::strin
         {"refresh_token", refresh_token}
     };
     
-    return parse_response_async<AccessToken>(
-        client_->post_endpoint_async(endpoints::authentication::oauth_accesstoken, params)
-    );
+    return client_->post_endpoint_then(endpoints::authentication::oauth_accesstoken, params, decode<AccessToken>);
 }
 
 AccessToken ApiMethods::refresh_access_token(const std::string& refresh_token) {
@@ -63,30 +182,31 @@ AccessToken ApiMethods::refresh_access_token(const std::string& refresh_token) {
 }
 
 std::future<UserProfile> ApiMethods::get_user_profile_async() {
-    return parse_response_async<UserProfile>(
-        client_->get_endpoint_async(endpoints::user::profile)
-    );
+    return client_->get_endpoint_then(endpoints::user::profile, {}, decode<UserProfile>);
 }
 
 UserProfile ApiMethods::get_user_profile() {
     return get_user_profile_async().get();
 }
 
-std::future<AccountBalances> ApiMethods::get_account_balances_async(const std::string& account_id) {
+template<typename Wrap>
+auto ApiMethods::request_account_balances(const std::string& account_id, Wrap wrap) {
     std::string endpoint = endpoints::accounts::balances::path(account_id);
-    return parse_response_async<AccountBalances>(
-        client_->get_async(endpoint)
-    );
+    return client_->get_then(endpoint, {}, wrap(decode<AccountBalances>));
+}
+
+std::future<AccountBalances> ApiMethods::get_account_balances_async(const std::string& account_id) {
+    return request_account_balances(account_id, as_is{});
 }
 
 AccountBalances ApiMethods::get_account_balances(const std::string& account_id) {
     return get_account_balances_async(account_id).get();
 }
 
-std::future<std::vector<Position>> ApiMethods::get_account_positions_async(const std::string& account_id) {
+template<typename Wrap>
+auto ApiMethods::request_account_positions(const std::string& account_id, Wrap wrap) {
     std::string endpoint = endpoints::accounts::positions::path(account_id);
-    return std::async(std::launch::async, [this, endpoint]() {
-        auto response = client_->get_async(endpoint).get();
+    return client_->get_then(endpoint, {}, wrap([](const simdjson::dom::element& response) {
         std::vector<Position> positions;
         
         auto positions_elem = response["positions"];
@@ -105,13 +225,73 @@ std::future<std::vector<Position>> ApiMethods::get_account_positions_async(const
         }
         
         return positions;
-    });
+    }));
+}
+
+std::future<std::vector<Position>> ApiMethods::get_account_positions_async(const std::string& account_id) {
+    return request_account_positions(account_id, as_is{});
 }
 
 std::vector<Position> ApiMethods::get_account_positions(const std::string& account_id) {
     return get_account_positions_async(account_id).get();
 }
 
+std::future<AccountHistory> ApiMethods::get_account_history_async(const std::string& account_id,
+                                                                std::optional<int> page,
+                                                                std::optional<int> limit) {
+    std::unordered_map<std::string, std::string> params;
+    if (page.has_value()) {
+        params["page"] = std::to_string(page.value());
+    }
+    if (limit.has_value()) {
+        params["limit"] = std::to_string(limit.value());
+    }
+    return client_->get_then(endpoints::accounts::history::path(account_id), params, decode<AccountHistory>);
+}
+
+AccountHistory ApiMethods::get_account_history(const std::string& account_id,
+                                               std::optional<int> page,
+                                               std::optional<int> limit) {
+    return get_account_history_async(account_id, page, limit).get();
+}
+
+std::future<GainLoss> ApiMethods::get_account_gainloss_async(const std::string& account_id,
+                                                            std::optional<int> page,
+                                                            std::optional<int> limit) {
+    std::unordered_map<std::string, std::string> params;
+    if (page.has_value()) {
+        params["page"] = std::to_string(page.value());
+    }
+    if (limit.has_value()) {
+        params["limit"] = std::to_string(limit.value());
+    }
+    return client_->get_then(endpoints::accounts::gainloss::path(account_id), params, decode<GainLoss>);
+}
+
+GainLoss ApiMethods::get_account_gainloss(const std::string& account_id,
+                                          std::optional<int> page,
+                                          std::optional<int> limit) {
+    return get_account_gainloss_async(account_id, page, limit).get();
+}
+
+PagedRange<HistoryEvent> ApiMethods::history_pages(const std::string& account_id, int page_size, int prefetch) {
+    return PagedRange<HistoryEvent>(
+        [client = client_, path = endpoints::accounts::history::path(account_id), page_size](int page) {
+            return client->get_then(path, {{"page", std::to_string(page)}, {"limit", std::to_string(page_size)}},
+                                    HistoryEvent::list_from_json);
+        },
+        page_size, prefetch);
+}
+
+PagedRange<ClosedPosition> ApiMethods::gainloss_pages(const std::string& account_id, int page_size, int prefetch) {
+    return PagedRange<ClosedPosition>(
+        [client = client_, path = endpoints::accounts::gainloss::path(account_id), page_size](int page) {
+            return client->get_then(path, {{"page", std::to_string(page)}, {"limit", std::to_string(page_size)}},
+                                    ClosedPosition::list_from_json);
+        },
+        page_size, prefetch);
+}
+
 std::future<std::vector<Quote>> ApiMethods::get_quotes_async(const std::vector<std::string>& symbols, bool include_greeks) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
@@ -121,8 +301,7 @@ std::future<std::vector<Quote>> ApiMethods::get_quotes_async(const std::vector<s
         params["greeks"] = "true";
     }
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::markets::quotes, params).get();
+    return client_->get_endpoint_then(endpoints::markets::quotes, params, [](const simdjson::dom::element& response) {
         std::vector<Quote> quotes;
         
         auto quotes_elem = response["quotes"];
@@ -158,9 +337,7 @@ std::future<OptionChain> ApiMethods::get_option_chain_async(const std::string& s
         params["greeks"] = "true";
     }
     
-    return parse_response_async<OptionChain>(
-        client_->get_endpoint_async(endpoints::markets::options::chains, params)
-    );
+    return client_->get_endpoint_then(endpoints::markets::options::chains, params, decode<OptionChain>);
 }
 
 OptionChain ApiMethods::get_option_chain(const std::string& symbol, const std::string& expiration, bool include_greeks) {
@@ -179,8 +356,7 @@ std::future<std::vector<std::string>> ApiMethods::get_option_expirations_async(c
         params["strikes"] = "true";
     }
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::markets::options::expirations, params).get();
+    return cached_get<std::vector<std::string>>(endpoints::markets::options::expirations, params, [](const simdjson::dom::element& response) {
         std::vector<std::string> expirations;
         
         auto expirations_elem = response["expirations"];
@@ -216,86 +392,185 @@ std::vector<std::string> ApiMethods::get_option_expirations(const std::string& s
     return get_option_expirations_async(symbol, include_all_roots, include_strikes).get();
 }
 
-std::future<OrderResponse> ApiMethods::place_equity_order_async(const std::string& account_id, const EquityOrderRequest& order) {
+std::future<std::vector<double>> ApiMethods::get_option_strikes_async(const std::string& symbol, const std::string& expiration) {
+    std::unordered_map<std::string, std::string> params = {
+        {"symbol", symbol},
+        {"expiration", expiration}
+    };
+    
+    return cached_get<std::vector<double>>(endpoints::markets::options::strikes, params, [](const simdjson::dom::element& response) {
+        std::vector<double> strikes;
+        
+        auto strikes_elem = response["strikes"];
+        if (strikes_elem.is_object()) {
+            auto strike_result = strikes_elem["strike"];
+            if (strike_result.error() == simdjson::SUCCESS) {
+                auto strike_value = strike_result.value();
+                if (strike_value.is_array()) {
+                    simdjson::dom::array strike_array = strike_value.get_array().value_unsafe();
+                    strikes.reserve(strike_array.size());
+                    for (auto strike : strike_array) {
+                        strikes.push_back(strike.get_double().value_unsafe());
+                    }
+                } else if (strike_value.is_number()) {
+                    strikes.push_back(strike_value.get_double().value_unsafe());
+                }
+            }
+        }
+        
+        return strikes;
+    });
+}
+
+std::vector<double> ApiMethods::get_option_strikes(const std::string& symbol, const std::string& expiration) {
+    return get_option_strikes_async(symbol, expiration).get();
+}
+
+template<typename Wrap>
+auto ApiMethods::submit_equity_order(const std::string& account_id, const EquityOrderRequest& order, Wrap wrap) {
+    using Result = std::invoke_result_t<decltype(wrap(decode<OrderResponse>))&, const simdjson::dom::element&>;
+    if (!prices_representable(order)) {
+        return invalid_price<Result>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order<Result>(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params = {
-        {"class", to_string(order.order_class)},
+        {"class", std::string(to_string(order.order_class))},
         {"symbol", order.symbol},
-        {"side", to_string(order.side)},
+        {"side", std::string(to_string(order.side))},
         {"quantity", std::to_string(order.quantity)},
-        {"type", to_string(order.type)},
-        {"duration", to_string(order.duration)}
+        {"type", std::string(to_string(order.type))},
+        {"duration", std::string(to_string(order.duration))}
     };
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     if (order.stop.has_value()) {
-        params["stop"] = std::to_string(order.stop.value());
+        params["stop"] = price_param(order.stop.value());
     }
     if (order.tag.has_value()) {
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, wrap(decode<OrderResponse>));
+}
+
+std::future<OrderResponse> ApiMethods::place_equity_order_async(const std::string& account_id, const EquityOrderRequest& order) {
+    return submit_equity_order(account_id, order, as_is{});
 }
 
 OrderResponse ApiMethods::place_equity_order(const std::string& account_id, const EquityOrderRequest& order) {
     return place_equity_order_async(account_id, order).get();
 }
 
-std::future<OrderResponse> ApiMethods::place_option_order_async(const std::string& account_id, const OptionOrderRequest& order) {
+template<typename Wrap>
+auto ApiMethods::submit_option_order(const std::string& account_id, const OptionOrderRequest& order, Wrap wrap) {
+    using Result = std::invoke_result_t<decltype(wrap(decode<OrderResponse>))&, const simdjson::dom::element&>;
+    if (!prices_representable(order)) {
+        return invalid_price<Result>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order<Result>(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params = {
-        {"class", to_string(order.order_class)},
+        {"class", std::string(to_string(order.order_class))},
         {"option_symbol", order.option_symbol},
-        {"side", to_string(order.side)},
+        {"side", std::string(to_string(order.side))},
         {"quantity", std::to_string(order.quantity)},
-        {"type", to_string(order.type)},
-        {"duration", to_string(order.duration)}
+        {"type", std::string(to_string(order.type))},
+        {"duration", std::string(to_string(order.duration))}
     };
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     if (order.stop.has_value()) {
-        params["stop"] = std::to_string(order.stop.value());
+        params["stop"] = price_param(order.stop.value());
     }
     if (order.tag.has_value()) {
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, wrap(decode<OrderResponse>));
+}
+
+std::future<OrderResponse> ApiMethods::place_option_order_async(const std::string& account_id, const OptionOrderRequest& order) {
+    return submit_option_order(account_id, order, as_is{});
 }
 
 OrderResponse ApiMethods::place_option_order(const std::string& account_id, const OptionOrderRequest& order) {
     return place_option_order_async(account_id, order).get();
 }
 
-std::future<OrderResponse> ApiMethods::cancel_order_async(const std::string& account_id, const std::string& order_id) {
+template<typename Wrap>
+auto ApiMethods::request_order_cancel(const std::string& account_id, const std::string& order_id, Wrap wrap) {
     std::string endpoint = "/v1/accounts/" + account_id + "/orders/" + order_id;
-    return parse_response_async<OrderResponse>(
-        client_->delete_async(endpoint)
-    );
+    return client_->delete_then(endpoint, {}, wrap(decode<OrderResponse>));
+}
+
+std::future<OrderResponse> ApiMethods::cancel_order_async(const std::string& account_id, const std::string& order_id) {
+    return request_order_cancel(account_id, order_id, as_is{});
 }
 
 OrderResponse ApiMethods::cancel_order(const std::string& account_id, const std::string& order_id) {
     return cancel_order_async(account_id, order_id).get();
 }
 
+OrderBatchResult ApiMethods::place_orders_batch(const std::string& account_id, std::span<const EquityOrderRequest> orders,
+                                                const OrderBatchOptions& options) {
+    auto budget = trading_budget(*client_, options);
+    return dispatch_order_batch(orders.size(), options, budget, [&](std::size_t i) {
+        return submit_equity_order(account_id, orders[i], stamped{});
+    });
+}
+
+OrderBatchResult ApiMethods::place_orders_batch(const std::string& account_id, std::span<const OptionOrderRequest> orders,
+                                                const OrderBatchOptions& options) {
+    auto budget = trading_budget(*client_, options);
+    return dispatch_order_batch(orders.size(), options, budget, [&](std::size_t i) {
+        return submit_option_order(account_id, orders[i], stamped{});
+    });
+}
+
+OrderBatchResult ApiMethods::cancel_orders_batch(const std::string& account_id, std::span<const std::string> order_ids,
+                                                 const OrderBatchOptions& options) {
+    std::vector<OrderBatchItem> items(order_ids.size());
+    for (std::size_t i = 0; i < order_ids.size(); ++i) {
+        items[i].order_id = order_ids[i];
+    }
+    auto budget = trading_budget(*client_, options);
+    return dispatch_order_batch(order_ids.size(), options, budget, [&](std::size_t i) {
+        return request_order_cancel(account_id, order_ids[i], stamped{});
+    }, std::move(items));
+}
+
+OrderBatchResult ApiMethods::cancel_all(const std::string& account_id,
+                                        const std::function<bool(const Order&)>& filter,
+                                        const OrderBatchOptions& options) {
+    auto orders = get_account_orders(account_id);
+    auto ids = working_order_ids(orders, filter);
+    return cancel_orders_batch(account_id, ids, options);
+}
+
 std::future<OrderResponse> ApiMethods::place_multileg_order_async(const std::string& account_id, const MultilegOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params = {
         {"class", "multileg"},
-        {"type", to_string(order.type)},
-        {"duration", to_string(order.duration)}
+        {"type", std::string(to_string(order.type))},
+        {"duration", std::string(to_string(order.duration))}
     };
     
     for (size_t i = 0; i < order.legs.size(); ++i) {
@@ -306,15 +581,13 @@ std::future<OrderResponse> ApiMethods::place_multileg_order_async(const std::str
     }
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     if (order.tag.has_value()) {
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_multileg_order(const std::string& account_id, const MultilegOrderRequest& order) {
@@ -322,12 +595,18 @@ OrderResponse ApiMethods::place_multileg_order(const std::string& account_id, co
 }
 
 std::future<OrderResponse> ApiMethods::place_combo_order_async(const std::string& account_id, const ComboOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params = {
         {"class", "combo"},
-        {"type", to_string(order.type)},
-        {"duration", to_string(order.duration)}
+        {"type", std::string(to_string(order.type))},
+        {"duration", std::string(to_string(order.duration))}
     };
     
     for (size_t i = 0; i < order.legs.size(); ++i) {
@@ -338,22 +617,75 @@ std::future<OrderResponse> ApiMethods::place_combo_order_async(const std::string
     }
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     if (order.tag.has_value()) {
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_combo_order(const std::string& account_id, const ComboOrderRequest& order) {
     return place_combo_order_async(account_id, order).get();
 }
 
+// A Price survives the trip through the request's double exactly: ticks /
+// 10^4 and back rounds to the same tick far below 2^52 ticks.
+std::future<OrderResponse> ApiMethods::place_equity_order_async(const std::string& account_id, const EquityOrderRequest& order,
+                                                                Price price, std::optional<Price> stop) {
+    EquityOrderRequest priced = order;
+    priced.price = price.to_double();
+    if (stop.has_value()) {
+        priced.stop = stop->to_double();
+    }
+    return place_equity_order_async(account_id, priced);
+}
+
+OrderResponse ApiMethods::place_equity_order(const std::string& account_id, const EquityOrderRequest& order,
+                                             Price price, std::optional<Price> stop) {
+    return place_equity_order_async(account_id, order, price, stop).get();
+}
+
+std::future<OrderResponse> ApiMethods::place_option_order_async(const std::string& account_id, const OptionOrderRequest& order,
+                                                                Price price, std::optional<Price> stop) {
+    OptionOrderRequest priced = order;
+    priced.price = price.to_double();
+    if (stop.has_value()) {
+        priced.stop = stop->to_double();
+    }
+    return place_option_order_async(account_id, priced);
+}
+
+OrderResponse ApiMethods::place_option_order(const std::string& account_id, const OptionOrderRequest& order,
+                                             Price price, std::optional<Price> stop) {
+    return place_option_order_async(account_id, order, price, stop).get();
+}
+
+std::future<OrderResponse> ApiMethods::place_multileg_order_async(const std::string& account_id, const MultilegOrderRequest& order, Price price) {
+    MultilegOrderRequest priced = order;
+    priced.price = price.to_double();
+    return place_multileg_order_async(account_id, priced);
+}
+
+OrderResponse ApiMethods::place_multileg_order(const std::string& account_id, const MultilegOrderRequest& order, Price price) {
+    return place_multileg_order_async(account_id, order, price).get();
+}
+
+std::future<OrderResponse> ApiMethods::place_combo_order_async(const std::string& account_id, const ComboOrderRequest& order, Price price) {
+    ComboOrderRequest priced = order;
+    priced.price = price.to_double();
+    return place_combo_order_async(account_id, priced);
+}
+
+OrderResponse ApiMethods::place_combo_order(const std::string& account_id, const ComboOrderRequest& order, Price price) {
+    return place_combo_order_async(account_id, order, price).get();
+}
+
 std::future<OrderResponse> ApiMethods::modify_order_async(const std::string& account_id, const std::string& order_id, const OrderModification& modification) {
+    if (!prices_representable(modification)) {
+        return invalid_price<OrderResponse>();
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders/" + order_id;
     
     std::unordered_map<std::string, std::string> params;
@@ -365,18 +697,16 @@ std::future<OrderResponse> ApiMethods::modify_order_async(const std::string& acc
         params["duration"] = to_string(modification.duration.value());
     }
     if (modification.price.has_value()) {
-        params["price"] = std::to_string(modification.price.value());
+        params["price"] = price_param(modification.price.value());
     }
     if (modification.stop.has_value()) {
-        params["stop"] = std::to_string(modification.stop.value());
+        params["stop"] = price_param(modification.stop.value());
     }
     if (modification.quantity.has_value()) {
         params["quantity"] = std::to_string(modification.quantity.value());
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->put_async(endpoint, params)
-    );
+    return client_->put_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::modify_order(const std::string& account_id, const std::string& order_id, const OrderModification& modification) {
@@ -384,6 +714,12 @@ OrderResponse ApiMethods::modify_order(const std::string& account_id, const std:
 }
 
 std::future<OrderResponse> ApiMethods::place_oto_order_async(const std::string& account_id, const OTOOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params;
@@ -397,10 +733,10 @@ std::future<OrderResponse> ApiMethods::place_oto_order_async(const std::string&
     params["duration[0]"] = to_string(order.first_order.duration);
     
     if (order.first_order.price.has_value()) {
-        params["price[0]"] = std::to_string(order.first_order.price.value());
+        params["price[0]"] = price_param(order.first_order.price.value());
     }
     if (order.first_order.stop.has_value()) {
-        params["stop[0]"] = std::to_string(order.first_order.stop.value());
+        params["stop[0]"] = price_param(order.first_order.stop.value());
     }
     if (order.first_order.option_symbol.has_value()) {
         params["option_symbol[0]"] = order.first_order.option_symbol.value();
@@ -414,10 +750,10 @@ std::future<OrderResponse> ApiMethods::place_oto_order_async(const std::string&
     params["duration[1]"] = to_string(order.second_order.duration);
     
     if (order.second_order.price.has_value()) {
-        params["price[1]"] = std::to_string(order.second_order.price.value());
+        params["price[1]"] = price_param(order.second_order.price.value());
     }
     if (order.second_order.stop.has_value()) {
-        params["stop[1]"] = std::to_string(order.second_order.stop.value());
+        params["stop[1]"] = price_param(order.second_order.stop.value());
     }
     if (order.second_order.option_symbol.has_value()) {
         params["option_symbol[1]"] = order.second_order.option_symbol.value();
@@ -427,9 +763,7 @@ std::future<OrderResponse> ApiMethods::place_oto_order_async(const std::string&
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_oto_order(const std::string& account_id, const OTOOrderRequest& order) {
@@ -437,6 +771,12 @@ OrderResponse ApiMethods::place_oto_order(const std::string& account_id, const O
 }
 
 std::future<OrderResponse> ApiMethods::place_oco_order_async(const std::string& account_id, const OCOOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params;
@@ -450,10 +790,10 @@ std::future<OrderResponse> ApiMethods::place_oco_order_async(const std::string&
     params["duration[0]"] = to_string(order.first_order.duration);
     
     if (order.first_order.price.has_value()) {
-        params["price[0]"] = std::to_string(order.first_order.price.value());
+        params["price[0]"] = price_param(order.first_order.price.value());
     }
     if (order.first_order.stop.has_value()) {
-        params["stop[0]"] = std::to_string(order.first_order.stop.value());
+        params["stop[0]"] = price_param(order.first_order.stop.value());
     }
     if (order.first_order.option_symbol.has_value()) {
         params["option_symbol[0]"] = order.first_order.option_symbol.value();
@@ -467,10 +807,10 @@ std::future<OrderResponse> ApiMethods::place_oco_order_async(const std::string&
     params["duration[1]"] = to_string(order.second_order.duration);
     
     if (order.second_order.price.has_value()) {
-        params["price[1]"] = std::to_string(order.second_order.price.value());
+        params["price[1]"] = price_param(order.second_order.price.value());
     }
     if (order.second_order.stop.has_value()) {
-        params["stop[1]"] = std::to_string(order.second_order.stop.value());
+        params["stop[1]"] = price_param(order.second_order.stop.value());
     }
     if (order.second_order.option_symbol.has_value()) {
         params["option_symbol[1]"] = order.second_order.option_symbol.value();
@@ -480,9 +820,7 @@ std::future<OrderResponse> ApiMethods::place_oco_order_async(const std::string&
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_oco_order(const std::string& account_id, const OCOOrderRequest& order) {
@@ -490,6 +828,12 @@ OrderResponse ApiMethods::place_oco_order(const std::string& account_id, const O
 }
 
 std::future<OrderResponse> ApiMethods::place_otoco_order_async(const std::string& account_id, const OTOCOOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params;
@@ -503,10 +847,10 @@ std::future<OrderResponse> ApiMethods::place_otoco_order_async(const std::string
     params["duration[0]"] = to_string(order.primary_order.duration);
     
     if (order.primary_order.price.has_value()) {
-        params["price[0]"] = std::to_string(order.primary_order.price.value());
+        params["price[0]"] = price_param(order.primary_order.price.value());
     }
     if (order.primary_order.stop.has_value()) {
-        params["stop[0]"] = std::to_string(order.primary_order.stop.value());
+        params["stop[0]"] = price_param(order.primary_order.stop.value());
     }
     if (order.primary_order.option_symbol.has_value()) {
         params["option_symbol[0]"] = order.primary_order.option_symbol.value();
@@ -520,10 +864,10 @@ std::future<OrderResponse> ApiMethods::place_otoco_order_async(const std::string
     params["duration[1]"] = to_string(order.profit_order.duration);
     
     if (order.profit_order.price.has_value()) {
-        params["price[1]"] = std::to_string(order.profit_order.price.value());
+        params["price[1]"] = price_param(order.profit_order.price.value());
     }
     if (order.profit_order.stop.has_value()) {
-        params["stop[1]"] = std::to_string(order.profit_order.stop.value());
+        params["stop[1]"] = price_param(order.profit_order.stop.value());
     }
     if (order.profit_order.option_symbol.has_value()) {
         params["option_symbol[1]"] = order.profit_order.option_symbol.value();
@@ -537,10 +881,10 @@ std::future<OrderResponse> ApiMethods::place_otoco_order_async(const std::string
     params["duration[2]"] = to_string(order.stop_order.duration);
     
     if (order.stop_order.price.has_value()) {
-        params["price[2]"] = std::to_string(order.stop_order.price.value());
+        params["price[2]"] = price_param(order.stop_order.price.value());
     }
     if (order.stop_order.stop.has_value()) {
-        params["stop[2]"] = std::to_string(order.stop_order.stop.value());
+        params["stop[2]"] = price_param(order.stop_order.stop.value());
     }
     if (order.stop_order.option_symbol.has_value()) {
         params["option_symbol[2]"] = order.stop_order.option_symbol.value();
@@ -550,9 +894,7 @@ std::future<OrderResponse> ApiMethods::place_otoco_order_async(const std::string
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_otoco_order(const std::string& account_id, const OTOCOOrderRequest& order) {
@@ -560,6 +902,12 @@ OrderResponse ApiMethods::place_otoco_order(const std::string& account_id, const
 }
 
 std::future<OrderResponse> ApiMethods::place_spread_order_async(const std::string& account_id, const SpreadOrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderResponse>();
+    }
+    if (auto verdict = screen(account_id, order); verdict != GuardVerdict::Allowed) {
+        return rejected_order(verdict);
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params;
@@ -568,7 +916,7 @@ std::future<OrderResponse> ApiMethods::place_spread_order_async(const std::strin
     params["duration"] = to_string(order.duration);
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     
     // Add spread-specific metadata
@@ -591,9 +939,7 @@ std::future<OrderResponse> ApiMethods::place_spread_order_async(const std::strin
         params["tag"] = order.tag.value();
     }
     
-    return parse_response_async<OrderResponse>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderResponse>);
 }
 
 OrderResponse ApiMethods::place_spread_order(const std::string& account_id, const SpreadOrderRequest& order) {
@@ -601,15 +947,51 @@ OrderResponse ApiMethods::place_spread_order(const std::string& account_id, cons
 }
 
 std::future<MarketClock> ApiMethods::get_market_clock_async() {
-    return parse_response_async<MarketClock>(
-        client_->get_endpoint_async(endpoints::markets::clock)
-    );
+    return cached_get<MarketClock>(endpoints::markets::clock, {}, decode<MarketClock>);
 }
 
 MarketClock ApiMethods::get_market_clock() {
     return get_market_clock_async().get();
 }
 
+std::future<std::vector<MarketDay>> ApiMethods::get_market_calendar_async(std::optional<int> month, std::optional<int> year) {
+    std::unordered_map<std::string, std::string> params;
+    if (month) {
+        params["month"] = std::to_string(*month);
+    }
+    if (year) {
+        params["year"] = std::to_string(*year);
+    }
+    
+    return cached_get<std::vector<MarketDay>>(endpoints::markets::calendar, params, [](const simdjson::dom::element& response) {
+        std::vector<MarketDay> days;
+        
+        auto calendar_elem = response["calendar"];
+        if (calendar_elem.is_object()) {
+            auto days_elem = calendar_elem["days"];
+            if (days_elem.is_object()) {
+                auto day_result = days_elem["day"];
+                if (day_result.error() == simdjson::SUCCESS) {
+                    auto day_value = day_result.value();
+                    if (day_value.is_array()) {
+                        for (const auto& day : day_value.get_array()) {
+                            days.push_back(MarketDay::from_json(day));
+                        }
+                    } else if (day_value.is_object()) {
+                        days.push_back(MarketDay::from_json(day_value));
+                    }
+                }
+            }
+        }
+        
+        return days;
+    });
+}
+
+std::vector<MarketDay> ApiMethods::get_market_calendar(std::optional<int> month, std::optional<int> year) {
+    return get_market_calendar_async(month, year).get();
+}
+
 std::future<std::vector<CompanySearch>> ApiMethods::search_companies_async(const std::string& query, bool include_indexes) {
     std::unordered_map<std::string, std::string> params = {
         {"q", query}
@@ -619,8 +1001,7 @@ std::future<std::vector<CompanySearch>> ApiMethods::search_companies_async(const
         params["indexes"] = "true";
     }
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::markets::search, params).get();
+    return client_->get_endpoint_then(endpoints::markets::search, params, [](const simdjson::dom::element& response) {
         std::vector<CompanySearch> results;
         
         auto securities_elem = response["securities"];
@@ -646,13 +1027,13 @@ std::vector<CompanySearch> ApiMethods::search_companies(const std::string& query
     return search_companies_async(query, include_indexes).get();
 }
 
-std::future<std::vector<CompanyInfo>> ApiMethods::get_company_info_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<CompanyInfo>> ApiMethods::get_company_info_async(const std::vector<std::string>& symbols,
+                                                                         const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_async("/beta/markets/fundamentals/company", params).get();
+    return cached_get<std::vector<CompanyInfo>>(endpoints::beta::fundamentals::company, params, [](const simdjson::dom::element& response) {
         std::vector<CompanyInfo> results;
         
         // Placeholder implementation for beta endpoints
@@ -665,20 +1046,20 @@ std::future<std::vector<CompanyInfo>> ApiMethods::get_company_info_async(const s
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<CompanyInfo> ApiMethods::get_company_info(const std::vector<std::string>& symbols) {
     return get_company_info_async(symbols).get();
 }
 
-std::future<std::vector<FinancialRatios>> ApiMethods::get_financial_ratios_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<FinancialRatios>> ApiMethods::get_financial_ratios_async(const std::vector<std::string>& symbols,
+                                                                                 const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_async("/beta/markets/fundamentals/ratios", params).get();
+    return cached_get<std::vector<FinancialRatios>>(endpoints::beta::fundamentals::ratios, params, [](const simdjson::dom::element& response) {
         std::vector<FinancialRatios> results;
         
         // Placeholder implementation for beta endpoints
@@ -690,7 +1071,7 @@ std::future<std::vector<FinancialRatios>> ApiMethods::get_financial_ratios_async
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<FinancialRatios> ApiMethods::get_financial_ratios(const std::vector<std::string>& symbols) {
@@ -706,14 +1087,6 @@ std::string ApiMethods::join_symbols(const std::vector<std::string>& symbols) co
     return result;
 }
 
-template<typename T>
-std::future<T> ApiMethods::parse_response_async(std::future<simdjson::dom::element> response_future) {
-    return std::async(std::launch::async, [response_future = std::move(response_future)]() mutable {
-        auto response = response_future.get();
-        return T::from_json(response);
-    });
-}
-
 template<typename T>
 T ApiMethods::parse_response(const simdjson::dom::element& response) {
     return T::from_json(response);
@@ -727,7 +1100,8 @@ std::vector<Order> ApiMethods::get_account_orders(const std::string& account_id,
     return get_account_orders_async(account_id, include_tags).get();
 }
 
-std::future<std::vector<Order>> ApiMethods::get_account_orders_async(const std::string& account_id, bool include_tags) {
+template<typename Wrap>
+auto ApiMethods::request_account_orders(const std::string& account_id, bool include_tags, Wrap wrap) {
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params;
@@ -735,8 +1109,7 @@ std::future<std::vector<Order>> ApiMethods::get_account_orders_async(const std::
         params["includeTags"] = "true";
     }
     
-    return std::async(std::launch::async, [this, endpoint, params]() {
-        auto response = client_->get_async(endpoint, params).get();
+    return client_->get_then(endpoint, params, wrap([](const simdjson::dom::element& response) {
         std::vector<Order> orders;
         
         auto orders_elem = response["orders"];
@@ -759,7 +1132,30 @@ std::future<std::vector<Order>> ApiMethods::get_account_orders_async(const std::
         }
         
         return orders;
-    });
+    }));
+}
+
+std::future<std::vector<Order>> ApiMethods::get_account_orders_async(const std::string& account_id, bool include_tags) {
+    return request_account_orders(account_id, include_tags, as_is{});
+}
+
+AccountsSnapshot ApiMethods::snapshot_accounts(std::span<const std::string> account_ids,
+                                               const AccountSnapshotOptions& options) {
+    std::optional<int> available;
+    RequestWindowBudget::clock::time_point window_end{};
+    if (auto limit = client_->get_rate_limit(EndpointGroup::Accounts)) {
+        available = limit->available;
+        window_end = limit->expiry;
+    }
+    RequestWindowBudget budget(options.requests_per_window, options.window, available, window_end);
+    
+    return gather_account_snapshots(
+        account_ids, options, budget,
+        [this](const std::string& account_id) { return request_account_balances(account_id, stamped{}); },
+        [this](const std::string& account_id) { return request_account_positions(account_id, stamped{}); },
+        [this, &options](const std::string& account_id) {
+            return request_account_orders(account_id, options.include_tags, stamped{});
+        });
 }
 
 OrderPreview ApiMethods::preview_order(const std::string& account_id, const OrderRequest& order) {
@@ -767,28 +1163,29 @@ OrderPreview ApiMethods::preview_order(const std::string& account_id, const Orde
 }
 
 std::future<OrderPreview> ApiMethods::preview_order_async(const std::string& account_id, const OrderRequest& order) {
+    if (!prices_representable(order)) {
+        return invalid_price<OrderPreview>();
+    }
     std::string endpoint = "/v1/accounts/" + account_id + "/orders";
     
     std::unordered_map<std::string, std::string> params = {
         {"preview", "true"},
-        {"class", to_string(order.order_class)},
+        {"class", std::string(to_string(order.order_class))},
         {"symbol", order.symbol},
-        {"side", to_string(order.side)},
+        {"side", std::string(to_string(order.side))},
         {"quantity", std::to_string(order.quantity)},
-        {"type", to_string(order.type)},
-        {"duration", to_string(order.duration)}
+        {"type", std::string(to_string(order.type))},
+        {"duration", std::string(to_string(order.duration))}
     };
     
     if (order.price.has_value()) {
-        params["price"] = std::to_string(order.price.value());
+        params["price"] = price_param(order.price.value());
     }
     if (order.stop.has_value()) {
-        params["stop"] = std::to_string(order.stop.value());
+        params["stop"] = price_param(order.stop.value());
     }
     
-    return parse_response_async<OrderPreview>(
-        client_->post_async(endpoint, params)
-    );
+    return client_->post_then(endpoint, params, decode<OrderPreview>);
 }
 
 std::vector<HistoricalData> ApiMethods::get_historical_data(const std::string& symbol, 
@@ -814,8 +1211,7 @@ std::future<std::vector<HistoricalData>> ApiMethods::get_historical_data_async(c
         params["end"] = end.value();
     }
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::markets::history, params).get();
+    return client_->get_endpoint_then(endpoints::markets::history, params, [](const simdjson::dom::element& response) {
         std::vector<HistoricalData> data;
         
         auto history_elem = response["history"];
@@ -841,17 +1237,166 @@ std::future<std::vector<HistoricalData>> ApiMethods::get_historical_data_async(c
     });
 }
 
+std::future<std::size_t> ApiMethods::stream_historical_data_async(const std::string& symbol,
+                                                                 std::function<void(const HistoricalData&)> on_bar,
+                                                                 const std::string& interval,
+                                                                 std::optional<std::string> start,
+                                                                 std::optional<std::string> end) {
+    std::unordered_map<std::string, std::string> params = {
+        {"symbol", symbol},
+        {"interval", interval}
+    };
+    
+    if (start.has_value()) {
+        params["start"] = start.value();
+    }
+    if (end.has_value()) {
+        params["end"] = end.value();
+    }
+    
+    return client_->get_streamed_async(std::string(endpoints::markets::history.path), params, {"history", "day"},
+        [on_bar = std::move(on_bar)](const simdjson::dom::element& day) {
+            on_bar(HistoricalData::from_json(day));
+        });
+}
+
+std::future<std::size_t> ApiMethods::stream_time_and_sales_async(const std::string& symbol,
+                                                                std::function<void(const TimeSales&)> on_tick,
+                                                                const std::string& interval,
+                                                                std::optional<std::string> start,
+                                                                std::optional<std::string> end) {
+    std::unordered_map<std::string, std::string> params = {
+        {"symbol", symbol},
+        {"interval", interval}
+    };
+    
+    if (start.has_value()) {
+        params["start"] = start.value();
+    }
+    if (end.has_value()) {
+        params["end"] = end.value();
+    }
+    
+    return client_->get_streamed_async(std::string(endpoints::markets::timesales.path), params, {"series", "data"},
+        [on_tick = std::move(on_tick)](const simdjson::dom::element& tick) {
+            on_tick(TimeSales::from_json(tick));
+        });
+}
+
+std::vector<TimeSales> ApiMethods::get_time_and_sales(const std::string& symbol,
+                                                      const std::string& interval,
+                                                      std::optional<std::string> start,
+                                                      std::optional<std::string> end) {
+    return get_time_and_sales_async(symbol, interval, start, end).get();
+}
+
+std::future<std::vector<TimeSales>> ApiMethods::get_time_and_sales_async(const std::string& symbol,
+                                                                         const std::string& interval,
+                                                                         std::optional<std::string> start,
+                                                                         std::optional<std::string> end) {
+    std::unordered_map<std::string, std::string> params = {
+        {"symbol", symbol},
+        {"interval", interval}
+    };
+    
+    if (start.has_value()) {
+        params["start"] = start.value();
+    }
+    if (end.has_value()) {
+        params["end"] = end.value();
+    }
+    
+    // Records keep Tradier's own exchange-local "time" strings; the columnar
+    // series only holds UTC timestamps, so it is not a round trip for them.
+    return client_->get_endpoint_then(endpoints::markets::timesales, params, [](const simdjson::dom::element& response) {
+        std::vector<TimeSales> data;
+
+        auto series_elem = response["series"];
+        if (series_elem.is_object()) {
+            auto data_result = series_elem["data"];
+            if (data_result.error() == simdjson::SUCCESS) {
+                auto data_elem = data_result.value();
+                if (data_elem.is_array()) {
+                    for (const auto& row : data_elem.get_array()) {
+                        data.push_back(TimeSales::from_json(row));
+                    }
+                } else {
+                    data.push_back(TimeSales::from_json(data_elem));
+                }
+            }
+        }
+
+        return data;
+    });
+}
+
+TimeSalesSeries ApiMethods::get_time_and_sales_series(const std::string& symbol,
+                                                      const std::string& interval,
+                                                      std::optional<std::string> start,
+                                                      std::optional<std::string> end) {
+    return get_time_and_sales_series_async(symbol, interval, start, end).get();
+}
+
+std::future<TimeSalesSeries> ApiMethods::get_time_and_sales_series_async(const std::string& symbol,
+                                                                         const std::string& interval,
+                                                                         std::optional<std::string> start,
+                                                                         std::optional<std::string> end) {
+    std::unordered_map<std::string, std::string> params = {
+        {"symbol", symbol},
+        {"interval", interval}
+    };
+    
+    if (start.has_value()) {
+        params["start"] = start.value();
+    }
+    if (end.has_value()) {
+        params["end"] = end.value();
+    }
+    
+    return client_->get_endpoint_then(endpoints::markets::timesales, params, [](const simdjson::dom::element& response) {
+        return TimeSalesSeries::from_json(response);
+    });
+}
+
 std::vector<SymbolLookup> ApiMethods::lookup_symbols(const std::string& query, const std::vector<std::string>& types) {
     return lookup_symbols_async(query, types).get();
 }
 
+std::future<std::vector<std::string>> ApiMethods::get_etb_list_async() {
+    return cached_get<std::vector<std::string>>(endpoints::markets::etb, {}, [](const simdjson::dom::element& response) {
+        std::vector<std::string> symbols;
+        
+        auto securities_elem = response["securities"];
+        if (securities_elem.is_object()) {
+            auto security_result = securities_elem["security"];
+            if (security_result.error() == simdjson::SUCCESS) {
+                auto security_value = security_result.value();
+                if (security_value.is_array()) {
+                    simdjson::dom::array security_array = security_value.get_array().value_unsafe();
+                    symbols.reserve(security_array.size());
+                    for (auto security : security_array) {
+                        symbols.emplace_back(security["symbol"].get_string().value_unsafe());
+                    }
+                } else if (security_value.is_object()) {
+                    symbols.emplace_back(security_value["symbol"].get_string().value_unsafe());
+                }
+            }
+        }
+        
+        return symbols;
+    });
+}
+
+std::vector<std::string> ApiMethods::get_etb_list() {
+    return get_etb_list_async().get();
+}
+
 std::vector<Watchlist> ApiMethods::get_all_watchlists() {
     return get_all_watchlists_async().get();
 }
 
 std::future<std::vector<Watchlist>> ApiMethods::get_all_watchlists_async() {
-    return std::async(std::launch::async, [this]() {
-        auto response = client_->get_async("/v1/watchlists").get();
+    return client_->get_then("/v1/watchlists", {}, [](const simdjson::dom::element& response) {
         std::vector<Watchlist> watchlists;
         
         auto watchlists_elem = response["watchlists"];
@@ -886,9 +1431,7 @@ std::future<Watchlist> ApiMethods::create_watchlist_async(const std::string& nam
         params["symbols"] = join_symbols(symbols);
     }
     
-    return parse_response_async<Watchlist>(
-        client_->post_async("/v1/watchlists", params)
-    );
+    return client_->post_then("/v1/watchlists", params, decode<Watchlist>);
 }
 
 WatchlistDetail ApiMethods::add_symbols_to_watchlist(const std::string& watchlist_id, const std::vector<std::string>& symbols) {
@@ -900,9 +1443,7 @@ std::future<WatchlistDetail> ApiMethods::add_symbols_to_watchlist_async(const st
         {"symbols", join_symbols(symbols)}
     };
     
-    return parse_response_async<WatchlistDetail>(
-        client_->post_async("/v1/watchlists/" + watchlist_id + "/symbols", params)
-    );
+    return client_->post_then("/v1/watchlists/" + watchlist_id + "/symbols", params, decode<WatchlistDetail>);
 }
 
 void ApiMethods::delete_watchlist(const std::string& watchlist_id) {
@@ -910,9 +1451,7 @@ void ApiMethods::delete_watchlist(const std::string& watchlist_id) {
 }
 
 std::future<void> ApiMethods::delete_watchlist_async(const std::string& watchlist_id) {
-    return std::async(std::launch::async, [this, watchlist_id]() {
-        client_->delete_async("/v1/watchlists/" + watchlist_id).get();
-    });
+    return client_->delete_then("/v1/watchlists/" + watchlist_id, {}, [](const simdjson::dom::element&) {});
 }
 
 std::future<std::vector<SymbolLookup>> ApiMethods::lookup_symbols_async(const std::string& query, const std::vector<std::string>& types) {
@@ -924,8 +1463,7 @@ std::future<std::vector<SymbolLookup>> ApiMethods::lookup_symbols_async(const st
         params["types"] = join_symbols(types);
     }
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::markets::lookup, params).get();
+    return cached_get<std::vector<SymbolLookup>>(endpoints::markets::lookup, params, [](const simdjson::dom::element& response) {
         std::vector<SymbolLookup> results;
         
         // Similar to company search implementation
@@ -948,13 +1486,13 @@ std::future<std::vector<SymbolLookup>> ApiMethods::lookup_symbols_async(const st
     });
 }
 
-std::future<std::vector<CorporateActions>> ApiMethods::get_corporate_actions_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<CorporateActions>> ApiMethods::get_corporate_actions_async(const std::vector<std::string>& symbols,
+                                                                                   const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::beta::fundamentals::corporate_calendar, params).get();
+    return cached_get<std::vector<CorporateActions>>(endpoints::beta::fundamentals::corporate_actions, params, [](const simdjson::dom::element& response) {
         std::vector<CorporateActions> results;
         
         auto actions_result = response["corporate_actions"];
@@ -970,20 +1508,20 @@ std::future<std::vector<CorporateActions>> ApiMethods::get_corporate_actions_asy
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<CorporateActions> ApiMethods::get_corporate_actions(const std::vector<std::string>& symbols) {
     return get_corporate_actions_async(symbols).get();
 }
 
-std::future<std::vector<CorporateFinancials>> ApiMethods::get_corporate_financials_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<CorporateFinancials>> ApiMethods::get_corporate_financials_async(const std::vector<std::string>& symbols,
+                                                                                         const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::beta::fundamentals::financials, params).get();
+    return cached_get<std::vector<CorporateFinancials>>(endpoints::beta::fundamentals::financials, params, [](const simdjson::dom::element& response) {
         std::vector<CorporateFinancials> results;
         
         auto financials_result = response["financials"];
@@ -999,20 +1537,20 @@ std::future<std::vector<CorporateFinancials>> ApiMethods::get_corporate_financia
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<CorporateFinancials> ApiMethods::get_corporate_financials(const std::vector<std::string>& symbols) {
     return get_corporate_financials_async(symbols).get();
 }
 
-std::future<std::vector<PriceStatistics>> ApiMethods::get_price_statistics_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<PriceStatistics>> ApiMethods::get_price_statistics_async(const std::vector<std::string>& symbols,
+                                                                                 const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::beta::fundamentals::price_stats, params).get();
+    return cached_get<std::vector<PriceStatistics>>(endpoints::beta::fundamentals::price_stats, params, [](const simdjson::dom::element& response) {
         std::vector<PriceStatistics> results;
         
         auto stats_result = response["price_statistics"];
@@ -1028,20 +1566,20 @@ std::future<std::vector<PriceStatistics>> ApiMethods::get_price_statistics_async
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<PriceStatistics> ApiMethods::get_price_statistics(const std::vector<std::string>& symbols) {
     return get_price_statistics_async(symbols).get();
 }
 
-std::future<std::vector<DividendInfo>> ApiMethods::get_dividend_info_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<DividendInfo>> ApiMethods::get_dividend_info_async(const std::vector<std::string>& symbols,
+                                                                           const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::beta::fundamentals::dividend, params).get();
+    return cached_get<std::vector<DividendInfo>>(endpoints::beta::fundamentals::dividend, params, [](const simdjson::dom::element& response) {
         std::vector<DividendInfo> results;
         
         auto dividends_result = response["dividends"];
@@ -1057,20 +1595,20 @@ std::future<std::vector<DividendInfo>> ApiMethods::get_dividend_info_async(const
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<DividendInfo> ApiMethods::get_dividend_info(const std::vector<std::string>& symbols) {
     return get_dividend_info_async(symbols).get();
 }
 
-std::future<std::vector<CorporateCalendar>> ApiMethods::get_corporate_calendar_async(const std::vector<std::string>& symbols) {
+std::future<std::vector<CorporateCalendar>> ApiMethods::get_corporate_calendar_async(const std::vector<std::string>& symbols,
+                                                                                     const RequestOptions& options) {
     std::unordered_map<std::string, std::string> params = {
         {"symbols", join_symbols(symbols)}
     };
     
-    return std::async(std::launch::async, [this, params]() {
-        auto response = client_->get_endpoint_async(endpoints::beta::fundamentals::corporate_calendar, params).get();
+    return cached_get<std::vector<CorporateCalendar>>(endpoints::beta::fundamentals::corporate_calendar, params, [](const simdjson::dom::element& response) {
         std::vector<CorporateCalendar> results;
         
         auto calendar_result = response["corporate_calendar"];
@@ -1086,7 +1624,7 @@ std::future<std::vector<CorporateCalendar>> ApiMethods::get_corporate_calendar_a
         }
         
         return results;
-    });
+    }, options);
 }
 
 std::vector<CorporateCalendar> ApiMethods::get_corporate_calendar(const std::vector<std::string>& symbols) {
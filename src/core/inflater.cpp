@@ -0,0 +1,164 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/core/inflater.hpp"
+#include "oqdTradierpp/core/padded_body.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <vector>
+#include <zlib.h>
+
+namespace oqd {
+
+namespace {
+
+constexpr std::size_t max_pooled_inflaters = 16;
+constexpr std::size_t min_output_chunk = 16 * 1024;
+
+std::mutex& pool_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::vector<std::unique_ptr<Inflater>>& pool() {
+    static std::vector<std::unique_ptr<Inflater>> free_list;
+    return free_list;
+}
+
+bool iequals(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+        return std::tolower(static_cast<unsigned char>(x)) == std::tolower(static_cast<unsigned char>(y));
+    });
+}
+
+// RFC 1950 header: deflate method with a 32 KB-or-smaller window and a check
+// value making the first two bytes a multiple of 31. Servers that send raw
+// RFC 1951 data under "deflate" fail this test.
+bool has_zlib_header(const unsigned char* data, std::size_t size) {
+    if (size == 0 || (data[0] & 0x0F) != 8 || (data[0] >> 4) > 7) {
+        return false;
+    }
+    return size < 2 || ((data[0] << 8) | data[1]) % 31 == 0;
+}
+
+} // namespace
+
+std::optional<ContentEncoding> content_encoding_from_string(std::string_view value) {
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t')) {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && (value.back() == ' ' || value.back() == '\t')) {
+        value.remove_suffix(1);
+    }
+    if (value.empty() || iequals(value, "identity")) {
+        return ContentEncoding::Identity;
+    }
+    if (iequals(value, "gzip") || iequals(value, "x-gzip")) {
+        return ContentEncoding::Gzip;
+    }
+    if (iequals(value, "deflate")) {
+        return ContentEncoding::Deflate;
+    }
+    return std::nullopt;
+}
+
+struct Inflater::Stream {
+    z_stream z{};
+    bool initialized = false;
+
+    ~Stream() {
+        if (initialized) {
+            inflateEnd(&z);
+        }
+    }
+};
+
+void Inflater::Release::operator()(Inflater* inflater) const {
+    std::unique_ptr<Inflater> owned(inflater);
+    std::lock_guard<std::mutex> lock(pool_mutex());
+    if (pool().size() < max_pooled_inflaters) {
+        pool().push_back(std::move(owned));
+    }
+}
+
+Inflater::Lease Inflater::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex());
+        if (!pool().empty()) {
+            Lease lease(pool().back().release());
+            pool().pop_back();
+            return lease;
+        }
+    }
+    return Lease(new Inflater());
+}
+
+Inflater::Inflater() : stream_(std::make_unique<Stream>()) {}
+
+Inflater::~Inflater() = default;
+
+void Inflater::begin(ContentEncoding encoding) {
+    encoding_ = encoding;
+    started_ = false;
+    finished_ = false;
+}
+
+bool Inflater::write(const char* data, std::size_t size, PaddedBuffer& out) {
+    if (finished_ || size == 0) {
+        return true;
+    }
+    auto* input = reinterpret_cast<const unsigned char*>(data);
+    z_stream& z = stream_->z;
+
+    if (!started_) {
+        // 16 + window selects the gzip wrapper, a negative window raw deflate.
+        int window_bits = MAX_WBITS;
+        if (encoding_ == ContentEncoding::Gzip) {
+            window_bits += 16;
+        } else if (!has_zlib_header(input, size)) {
+            window_bits = -MAX_WBITS;
+        }
+        int status = stream_->initialized ? inflateReset2(&z, window_bits) : inflateInit2(&z, window_bits);
+        if (status != Z_OK) {
+            return false;
+        }
+        stream_->initialized = true;
+        started_ = true;
+    }
+
+    z.next_in = const_cast<unsigned char*>(input);
+    z.avail_in = static_cast<uInt>(size);
+    do {
+        std::size_t room = std::max({out.capacity() - out.size(), z.avail_in * std::size_t{4}, min_output_chunk});
+        z.next_out = reinterpret_cast<unsigned char*>(out.prepare(room));
+        z.avail_out = static_cast<uInt>(room);
+        int status = inflate(&z, Z_NO_FLUSH);
+        out.commit(room - z.avail_out);
+        if (status == Z_STREAM_END) {
+            finished_ = true;
+            return true;
+        }
+        if (status == Z_BUF_ERROR && z.avail_out != 0) {
+            // Everything consumed; the rest of the stream is in a later chunk.
+            break;
+        }
+        if (status != Z_OK && status != Z_BUF_ERROR) {
+            return false;
+        }
+    } while (z.avail_in > 0 || z.avail_out == 0);
+    return true;
+}
+
+} // namespace oqd
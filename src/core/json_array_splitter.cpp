@@ -0,0 +1,161 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/core/json_array_splitter.hpp"
+
+namespace oqd {
+
+JsonArraySplitter::JsonArraySplitter(std::vector<std::string> path)
+    : path_(std::move(path)) {}
+
+void JsonArraySplitter::reset() {
+    stack_.clear();
+    position_ = 0;
+    key_start_ = 0;
+    scalar_start_ = npos;
+    element_start_ = npos;
+    element_depth_ = npos;
+    single_ = false;
+    in_string_ = false;
+    string_is_key_ = false;
+    escape_ = false;
+    done_ = false;
+}
+
+bool JsonArraySplitter::at_path() const {
+    if (stack_.size() != path_.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < stack_.size(); ++i) {
+        if (!stack_[i].object || stack_[i].key != path_[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void JsonArraySplitter::value_begin(std::string_view document, std::size_t at) {
+    if (element_depth_ == npos) {
+        if (!at_path()) {
+            return;
+        }
+        if (document[at] == '[') {
+            element_depth_ = stack_.size() + 1;
+        } else if (document[at] == '{') {
+            element_depth_ = stack_.size();
+            element_start_ = at;
+            single_ = true;
+        } else {
+            // "null" or a scalar where the array should be: nothing to report.
+            done_ = true;
+        }
+        return;
+    }
+    if (!single_ && element_start_ == npos && stack_.size() == element_depth_) {
+        element_start_ = at;
+    }
+}
+
+void JsonArraySplitter::value_end(std::size_t end, std::vector<Range>& elements) {
+    if (element_start_ != npos && stack_.size() == element_depth_) {
+        elements.emplace_back(element_start_, end);
+        element_start_ = npos;
+        if (single_) {
+            done_ = true;
+        }
+    }
+}
+
+void JsonArraySplitter::scan(std::string_view document, std::vector<Range>& elements) {
+    std::size_t i = position_;
+    const std::size_t size = document.size();
+
+    for (; i < size && !done_; ++i) {
+        const char c = document[i];
+
+        if (in_string_) {
+            if (escape_) {
+                escape_ = false;
+            } else if (c == '\\') {
+                escape_ = true;
+            } else if (c == '"') {
+                in_string_ = false;
+                if (string_is_key_) {
+                    stack_.back().key.assign(document.substr(key_start_, i - key_start_));
+                } else {
+                    value_end(i + 1, elements);
+                }
+            }
+            continue;
+        }
+
+        if (scalar_start_ != npos) {
+            if (c != ',' && c != ']' && c != '}' && c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                continue;
+            }
+            scalar_start_ = npos;
+            value_end(i, elements);
+        }
+
+        switch (c) {
+            case ' ':
+            case '\n':
+            case '\r':
+            case '\t':
+                break;
+            case '"':
+                string_is_key_ = !stack_.empty() && stack_.back().object && stack_.back().expect_key;
+                if (string_is_key_) {
+                    key_start_ = i + 1;
+                } else {
+                    value_begin(document, i);
+                }
+                in_string_ = true;
+                break;
+            case ':':
+                if (!stack_.empty()) {
+                    stack_.back().expect_key = false;
+                }
+                break;
+            case ',':
+                if (!stack_.empty() && stack_.back().object) {
+                    stack_.back().expect_key = true;
+                }
+                break;
+            case '{':
+            case '[':
+                value_begin(document, i);
+                stack_.push_back({c == '{', c == '{', {}});
+                break;
+            case '}':
+            case ']':
+                if (stack_.empty()) {
+                    done_ = true;
+                    break;
+                }
+                if (!single_ && element_depth_ != npos && stack_.size() == element_depth_) {
+                    done_ = true;
+                }
+                stack_.pop_back();
+                value_end(i + 1, elements);
+                break;
+            default:
+                scalar_start_ = i;
+                value_begin(document, i);
+                break;
+        }
+    }
+    position_ = done_ ? size : i;
+}
+
+} // namespace oqd
@@ -0,0 +1,127 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/fundamentals/bulk_fetcher.hpp"
+#include <stdexcept>
+#include <unordered_set>
+#include "oqdTradierpp/utils.hpp"
+
+namespace oqd {
+
+namespace {
+
+// Symbols are joined with ',' which url_encode turns into "%2C".
+constexpr std::size_t encoded_separator_length = 3;
+
+std::vector<std::vector<std::string>> pack(const std::vector<std::string>& symbols,
+                                           const std::vector<std::size_t>& lengths,
+                                           std::size_t max_symbols, std::size_t max_length) {
+    std::vector<std::vector<std::string>> chunks;
+    std::size_t current_length = 0;
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        std::size_t added = chunks.empty() || chunks.back().empty()
+            ? lengths[i]
+            : lengths[i] + encoded_separator_length;
+        bool full = chunks.empty() || chunks.back().size() >= max_symbols ||
+                    (!chunks.back().empty() && current_length + added > max_length);
+        if (full) {
+            chunks.emplace_back();
+            current_length = 0;
+            added = lengths[i];
+        }
+        chunks.back().push_back(symbols[i]);
+        current_length += added;
+    }
+    return chunks;
+}
+
+} // namespace
+
+FundamentalsFetcher::FundamentalsFetcher(std::shared_ptr<ApiMethods> api, BulkFetchOptions options)
+    : api_(std::move(api)), options_(options) {}
+
+std::vector<std::vector<std::string>> FundamentalsFetcher::make_chunks(const std::vector<std::string>& symbols,
+                                                                       const BulkFetchOptions& options) {
+    std::vector<std::string> unique;
+    std::vector<std::size_t> lengths;
+    std::unordered_set<std::string> seen;
+    unique.reserve(symbols.size());
+    lengths.reserve(symbols.size());
+    for (const auto& symbol : symbols) {
+        if (!symbol.empty() && seen.insert(symbol).second) {
+            unique.push_back(symbol);
+            lengths.push_back(utils::url_encode(symbol).size());
+        }
+    }
+    if (unique.empty()) {
+        return {};
+    }
+
+    std::size_t max_symbols = std::max<std::size_t>(1, options.max_symbols_per_request);
+    std::size_t max_length = std::max<std::size_t>(1, options.max_query_length);
+
+    // Greedy packing fixes the chunk count; repacking with an even per-chunk
+    // cap spreads the symbols so every request carries a similar load.
+    auto greedy = pack(unique, lengths, max_symbols, max_length);
+    std::size_t even = (unique.size() + greedy.size() - 1) / greedy.size();
+    if (even >= max_symbols) {
+        return greedy;
+    }
+    return pack(unique, lengths, even, max_length);
+}
+
+template<typename T>
+BulkFetchResult<T> FundamentalsFetcher::fetch_with(
+    const std::vector<std::string>& symbols,
+    std::future<std::vector<T>> (ApiMethods::*method)(const std::vector<std::string>&, const RequestOptions&)) const {
+    if (!api_) {
+        throw std::runtime_error("FundamentalsFetcher has no ApiMethods to fetch with");
+    }
+    // Chunk keys are never asked for again; caching them would only hold a
+    // second decoded copy of every chunk for the endpoint's TTL.
+    RequestOptions uncached;
+    uncached.use_cache = false;
+    return scatter_gather<T>(symbols, [this, method, uncached](const std::vector<std::string>& chunk) {
+        return ((*api_).*method)(chunk, uncached);
+    });
+}
+
+BulkFetchResult<CompanyInfo> FundamentalsFetcher::company_info(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_company_info_async);
+}
+
+BulkFetchResult<FinancialRatios> FundamentalsFetcher::financial_ratios(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_financial_ratios_async);
+}
+
+BulkFetchResult<CorporateActions> FundamentalsFetcher::corporate_actions(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_corporate_actions_async);
+}
+
+BulkFetchResult<CorporateFinancials> FundamentalsFetcher::corporate_financials(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_corporate_financials_async);
+}
+
+BulkFetchResult<PriceStatistics> FundamentalsFetcher::price_statistics(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_price_statistics_async);
+}
+
+BulkFetchResult<DividendInfo> FundamentalsFetcher::dividend_info(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_dividend_info_async);
+}
+
+BulkFetchResult<CorporateCalendar> FundamentalsFetcher::corporate_calendar(const std::vector<std::string>& symbols) const {
+    return fetch_with(symbols, &ApiMethods::get_corporate_calendar_async);
+}
+
+} // namespace oqd
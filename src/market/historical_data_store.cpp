@@ -0,0 +1,505 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/market/historical_data_store.hpp"
+#include "oqdTradierpp/utils.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace oqd {
+
+namespace {
+
+constexpr char bar_file_magic[8] = {'O', 'Q', 'D', 'B', 'A', 'R', 'S', '1'};
+constexpr std::uint32_t bar_file_version = 1;
+constexpr std::uint32_t bar_file_columns = 6;
+constexpr std::size_t min_capacity = 256;
+constexpr std::int64_t seconds_per_day = 86400;
+
+constexpr std::int64_t no_coverage_start = std::numeric_limits<std::int64_t>::max();
+constexpr std::int64_t no_coverage_end = std::numeric_limits<std::int64_t>::min();
+
+struct BarFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t columns;
+    std::uint64_t count;
+    std::uint64_t capacity;
+    std::int64_t covered_start;
+    std::int64_t covered_end;
+    std::uint8_t reserved[16];
+};
+static_assert(sizeof(BarFileHeader) == 64, "bar file header must stay 64 bytes");
+
+struct Bar {
+    std::int64_t time;
+    double open;
+    double high;
+    double low;
+    double close;
+    double volume;
+};
+
+std::size_t column_offset(std::size_t column, std::size_t capacity) {
+    return sizeof(BarFileHeader) + column * capacity * sizeof(double);
+}
+
+bool has_coverage(const BarFileHeader& header) {
+    return header.covered_start <= header.covered_end;
+}
+
+// Widens the header's range by [start, end] when the two overlap or touch. A
+// disjoint range is stored but not marked covered, since the days between
+// them were never fetched.
+void extend_coverage(BarFileHeader& header, std::int64_t start, std::int64_t end) {
+    if (start > end) {
+        return;
+    }
+    if (!has_coverage(header)) {
+        header.covered_start = start;
+        header.covered_end = end;
+    } else if (start <= header.covered_end + seconds_per_day && end >= header.covered_start - seconds_per_day) {
+        header.covered_start = std::min(header.covered_start, start);
+        header.covered_end = std::max(header.covered_end, end);
+    }
+}
+
+std::optional<BarFileHeader> read_header(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    BarFileHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return std::nullopt;
+    }
+    if (std::memcmp(header.magic, bar_file_magic, sizeof(bar_file_magic)) != 0 ||
+        header.version != bar_file_version || header.columns != bar_file_columns) {
+        throw std::runtime_error("Not a bar file: " + path.string());
+    }
+    return header;
+}
+
+std::optional<std::int64_t> try_parse_date(const std::string& date) {
+    auto day = utils::parse_iso_date(date);
+    if (!day) {
+        return std::nullopt;
+    }
+    return std::chrono::sys_seconds{*day}.time_since_epoch().count();
+}
+
+std::int64_t start_of_today() {
+    auto today = std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now());
+    return std::chrono::sys_seconds{today}.time_since_epoch().count();
+}
+
+// Sorts by time; on duplicate dates the later entry wins.
+void sort_unique(std::vector<Bar>& bars) {
+    std::stable_sort(bars.begin(), bars.end(), [](const Bar& a, const Bar& b) { return a.time < b.time; });
+    std::size_t out = 0;
+    for (std::size_t i = 0; i < bars.size(); ++i) {
+        if (out > 0 && bars[out - 1].time == bars[i].time) {
+            bars[out - 1] = bars[i];
+        } else {
+            bars[out++] = bars[i];
+        }
+    }
+    bars.resize(out);
+}
+
+std::vector<Bar> to_bars(const std::vector<HistoricalData>& data) {
+    std::vector<Bar> bars;
+    bars.reserve(data.size());
+    for (const auto& item : data) {
+        if (auto time = try_parse_date(item.date)) {
+            bars.push_back({*time, item.open, item.high, item.low, item.close, item.volume});
+        }
+    }
+    sort_unique(bars);
+    return bars;
+}
+
+std::vector<Bar> read_bars(const BarSeries& series) {
+    std::vector<Bar> bars(series.size());
+    auto time = series.time();
+    auto open = series.open();
+    auto high = series.high();
+    auto low = series.low();
+    auto close = series.close();
+    auto volume = series.volume();
+    for (std::size_t i = 0; i < bars.size(); ++i) {
+        bars[i] = {time[i], open[i], high[i], low[i], close[i], volume[i]};
+    }
+    return bars;
+}
+
+// Writes one field of every bar, zero-padded out to `length` entries.
+template <typename T>
+void write_column(std::ostream& out, const std::vector<Bar>& bars, std::size_t length, T Bar::*field) {
+    std::vector<T> column(std::max(length, bars.size()), T{});
+    for (std::size_t i = 0; i < bars.size(); ++i) {
+        column[i] = bars[i].*field;
+    }
+    out.write(reinterpret_cast<const char*>(column.data()),
+              static_cast<std::streamsize>(column.size() * sizeof(T)));
+}
+
+// Writes a fresh file next to the target and renames it into place, so mapped
+// readers keep the old inode and never observe a half-written file.
+void rewrite_file(const std::filesystem::path& path, const std::vector<Bar>& bars,
+                  std::int64_t covered_start, std::int64_t covered_end) {
+    std::size_t capacity = std::max(min_capacity, std::bit_ceil(bars.size() + bars.size() / 2));
+
+    BarFileHeader header{};
+    std::memcpy(header.magic, bar_file_magic, sizeof(bar_file_magic));
+    header.version = bar_file_version;
+    header.columns = bar_file_columns;
+    header.count = bars.size();
+    header.capacity = capacity;
+    header.covered_start = covered_start;
+    header.covered_end = covered_end;
+
+    std::filesystem::create_directories(path.parent_path());
+    auto temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Failed to create bar file: " + temp.string());
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        write_column(out, bars, capacity, &Bar::time);
+        write_column(out, bars, capacity, &Bar::open);
+        write_column(out, bars, capacity, &Bar::high);
+        write_column(out, bars, capacity, &Bar::low);
+        write_column(out, bars, capacity, &Bar::close);
+        write_column(out, bars, capacity, &Bar::volume);
+        if (!out.flush()) {
+            throw std::runtime_error("Failed to write bar file: " + temp.string());
+        }
+    }
+    std::filesystem::rename(temp, path);
+}
+
+// Writes bars into the spare capacity of each column, then publishes them by
+// updating the header count last.
+void append_in_place(const std::filesystem::path& path, BarFileHeader header, const std::vector<Bar>& bars) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    if (!file) {
+        throw std::runtime_error("Failed to open bar file: " + path.string());
+    }
+
+    std::size_t row = header.count;
+    auto write_at = [&](std::size_t column, auto field) {
+        file.seekp(static_cast<std::streamoff>(column_offset(column, header.capacity) + row * sizeof(double)));
+        write_column(file, bars, bars.size(), field);
+    };
+    if (!bars.empty()) {
+        write_at(0, &Bar::time);
+        write_at(1, &Bar::open);
+        write_at(2, &Bar::high);
+        write_at(3, &Bar::low);
+        write_at(4, &Bar::close);
+        write_at(5, &Bar::volume);
+        file.flush();
+    }
+
+    header.count += bars.size();
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!file.flush()) {
+        throw std::runtime_error("Failed to update bar file: " + path.string());
+    }
+}
+
+} // namespace
+
+BarSeries::~BarSeries() {
+    release();
+}
+
+BarSeries::BarSeries(BarSeries&& other) noexcept
+    : mapping_(std::exchange(other.mapping_, nullptr)),
+      mapping_size_(std::exchange(other.mapping_size_, 0)),
+      count_(std::exchange(other.count_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)) {}
+
+BarSeries& BarSeries::operator=(BarSeries&& other) noexcept {
+    if (this != &other) {
+        release();
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapping_size_ = std::exchange(other.mapping_size_, 0);
+        count_ = std::exchange(other.count_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+}
+
+void BarSeries::release() {
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+    mapping_size_ = 0;
+    count_ = 0;
+    capacity_ = 0;
+}
+
+std::span<const std::int64_t> BarSeries::time() const {
+    if (!mapping_) {
+        return {};
+    }
+    auto base = static_cast<const char*>(mapping_) + column_offset(0, capacity_);
+    return {reinterpret_cast<const std::int64_t*>(base), count_};
+}
+
+std::span<const double> BarSeries::column(std::size_t index) const {
+    if (!mapping_) {
+        return {};
+    }
+    auto base = static_cast<const char*>(mapping_) + column_offset(index + 1, capacity_);
+    return {reinterpret_cast<const double*>(base), count_};
+}
+
+std::vector<HistoricalData> BarSeries::to_historical_data() const {
+    std::vector<HistoricalData> data(count_);
+    auto time_column = time();
+    auto open_column = open();
+    auto high_column = high();
+    auto low_column = low();
+    auto close_column = close();
+    auto volume_column = volume();
+    for (std::size_t i = 0; i < count_; ++i) {
+        data[i].date = HistoricalDataStore::format_date(time_column[i]);
+        data[i].open = open_column[i];
+        data[i].high = high_column[i];
+        data[i].low = low_column[i];
+        data[i].close = close_column[i];
+        data[i].volume = volume_column[i];
+    }
+    return data;
+}
+
+BarSeries BarSeries::map(const std::filesystem::path& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open bar file: " + path.string());
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(BarFileHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Truncated bar file: " + path.string());
+    }
+
+    auto size = static_cast<std::size_t>(info.st_size);
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Failed to map bar file: " + path.string());
+    }
+
+    BarSeries series;
+    series.mapping_ = mapping;
+    series.mapping_size_ = size;
+
+    BarFileHeader header{};
+    std::memcpy(&header, mapping, sizeof(header));
+    if (std::memcmp(header.magic, bar_file_magic, sizeof(bar_file_magic)) != 0 ||
+        header.version != bar_file_version || header.columns != bar_file_columns ||
+        header.count > header.capacity || column_offset(bar_file_columns, header.capacity) > size) {
+        throw std::runtime_error("Not a bar file: " + path.string());
+    }
+    series.count_ = header.count;
+    series.capacity_ = header.capacity;
+    ::madvise(mapping, size, MADV_WILLNEED);
+    return series;
+}
+
+HistoricalDataStore::HistoricalDataStore(std::shared_ptr<ApiMethods> api, std::filesystem::path root)
+    : api_(std::move(api)), root_(std::move(root)) {}
+
+std::filesystem::path HistoricalDataStore::path_for(const std::string& symbol, const std::string& interval) const {
+    auto sanitize = [](std::string name) {
+        for (auto& c : name) {
+            bool keep = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') ||
+                        c == '.' || c == '-' || c == '_';
+            if (!keep) {
+                c = '_';
+            }
+        }
+        return name;
+    };
+    return root_ / sanitize(interval) / (sanitize(symbol) + ".bars");
+}
+
+BarSeries HistoricalDataStore::load(const std::string& symbol, const std::string& interval) const {
+    auto path = path_for(symbol, interval);
+    if (!std::filesystem::exists(path)) {
+        return {};
+    }
+    return BarSeries::map(path);
+}
+
+std::optional<HistoricalDataStore::Coverage> HistoricalDataStore::coverage(const std::string& symbol,
+                                                                          const std::string& interval) const {
+    auto header = read_header(path_for(symbol, interval));
+    if (!header || !has_coverage(*header)) {
+        return std::nullopt;
+    }
+    return Coverage{header->covered_start, header->covered_end, static_cast<std::size_t>(header->count)};
+}
+
+std::vector<std::pair<std::string, std::string>> HistoricalDataStore::missing_ranges(const std::string& symbol,
+                                                                                     const std::string& interval,
+                                                                                     const std::string& start,
+                                                                                     const std::string& end) const {
+    auto first = parse_date(start);
+    auto last = parse_date(end);
+    if (first > last) {
+        return {};
+    }
+
+    auto covered = coverage(symbol, interval);
+    if (!covered) {
+        return {{start, end}};
+    }
+
+    // Coverage is one contiguous range, so a request that lies wholly before
+    // or after it also fetches the gap in between.
+    std::vector<std::pair<std::string, std::string>> ranges;
+    if (first < covered->first) {
+        ranges.emplace_back(start, format_date(covered->first - seconds_per_day));
+    }
+    if (last > covered->last) {
+        ranges.emplace_back(format_date(covered->last + seconds_per_day), end);
+    }
+    return ranges;
+}
+
+void HistoricalDataStore::merge(const std::string& symbol, const std::string& interval,
+                                const std::vector<HistoricalData>& bars,
+                                const std::string& start, const std::string& end) {
+    auto covered_start = parse_date(start);
+    auto covered_end = std::min(parse_date(end), start_of_today() - seconds_per_day);
+    if (covered_start > covered_end) {
+        covered_start = no_coverage_start;
+        covered_end = no_coverage_end;
+    }
+    merge_epochs(path_for(symbol, interval), bars, covered_start, covered_end);
+}
+
+void HistoricalDataStore::merge_epochs(const std::filesystem::path& path, const std::vector<HistoricalData>& data,
+                                       std::int64_t covered_start, std::int64_t covered_end) {
+    auto bars = to_bars(data);
+
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto header = read_header(path);
+    if (!header) {
+        rewrite_file(path, bars, covered_start, covered_end);
+        return;
+    }
+
+    extend_coverage(*header, covered_start, covered_end);
+
+    auto existing = BarSeries::map(path);
+    auto time = existing.time();
+    bool appends = time.empty() || bars.empty() || bars.front().time > time.back();
+    if (appends && header->count + bars.size() <= header->capacity) {
+        append_in_place(path, *header, bars);
+        return;
+    }
+
+    auto merged = read_bars(existing);
+    merged.insert(merged.end(), bars.begin(), bars.end());
+    sort_unique(merged);
+    rewrite_file(path, merged, header->covered_start, header->covered_end);
+}
+
+BarSeries HistoricalDataStore::get(const std::string& symbol, const std::string& interval,
+                                   const std::string& start, const std::string& end) {
+    return std::move(get_many({symbol}, interval, start, end).front());
+}
+
+std::vector<BarSeries> HistoricalDataStore::get_many(const std::vector<std::string>& symbols,
+                                                     const std::string& interval,
+                                                     const std::string& start, const std::string& end) {
+    struct Fetch {
+        std::size_t symbol_index;
+        std::pair<std::string, std::string> range;
+    };
+
+    std::vector<Fetch> fetches;
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        for (auto& range : missing_ranges(symbols[i], interval, start, end)) {
+            fetches.push_back({i, std::move(range)});
+        }
+    }
+
+    if (!fetches.empty() && !api_) {
+        throw std::runtime_error("HistoricalDataStore has no ApiMethods to fetch missing bars");
+    }
+
+    for (std::size_t wave = 0; wave < fetches.size(); wave += max_concurrent_fetches_) {
+        std::size_t wave_end = std::min(fetches.size(), wave + max_concurrent_fetches_);
+        std::vector<std::future<std::vector<HistoricalData>>> pending;
+        pending.reserve(wave_end - wave);
+        for (std::size_t i = wave; i < wave_end; ++i) {
+            const auto& fetch = fetches[i];
+            pending.push_back(api_->get_historical_data_async(symbols[fetch.symbol_index], interval,
+                                                              fetch.range.first, fetch.range.second));
+        }
+        for (std::size_t i = wave; i < wave_end; ++i) {
+            const auto& fetch = fetches[i];
+            merge(symbols[fetch.symbol_index], interval, pending[i - wave].get(),
+                  fetch.range.first, fetch.range.second);
+        }
+    }
+
+    std::vector<BarSeries> result;
+    result.reserve(symbols.size());
+    for (const auto& symbol : symbols) {
+        result.push_back(load(symbol, interval));
+    }
+    return result;
+}
+
+std::int64_t HistoricalDataStore::parse_date(const std::string& date) {
+    auto parsed = try_parse_date(date);
+    if (!parsed) {
+        throw std::invalid_argument("Invalid date (expected YYYY-MM-DD): " + date);
+    }
+    return *parsed;
+}
+
+std::string HistoricalDataStore::format_date(std::int64_t epoch_seconds) {
+    auto days = std::chrono::floor<std::chrono::days>(std::chrono::sys_seconds{std::chrono::seconds{epoch_seconds}});
+    std::chrono::year_month_day ymd{days};
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u", static_cast<int>(ymd.year()),
+                  static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
+    return buffer;
+}
+
+} // namespace oqd
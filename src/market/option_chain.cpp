@@ -39,11 +39,14 @@ OptionChain OptionChain::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string OptionChain::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void OptionChain::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .field("underlying", underlying)
         .array_field("options", options)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 } // namespace oqd
\ No newline at end of file
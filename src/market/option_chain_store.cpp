@@ -0,0 +1,345 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/market/option_chain_store.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace oqd {
+
+namespace {
+
+constexpr double strike_epsilon = 1e-6;
+
+std::int64_t to_nanoseconds(std::chrono::system_clock::time_point time) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+} // namespace
+
+void OptionSideColumns::resize(std::size_t n) {
+    bid.resize(n);
+    ask.resize(n);
+    last.resize(n);
+    volume.resize(n);
+    open_interest.resize(n);
+    bid_size.resize(n);
+    ask_size.resize(n);
+    updated_ns.resize(n);
+    listed.resize(n);
+}
+
+std::size_t OptionChainSnapshot::lower_bound(double strike) const {
+    auto it = std::lower_bound(strikes_->begin(), strikes_->end(), strike - strike_epsilon);
+    return static_cast<std::size_t>(it - strikes_->begin());
+}
+
+std::optional<std::size_t> OptionChainSnapshot::find_strike(double strike) const {
+    std::size_t row = lower_bound(strike);
+    if (row < strikes_->size() && std::abs((*strikes_)[row] - strike) <= strike_epsilon) {
+        return row;
+    }
+    return std::nullopt;
+}
+
+std::optional<OptionQuoteView> OptionChainSnapshot::call(std::size_t row) const {
+    return view(row, true);
+}
+
+std::optional<OptionQuoteView> OptionChainSnapshot::put(std::size_t row) const {
+    return view(row, false);
+}
+
+std::optional<OptionQuoteView> OptionChainSnapshot::view(std::size_t row, bool is_call) const {
+    if (row >= strikes_->size()) {
+        return std::nullopt;
+    }
+    const auto& page = *pages_[row / OptionChainPage::capacity];
+    const auto& side = is_call ? page.call : page.put;
+    std::size_t slot = row % OptionChainPage::capacity;
+    if (!side.listed[slot]) {
+        return std::nullopt;
+    }
+
+    OptionQuoteView quote;
+    quote.symbol = is_call ? (*call_symbols_)[row] : (*put_symbols_)[row];
+    quote.strike = (*strikes_)[row];
+    quote.bid = side.bid[slot];
+    quote.ask = side.ask[slot];
+    quote.last = side.last[slot];
+    quote.volume = side.volume[slot];
+    quote.open_interest = side.open_interest[slot];
+    quote.bid_size = side.bid_size[slot];
+    quote.ask_size = side.ask_size[slot];
+    quote.updated = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(side.updated_ns[slot])));
+    return quote;
+}
+
+OptionChainStore::OptionChainStore(std::shared_ptr<ApiMethods> api)
+    : api_(std::move(api)) {
+}
+
+std::string OptionChainStore::make_key(const std::string& underlying, const std::string& expiration) {
+    std::string key;
+    key.reserve(underlying.size() + expiration.size() + 1);
+    key.append(underlying).append(1, ':').append(expiration);
+    return key;
+}
+
+OptionChainStore::SnapshotPtr OptionChainStore::seed(const std::string& underlying, const std::string& expiration) {
+    if (!api_) {
+        throw std::runtime_error("OptionChainStore::seed requires an ApiMethods instance");
+    }
+    return load(underlying, expiration, api_->get_option_chain(underlying, expiration, false));
+}
+
+OptionChainStore::SnapshotPtr OptionChainStore::load(const std::string& underlying, const std::string& expiration,
+                                                     const OptionChain& chain) {
+    auto strikes = std::make_shared<std::vector<double>>();
+    strikes->reserve(chain.options.size() / 2 + 1);
+    for (const auto& option : chain.options) {
+        if (option.strike && option.option_type) {
+            strikes->push_back(*option.strike);
+        }
+    }
+    std::sort(strikes->begin(), strikes->end());
+    strikes->erase(std::unique(strikes->begin(), strikes->end(),
+                               [](double a, double b) { return std::abs(a - b) <= strike_epsilon; }),
+                   strikes->end());
+
+    const std::size_t rows = strikes->size();
+    const std::size_t page_count = (rows + OptionChainPage::capacity - 1) / OptionChainPage::capacity;
+    auto entry = std::make_unique<Chain>();
+    entry->underlying = underlying;
+    entry->expiration = expiration;
+    entry->pages.reserve(page_count);
+    for (std::size_t p = 0; p < page_count; ++p) {
+        auto page = std::make_shared<OptionChainPage>();
+        std::size_t count = std::min(OptionChainPage::capacity, rows - p * OptionChainPage::capacity);
+        page->call.resize(count);
+        page->put.resize(count);
+        entry->pages.push_back(std::move(page));
+    }
+    entry->private_epochs.assign(page_count, 0);
+
+    auto call_symbols = std::make_shared<std::vector<std::string>>(rows);
+    auto put_symbols = std::make_shared<std::vector<std::string>>(rows);
+    auto now = to_nanoseconds(std::chrono::system_clock::now());
+    for (const auto& option : chain.options) {
+        if (!option.strike || !option.option_type) {
+            continue;
+        }
+        auto it = std::lower_bound(strikes->begin(), strikes->end(), *option.strike - strike_epsilon);
+        std::size_t row = static_cast<std::size_t>(it - strikes->begin());
+        bool is_call = *option.option_type == "call";
+        auto& page = *entry->pages[row / OptionChainPage::capacity];
+        auto& side = is_call ? page.call : page.put;
+        std::size_t slot = row % OptionChainPage::capacity;
+
+        side.bid[slot] = option.bid;
+        side.ask[slot] = option.ask;
+        side.last[slot] = option.last;
+        side.volume[slot] = option.volume;
+        side.open_interest[slot] = option.open_interest.value_or(0.0);
+        side.bid_size[slot] = static_cast<int>(option.bidsize);
+        side.ask_size[slot] = static_cast<int>(option.asksize);
+        side.updated_ns[slot] = now;
+        side.listed[slot] = 1;
+        (is_call ? *call_symbols : *put_symbols)[row] = option.symbol;
+    }
+
+    entry->strikes = std::move(strikes);
+    entry->call_symbols = std::move(call_symbols);
+    entry->put_symbols = std::move(put_symbols);
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto key = make_key(underlying, expiration);
+    auto existing = chains_.find(key);
+    if (existing != chains_.end()) {
+        entry->version = existing->second->version + 1;
+        unindex(*existing->second);
+        existing->second = std::move(entry);
+    } else {
+        existing = chains_.emplace(key, std::move(entry)).first;
+    }
+
+    Chain* stored = existing->second.get();
+    for (std::size_t row = 0; row < rows; ++row) {
+        const auto& call_symbol = (*stored->call_symbols)[row];
+        if (!call_symbol.empty()) {
+            contracts_[call_symbol] = Location{stored, static_cast<std::uint32_t>(row), true};
+        }
+        const auto& put_symbol = (*stored->put_symbols)[row];
+        if (!put_symbol.empty()) {
+            contracts_[put_symbol] = Location{stored, static_cast<std::uint32_t>(row), false};
+        }
+    }
+    lock.unlock();
+    return snapshot(underlying, expiration);
+}
+
+OptionSideColumns* OptionChainStore::writable_side(const Location& location) {
+    auto& chain = *location.chain;
+    std::size_t index = location.row / OptionChainPage::capacity;
+    auto& page = chain.pages[index];
+    // A snapshot taken since the last copy may be reading this page: give the
+    // store its own copy. The exclusive lock orders this after that snapshot.
+    auto epoch = chain.snapshot_epoch.load(std::memory_order_relaxed);
+    if (chain.private_epochs[index] != epoch) {
+        page = std::make_shared<OptionChainPage>(*page);
+        chain.private_epochs[index] = epoch;
+    }
+    ++chain.version;
+    return location.is_call ? &page->call : &page->put;
+}
+
+bool OptionChainStore::apply(const StreamingQuote& quote) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = contracts_.find(quote.symbol);
+    if (it == contracts_.end()) {
+        return false;
+    }
+    auto* side = writable_side(it->second);
+    std::size_t slot = it->second.row % OptionChainPage::capacity;
+    side->bid[slot] = quote.bid;
+    side->ask[slot] = quote.ask;
+    side->bid_size[slot] = quote.bid_size;
+    side->ask_size[slot] = quote.ask_size;
+    if (quote.last > 0.0) {
+        side->last[slot] = quote.last;
+    }
+    side->updated_ns[slot] = to_nanoseconds(quote.timestamp);
+    return true;
+}
+
+bool OptionChainStore::apply(const StreamingTrade& trade) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = contracts_.find(trade.symbol);
+    if (it == contracts_.end()) {
+        return false;
+    }
+    auto* side = writable_side(it->second);
+    std::size_t slot = it->second.row % OptionChainPage::capacity;
+    side->last[slot] = trade.price;
+    side->volume[slot] += trade.size;
+    side->updated_ns[slot] = to_nanoseconds(trade.timestamp);
+    return true;
+}
+
+bool OptionChainStore::on_stream_event(const simdjson::dom::element& elem) {
+    switch (StreamingSession::determine_data_type_static(elem)) {
+        case StreamingDataType::Quote:
+            return apply(StreamingQuote::from_json(elem));
+        case StreamingDataType::Trade:
+            return apply(StreamingTrade::from_json(elem));
+        default:
+            return false;
+    }
+}
+
+StreamingCallback OptionChainStore::stream_callback() {
+    return [this](const simdjson::dom::element& elem) {
+        on_stream_event(elem);
+    };
+}
+
+OptionChainStore::SnapshotPtr OptionChainStore::snapshot(const std::string& underlying,
+                                                         const std::string& expiration) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = chains_.find(make_key(underlying, expiration));
+    if (it == chains_.end()) {
+        return nullptr;
+    }
+    const auto& chain = *it->second;
+    auto snap = std::make_shared<OptionChainSnapshot>();
+    snap->underlying_ = chain.underlying;
+    snap->expiration_ = chain.expiration;
+    snap->version_ = chain.version;
+    snap->strikes_ = chain.strikes;
+    snap->call_symbols_ = chain.call_symbols;
+    snap->put_symbols_ = chain.put_symbols;
+    snap->pages_.assign(chain.pages.begin(), chain.pages.end());
+    chain.snapshot_epoch.fetch_add(1, std::memory_order_relaxed);
+    return snap;
+}
+
+bool OptionChainStore::contains(const std::string& underlying, const std::string& expiration) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return chains_.count(make_key(underlying, expiration)) != 0;
+}
+
+std::vector<std::string> OptionChainStore::symbols(const std::string& underlying,
+                                                   const std::string& expiration) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> result;
+    auto it = chains_.find(make_key(underlying, expiration));
+    if (it == chains_.end()) {
+        return result;
+    }
+    for (const auto* symbols : {it->second->call_symbols.get(), it->second->put_symbols.get()}) {
+        for (const auto& symbol : *symbols) {
+            if (!symbol.empty()) {
+                result.push_back(symbol);
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> OptionChainStore::symbols() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> result;
+    result.reserve(contracts_.size());
+    for (const auto& [symbol, location] : contracts_) {
+        result.push_back(symbol);
+    }
+    return result;
+}
+
+void OptionChainStore::unindex(const Chain& chain) {
+    for (const auto* symbols : {chain.call_symbols.get(), chain.put_symbols.get()}) {
+        for (const auto& symbol : *symbols) {
+            auto it = contracts_.find(symbol);
+            if (it != contracts_.end() && it->second.chain == &chain) {
+                contracts_.erase(it);
+            }
+        }
+    }
+}
+
+bool OptionChainStore::erase(const std::string& underlying, const std::string& expiration) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = chains_.find(make_key(underlying, expiration));
+    if (it == chains_.end()) {
+        return false;
+    }
+    unindex(*it->second);
+    chains_.erase(it);
+    return true;
+}
+
+void OptionChainStore::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    contracts_.clear();
+    chains_.clear();
+}
+
+std::size_t OptionChainStore::chain_count() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return chains_.size();
+}
+
+} // namespace oqd
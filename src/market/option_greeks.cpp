@@ -0,0 +1,328 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/market/option_greeks.hpp"
+#include "oqdTradierpp/core/vector_math.hpp"
+#include "oqdTradierpp/utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace oqd {
+
+namespace {
+
+using vmath::norm_cdf;
+using vmath::norm_pdf;
+using vmath::vexp;
+using vmath::vlog;
+
+constexpr std::size_t block_size = 512;
+constexpr double nan_value = std::numeric_limits<double>::quiet_NaN();
+constexpr double pi = 3.14159265358979323846;
+constexpr double min_volatility = 1e-6;
+constexpr double max_volatility = 10.0;
+constexpr double days_per_year = 365.0;
+
+struct Inputs {
+    const double* strike;
+    const double* years;
+    const double* sign;
+    double spot;
+    double rate;
+    double dividend_yield;
+};
+
+OQD_SIMD_CLONES
+void greeks_kernel(std::size_t n, Inputs in, const double* __restrict volatility,
+                   double* __restrict theoretical, double* __restrict delta, double* __restrict gamma,
+                   double* __restrict theta, double* __restrict vega, double* __restrict rho) {
+    const double* __restrict strike = in.strike;
+    const double* __restrict years = in.years;
+    const double* __restrict sign = in.sign;
+    const double s = in.spot;
+    const double r = in.rate;
+    const double q = in.dividend_yield;
+    for (std::size_t i = 0; i < n; ++i) {
+        double k = strike[i];
+        double t = years[i];
+        double w = sign[i];
+        double vol = volatility[i];
+        bool valid = (t > 0.0) & (k > 0.0) & (s > 0.0) & (vol > 0.0);
+        t = valid ? t : 1.0;
+        k = valid ? k : s;
+        vol = valid ? vol : 1.0;
+
+        double sqrt_t = std::sqrt(t);
+        double vol_sqrt_t = vol * sqrt_t;
+        double df_r = vexp(-r * t);
+        double df_q = vexp(-q * t);
+        double d1 = (vlog(s / k) + (r - q + 0.5 * vol * vol) * t) / vol_sqrt_t;
+        double d2 = d1 - vol_sqrt_t;
+        double pdf = norm_pdf(d1);
+        double nd1 = norm_cdf(w * d1);
+        double nd2 = norm_cdf(w * d2);
+        double s_df = s * df_q;
+        double k_df = k * df_r;
+
+        double price = w * (s_df * nd1 - k_df * nd2);
+        double d = w * df_q * nd1;
+        double g = df_q * pdf / (s * vol_sqrt_t);
+        double th = -s_df * pdf * vol / (2.0 * sqrt_t) - w * r * k_df * nd2 + w * q * s_df * nd1;
+        double v = s_df * pdf * sqrt_t;
+        double rh = w * k_df * t * nd2;
+
+        theoretical[i] = valid ? price : nan_value;
+        delta[i] = valid ? d : nan_value;
+        gamma[i] = valid ? g : nan_value;
+        theta[i] = valid ? th / days_per_year : nan_value;
+        vega[i] = valid ? v * 0.01 : nan_value;
+        rho[i] = valid ? rh * 0.01 : nan_value;
+    }
+}
+
+// Per-lane solver state for one block. Puts are solved as calls via put-call
+// parity so a single pricing path serves both.
+struct SolverBlock {
+    alignas(64) double target[block_size];
+    alignas(64) double s_df[block_size];
+    alignas(64) double k_df[block_size];
+    alignas(64) double sqrt_t[block_size];
+    alignas(64) double drift[block_size];
+    alignas(64) double sigma[block_size];
+    alignas(64) double lo[block_size];
+    alignas(64) double hi[block_size];
+    alignas(64) double active[block_size];
+};
+
+OQD_SIMD_CLONES
+double iv_setup_kernel(std::size_t n, Inputs in, const double* price, SolverBlock& b) {
+    const double s = in.spot;
+    const double r = in.rate;
+    const double q = in.dividend_yield;
+    double active_count = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double k = in.strike[i];
+        double t = in.years[i];
+        double w = in.sign[i];
+        bool usable = (t > 0.0) & (k > 0.0) & (s > 0.0);
+        t = usable ? t : 1.0;
+        k = usable ? k : s;
+
+        double s_df = s * vexp(-q * t);
+        double k_df = k * vexp(-r * t);
+        double forward_gap = s_df - k_df;
+        double call = price[i] + (w < 0.0 ? forward_gap : 0.0);
+        double lower = std::max(forward_gap, 0.0);
+        bool valid = usable & (call > lower) & (call < s_df);
+
+        // Corrado-Miller (1996) closed-form estimate.
+        double x = call - 0.5 * forward_gap;
+        double disc = std::max(x * x - forward_gap * forward_gap / pi, 0.0);
+        double guess = std::sqrt(2.0 * pi / t) * (x + std::sqrt(disc)) / (s_df + k_df);
+        guess = std::min(5.0, std::max(0.01, guess));
+
+        b.target[i] = call;
+        b.s_df[i] = s_df;
+        b.k_df[i] = k_df;
+        b.sqrt_t[i] = std::sqrt(t);
+        b.drift[i] = vlog(s_df / k_df);
+        b.sigma[i] = valid ? guess : nan_value;
+        b.lo[i] = min_volatility;
+        b.hi[i] = max_volatility;
+        b.active[i] = valid ? 1.0 : 0.0;
+        active_count += b.active[i];
+    }
+    return active_count;
+}
+
+// One safeguarded Newton step on every still-active lane: the step is taken
+// when it stays inside the bracket, otherwise the bracket is bisected.
+OQD_SIMD_CLONES
+double iv_step_kernel(std::size_t n, double tolerance, SolverBlock& b) {
+    double active_count = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool active = b.active[i] != 0.0;
+        double sigma = active ? b.sigma[i] : 0.2;
+        double vol_sqrt_t = sigma * b.sqrt_t[i];
+        double d1 = b.drift[i] / vol_sqrt_t + 0.5 * vol_sqrt_t;
+        double d2 = d1 - vol_sqrt_t;
+        double model = b.s_df[i] * norm_cdf(d1) - b.k_df[i] * norm_cdf(d2);
+        double diff = model - b.target[i];
+        double vega = b.s_df[i] * norm_pdf(d1) * b.sqrt_t[i];
+
+        double lo = diff > 0.0 ? b.lo[i] : sigma;
+        double hi = diff > 0.0 ? sigma : b.hi[i];
+        double newton = sigma - diff / vega;
+        double next = ((newton > lo) & (newton < hi)) ? newton : 0.5 * (lo + hi);
+        bool done = std::abs(diff) < tolerance;
+
+        b.sigma[i] = (active & !done) ? next : b.sigma[i];
+        b.lo[i] = active ? lo : b.lo[i];
+        b.hi[i] = active ? hi : b.hi[i];
+        b.active[i] = (active & !done) ? 1.0 : 0.0;
+        active_count += b.active[i];
+    }
+    return active_count;
+}
+
+Inputs make_inputs(const OptionColumns& options, const GreeksParams& params) {
+    return Inputs{options.strike.data(), options.expiry_years.data(), options.sign.data(),
+                  params.spot, params.rate, params.dividend_yield};
+}
+
+double expiry_in_years(const std::string& expiration, std::chrono::system_clock::time_point now) {
+    auto date = utils::parse_iso_date(expiration);
+    if (!date) {
+        return 0.0;
+    }
+    // Regular-session close, approximated as 20:00 UTC.
+    auto expiry = *date + std::chrono::hours{20};
+    auto remaining = std::chrono::duration<double>(expiry - now).count();
+    return remaining / (days_per_year * 86400.0);
+}
+
+} // namespace
+
+void OptionColumns::reserve(std::size_t n) {
+    strike.reserve(n);
+    expiry_years.reserve(n);
+    sign.reserve(n);
+    price.reserve(n);
+    source_index.reserve(n);
+}
+
+void OptionColumns::clear() {
+    strike.clear();
+    expiry_years.clear();
+    sign.clear();
+    price.clear();
+    source_index.clear();
+}
+
+void OptionColumns::push_back(double strike_price, double years, bool is_call, double market_price,
+                              std::size_t index) {
+    strike.push_back(strike_price);
+    expiry_years.push_back(years);
+    sign.push_back(is_call ? 1.0 : -1.0);
+    price.push_back(market_price);
+    source_index.push_back(index);
+}
+
+OptionColumns OptionColumns::from_chain(const OptionChain& chain, std::chrono::system_clock::time_point now) {
+    OptionColumns columns;
+    columns.reserve(chain.options.size());
+    for (std::size_t i = 0; i < chain.options.size(); ++i) {
+        const auto& quote = chain.options[i];
+        if (!quote.strike || !quote.expiration_date || !quote.option_type) {
+            continue;
+        }
+        double market_price = 0.0;
+        if (quote.bid > 0.0 && quote.ask > 0.0) {
+            market_price = 0.5 * (quote.bid + quote.ask);
+        } else if (quote.last > 0.0) {
+            market_price = quote.last;
+        }
+        columns.push_back(*quote.strike, expiry_in_years(*quote.expiration_date, now),
+                          *quote.option_type == "call", market_price, i);
+    }
+    return columns;
+}
+
+void GreeksColumns::resize(std::size_t n) {
+    iv.resize(n);
+    theoretical.resize(n);
+    delta.resize(n);
+    gamma.resize(n);
+    theta.resize(n);
+    vega.resize(n);
+    rho.resize(n);
+}
+
+void compute_implied_volatility(const OptionColumns& options, const GreeksParams& params,
+                                std::vector<double>& iv) {
+    const std::size_t n = options.size();
+    iv.resize(n);
+    Inputs in = make_inputs(options, params);
+
+    SolverBlock block;
+    for (std::size_t offset = 0; offset < n; offset += block_size) {
+        std::size_t count = std::min(block_size, n - offset);
+        Inputs chunk{in.strike + offset, in.years + offset, in.sign + offset,
+                     in.spot, in.rate, in.dividend_yield};
+
+        double active = iv_setup_kernel(count, chunk, options.price.data() + offset, block);
+        for (int iteration = 0; active > 0.0 && iteration < params.max_iterations; ++iteration) {
+            active = iv_step_kernel(count, params.iv_tolerance, block);
+        }
+        std::copy(block.sigma, block.sigma + count, iv.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+}
+
+void compute_greeks(const OptionColumns& options, const std::vector<double>& volatility,
+                    const GreeksParams& params, GreeksColumns& out) {
+    const std::size_t n = options.size();
+    out.resize(n);
+    if (volatility.size() < n) {
+        std::fill(out.theoretical.begin(), out.theoretical.end(), nan_value);
+        return;
+    }
+    if (out.iv.data() != volatility.data()) {
+        std::copy(volatility.begin(), volatility.begin() + static_cast<std::ptrdiff_t>(n), out.iv.begin());
+    }
+    greeks_kernel(n, make_inputs(options, params), volatility.data(),
+                  out.theoretical.data(), out.delta.data(), out.gamma.data(), out.theta.data(),
+                  out.vega.data(), out.rho.data());
+}
+
+GreeksColumns analyze_chain(const OptionColumns& options, const GreeksParams& params) {
+    GreeksColumns out;
+    compute_implied_volatility(options, params, out.iv);
+    compute_greeks(options, out.iv, params, out);
+    return out;
+}
+
+GreeksColumns refresh_greeks(OptionChain& chain, const GreeksParams& params,
+                             std::chrono::system_clock::time_point now) {
+    auto columns = OptionColumns::from_chain(chain, now);
+    auto out = analyze_chain(columns, params);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        if (!std::isfinite(out.iv[i])) {
+            continue;
+        }
+        auto& quote = chain.options[columns.source_index[i]];
+        quote.mid_iv = out.iv[i];
+        quote.delta = out.delta[i];
+        quote.gamma = out.gamma[i];
+        quote.theta = out.theta[i];
+        quote.vega = out.vega[i];
+        quote.rho = out.rho[i];
+    }
+    return out;
+}
+
+const char* greeks_kernel_isa() {
+#if OQD_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("x86-64-v4")) {
+        return "avx512";
+    }
+    if (__builtin_cpu_supports("x86-64-v3")) {
+        return "avx2";
+    }
+#endif
+    return "scalar";
+}
+
+} // namespace oqd
@@ -69,7 +69,11 @@ Quote Quote::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string Quote::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void Quote::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .set_fixed().set_precision(2)
         .field("symbol", symbol)
         .field("description", description)
@@ -104,8 +108,7 @@ std::string Quote::to_json() const {
         .field_optional("gamma", gamma)
         .field_optional("theta", theta)
         .field_optional("vega", vega)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 } // namespace oqd
\ No newline at end of file
@@ -0,0 +1,338 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/market/time_sales_series.hpp"
+#include "oqdTradierpp/utils.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <string_view>
+
+namespace oqd {
+
+namespace {
+
+constexpr std::int64_t nanos_per_second = 1'000'000'000;
+
+int parse_digits(std::string_view text, std::size_t pos, std::size_t count) {
+    int value = 0;
+    for (std::size_t i = pos; i < pos + count; ++i) {
+        char c = text[i];
+        if (c < '0' || c > '9') {
+            return -1;
+        }
+        value = value * 10 + (c - '0');
+    }
+    return value;
+}
+
+// Seconds to add to US Eastern wall-clock time to get UTC: 4 hours from 2:00
+// on the second Sunday in March to 2:00 on the first Sunday in November, 5
+// otherwise.
+std::int64_t eastern_to_utc_seconds(std::chrono::sys_days date, std::int64_t seconds_of_day) {
+    using namespace std::chrono;
+    year_month_day ymd{date};
+    auto dst_start = sys_days{ymd.year() / March / Sunday[2]} + hours{2};
+    auto dst_end = sys_days{ymd.year() / November / Sunday[1]} + hours{2};
+    auto local = date + seconds{seconds_of_day};
+    return (local >= dst_start && local < dst_end) ? 4 * 3600 : 5 * 3600;
+}
+
+// "YYYY-MM-DDTHH:MM:SS" in exchange time (US Eastern), as Tradier sends it.
+// Only used when a row has no timestamp.
+std::int64_t parse_time(std::string_view text) {
+    auto date = utils::parse_iso_date(text);
+    if (!date || text.size() < 19 || (text[10] != 'T' && text[10] != ' ') || text[13] != ':' || text[16] != ':') {
+        return 0;
+    }
+    int hour = parse_digits(text, 11, 2);
+    int minute = parse_digits(text, 14, 2);
+    int second = parse_digits(text, 17, 2);
+    if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59) {
+        return 0;
+    }
+    std::int64_t seconds_of_day = hour * 3600 + minute * 60 + second;
+    auto seconds = std::chrono::sys_seconds{*date}.time_since_epoch().count() + seconds_of_day +
+                   eastern_to_utc_seconds(*date, seconds_of_day);
+    return seconds * nanos_per_second;
+}
+
+double field_or(double value, double fallback) {
+    return std::isnan(value) ? fallback : value;
+}
+
+std::int64_t floor_div(std::int64_t value, std::int64_t divisor) {
+    std::int64_t quotient = value / divisor;
+    return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+}
+
+} // namespace
+
+void TimeSalesSeries::reserve(std::size_t n) {
+    timestamp_ns.reserve(n);
+    price.reserve(n);
+    open.reserve(n);
+    high.reserve(n);
+    low.reserve(n);
+    close.reserve(n);
+    volume.reserve(n);
+    vwap.reserve(n);
+}
+
+void TimeSalesSeries::clear() {
+    timestamp_ns.clear();
+    price.clear();
+    open.clear();
+    high.clear();
+    low.clear();
+    close.clear();
+    volume.clear();
+    vwap.clear();
+}
+
+void TimeSalesSeries::push_back(std::int64_t time_ns, double trade_price, double bar_open, double bar_high,
+                                double bar_low, double bar_close, double bar_volume, double bar_vwap) {
+    timestamp_ns.push_back(time_ns);
+    price.push_back(trade_price);
+    open.push_back(bar_open);
+    high.push_back(bar_high);
+    low.push_back(bar_low);
+    close.push_back(bar_close);
+    volume.push_back(bar_volume);
+    vwap.push_back(bar_vwap);
+}
+
+void TimeSalesSeries::append_json(const simdjson::dom::element& elem) {
+    if (elem.is_array()) {
+        simdjson::dom::array rows = elem.get_array().value_unsafe();
+        reserve(size() + rows.size());
+        for (auto row : rows) {
+            append_json(row);
+        }
+        return;
+    }
+    if (!elem.is_object()) {
+        return;
+    }
+
+    auto series = elem["series"];
+    if (series.error() == simdjson::SUCCESS) {
+        append_json(series.value_unsafe());
+        return;
+    }
+    auto data = elem["data"];
+    if (data.error() == simdjson::SUCCESS) {
+        append_json(data.value_unsafe());
+        return;
+    }
+
+    // One pass over the row's fields; "time" is only read as a view.
+    constexpr double missing = std::numeric_limits<double>::quiet_NaN();
+    double timestamp = missing;
+    double row_price = missing;
+    double row_open = missing;
+    double row_high = missing;
+    double row_low = missing;
+    double row_close = missing;
+    double row_volume = 0.0;
+    double row_vwap = missing;
+    std::string_view row_time;
+
+    simdjson::dom::object row = elem.get_object().value_unsafe();
+    for (auto field : row) {
+        std::string_view key = field.key;
+        if (key == "time") {
+            if (field.value.is_string()) {
+                row_time = field.value.get_string().value_unsafe();
+            }
+            continue;
+        }
+        double value = 0.0;
+        if (field.value.get_double().get(value) != simdjson::SUCCESS) {
+            continue;
+        }
+        if (key == "timestamp") {
+            timestamp = value;
+        } else if (key == "price") {
+            row_price = value;
+        } else if (key == "open") {
+            row_open = value;
+        } else if (key == "high") {
+            row_high = value;
+        } else if (key == "low") {
+            row_low = value;
+        } else if (key == "close") {
+            row_close = value;
+        } else if (key == "volume") {
+            row_volume = value;
+        } else if (key == "vwap") {
+            row_vwap = value;
+        }
+    }
+
+    std::int64_t time_ns = std::isnan(timestamp)
+        ? parse_time(row_time)
+        : static_cast<std::int64_t>(std::llround(timestamp * static_cast<double>(nanos_per_second)));
+    row_price = field_or(row_price, field_or(row_close, 0.0));
+    push_back(time_ns, row_price, field_or(row_open, row_price), field_or(row_high, row_price),
+              field_or(row_low, row_price), field_or(row_close, row_price), row_volume,
+              field_or(row_vwap, row_price));
+}
+
+TimeSalesSeries TimeSalesSeries::from_json(const simdjson::dom::element& elem) {
+    TimeSalesSeries series;
+    series.append_json(elem);
+    return series;
+}
+
+TimeSalesSeries TimeSalesSeries::from_records(const std::vector<TimeSales>& records) {
+    TimeSalesSeries series;
+    series.reserve(records.size());
+    for (const auto& record : records) {
+        series.push_back(static_cast<std::int64_t>(std::llround(record.timestamp * static_cast<double>(nanos_per_second))),
+                         record.price, record.open, record.high, record.low, record.close,
+                         record.volume, record.vwap);
+    }
+    return series;
+}
+
+std::vector<TimeSales> TimeSalesSeries::to_records() const {
+    std::vector<TimeSales> records(size());
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        auto seconds = floor_div(timestamp_ns[i], nanos_per_second);
+        auto days = std::chrono::floor<std::chrono::days>(std::chrono::sys_seconds{std::chrono::seconds{seconds}});
+        std::chrono::year_month_day ymd{days};
+        std::chrono::hh_mm_ss clock{std::chrono::seconds{seconds} - days.time_since_epoch()};
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02uT%02d:%02d:%02d", static_cast<int>(ymd.year()),
+                      static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()),
+                      static_cast<int>(clock.hours().count()), static_cast<int>(clock.minutes().count()),
+                      static_cast<int>(clock.seconds().count()));
+
+        auto& record = records[i];
+        record.time = buffer;
+        record.timestamp = static_cast<double>(timestamp_ns[i]) / static_cast<double>(nanos_per_second);
+        record.price = price[i];
+        record.open = open[i];
+        record.high = high[i];
+        record.low = low[i];
+        record.close = close[i];
+        record.volume = volume[i];
+        record.vwap = vwap[i];
+    }
+    return records;
+}
+
+std::size_t TimeSalesSeries::lower_bound(std::int64_t time_ns) const {
+    return static_cast<std::size_t>(
+        std::lower_bound(timestamp_ns.begin(), timestamp_ns.end(), time_ns) - timestamp_ns.begin());
+}
+
+// The reductions keep four independent accumulators so the compiler can pack
+// them into vector registers without reassociating a single running sum.
+double TimeSalesSeries::total_volume(std::size_t begin, std::size_t end) const {
+    end = std::min(end, size());
+    const double* v = volume.data();
+    double acc[4] = {0.0, 0.0, 0.0, 0.0};
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        acc[0] += v[i];
+        acc[1] += v[i + 1];
+        acc[2] += v[i + 2];
+        acc[3] += v[i + 3];
+    }
+    for (; i < end; ++i) {
+        acc[0] += v[i];
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+double TimeSalesSeries::volume_weighted_price(std::size_t begin, std::size_t end) const {
+    end = std::min(end, size());
+    const double* p = vwap.data();
+    const double* v = volume.data();
+    double notional[4] = {0.0, 0.0, 0.0, 0.0};
+    double shares[4] = {0.0, 0.0, 0.0, 0.0};
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            notional[lane] += p[i + lane] * v[i + lane];
+            shares[lane] += v[i + lane];
+        }
+    }
+    for (; i < end; ++i) {
+        notional[0] += p[i] * v[i];
+        shares[0] += v[i];
+    }
+    double total_shares = (shares[0] + shares[1]) + (shares[2] + shares[3]);
+    if (total_shares <= 0.0) {
+        return 0.0;
+    }
+    return ((notional[0] + notional[1]) + (notional[2] + notional[3])) / total_shares;
+}
+
+TimeSalesSeries::PriceRange TimeSalesSeries::range(std::size_t begin, std::size_t end) const {
+    end = std::min(end, size());
+    if (begin >= end) {
+        return {};
+    }
+    const double* lo = low.data();
+    const double* hi = high.data();
+    double min_lane[4];
+    double max_lane[4];
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+        min_lane[lane] = lo[begin];
+        max_lane[lane] = hi[begin];
+    }
+    std::size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            min_lane[lane] = lo[i + lane] < min_lane[lane] ? lo[i + lane] : min_lane[lane];
+            max_lane[lane] = hi[i + lane] > max_lane[lane] ? hi[i + lane] : max_lane[lane];
+        }
+    }
+    for (; i < end; ++i) {
+        min_lane[0] = lo[i] < min_lane[0] ? lo[i] : min_lane[0];
+        max_lane[0] = hi[i] > max_lane[0] ? hi[i] : max_lane[0];
+    }
+    return {std::min({min_lane[0], min_lane[1], min_lane[2], min_lane[3]}),
+            std::max({max_lane[0], max_lane[1], max_lane[2], max_lane[3]})};
+}
+
+TimeSalesSeries TimeSalesSeries::resample(std::chrono::nanoseconds bucket) const {
+    TimeSalesSeries bars;
+    std::int64_t width = bucket.count();
+    if (width <= 0 || empty()) {
+        return bars;
+    }
+
+    std::size_t begin = 0;
+    while (begin < size()) {
+        std::int64_t start = floor_div(timestamp_ns[begin], width) * width;
+        std::size_t end = begin + 1;
+        while (end < size() && timestamp_ns[end] < start + width) {
+            ++end;
+        }
+
+        auto bar_range = range(begin, end);
+        double bar_volume = total_volume(begin, end);
+        double bar_vwap = bar_volume > 0.0 ? volume_weighted_price(begin, end) : close[end - 1];
+        bars.push_back(start, close[end - 1], open[begin], bar_range.high, bar_range.low, close[end - 1],
+                       bar_volume, bar_vwap);
+        begin = end;
+    }
+    return bars;
+}
+
+} // namespace oqd
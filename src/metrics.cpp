@@ -0,0 +1,566 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/metrics.hpp"
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+
+namespace oqd {
+
+std::string_view to_string(EndpointGroup group) {
+    switch (group) {
+        case EndpointGroup::Auth: return "auth";
+        case EndpointGroup::User: return "user";
+        case EndpointGroup::Accounts: return "accounts";
+        case EndpointGroup::Trading: return "trading";
+        case EndpointGroup::Markets: return "markets";
+        case EndpointGroup::Options: return "options";
+        case EndpointGroup::Fundamentals: return "fundamentals";
+        case EndpointGroup::Watchlists: return "watchlists";
+        case EndpointGroup::Streaming: return "streaming";
+        default: return "other";
+    }
+}
+
+std::string_view to_string(RequestPhase phase) {
+    switch (phase) {
+        case RequestPhase::Dns: return "dns";
+        case RequestPhase::Connect: return "connect";
+        case RequestPhase::Tls: return "tls";
+        case RequestPhase::TimeToFirstByte: return "ttfb";
+        case RequestPhase::Decompress: return "decompress";
+        case RequestPhase::Parse: return "parse";
+        case RequestPhase::Total: return "total";
+        default: return "unknown";
+    }
+}
+
+EndpointGroup classify_endpoint(std::string_view method, std::string_view path) {
+    auto scheme = path.find("://");
+    if (scheme != std::string_view::npos) {
+        auto slash = path.find('/', scheme + 3);
+        path = slash == std::string_view::npos ? std::string_view{} : path.substr(slash);
+    }
+    auto query = path.find('?');
+    if (query != std::string_view::npos) {
+        path = path.substr(0, query);
+    }
+
+    auto starts_with = [&path](std::string_view prefix) {
+        return path.substr(0, prefix.size()) == prefix;
+    };
+
+    if (starts_with("/oauth/")) return EndpointGroup::Auth;
+    if (starts_with("/v1/user/")) return EndpointGroup::User;
+    if (starts_with("/v1/accounts/")) {
+        if (path.find("/events") != std::string_view::npos) return EndpointGroup::Streaming;
+        if (method != "GET" && path.find("/orders") != std::string_view::npos) return EndpointGroup::Trading;
+        return EndpointGroup::Accounts;
+    }
+    if (starts_with("/v1/markets/events")) return EndpointGroup::Streaming;
+    if (starts_with("/v1/markets/options/")) return EndpointGroup::Options;
+    if (starts_with("/v1/markets/")) return EndpointGroup::Markets;
+    if (starts_with("/beta/markets/fundamentals/")) return EndpointGroup::Fundamentals;
+    if (starts_with("/v1/watchlists")) return EndpointGroup::Watchlists;
+    return EndpointGroup::Other;
+}
+
+std::uint64_t EndpointGroupMetrics::error_count() const {
+    std::uint64_t total = 0;
+    for (const auto& [status, count] : errors_by_status) {
+        total += count;
+    }
+    return total;
+}
+
+std::uint64_t MetricsSnapshot::total_requests() const {
+    std::uint64_t total = 0;
+    for (const auto& g : groups) {
+        total += g.requests;
+    }
+    return total;
+}
+
+std::uint64_t MetricsSnapshot::total_errors() const {
+    std::uint64_t total = 0;
+    for (const auto& g : groups) {
+        total += g.error_count();
+    }
+    return total;
+}
+
+namespace {
+
+// Single-writer counter: only the owning thread increments, readers merge.
+// A relaxed load/store pair avoids the locked read-modify-write of fetch_add.
+struct Counter {
+    std::atomic<std::uint64_t> value{0};
+
+    void add(std::uint64_t n) {
+        value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+    std::uint64_t get() const { return value.load(std::memory_order_relaxed); }
+};
+
+struct PhaseCounters {
+    Counter count;
+    Counter total_ns;
+    std::array<Counter, metrics::bucket_count> buckets;
+};
+
+struct GroupCounters {
+    Counter requests;
+    Counter completed;
+    Counter bytes_in;
+    Counter bytes_out;
+    Counter decoded_bytes;
+    Counter rate_limit_waits;
+    Counter rate_limit_wait_ns;
+    Counter coalesced;
+    Counter reused_connections;
+    std::array<Counter, metrics::status_slots> errors;
+    std::array<PhaseCounters, metrics::phase_count> phases;
+};
+
+std::size_t bucket_index(std::chrono::nanoseconds duration) {
+    auto micros = static_cast<std::uint64_t>(std::max<std::int64_t>(0, duration.count() / 1000));
+    auto it = std::lower_bound(metrics::bucket_bounds_us.begin(), metrics::bucket_bounds_us.end(), micros);
+    return static_cast<std::size_t>(it - metrics::bucket_bounds_us.begin());
+}
+
+std::size_t status_slot(int http_status) {
+    if (http_status < metrics::min_error_status || http_status > metrics::max_error_status) {
+        return metrics::status_slots - 1;
+    }
+    return static_cast<std::size_t>(http_status - metrics::min_error_status);
+}
+
+int slot_status(std::size_t slot) {
+    return slot == metrics::status_slots - 1 ? 0 : metrics::min_error_status + static_cast<int>(slot);
+}
+
+std::atomic<std::uint64_t> next_registry_id{1};
+
+} // namespace
+
+struct MetricsRegistry::Shard {
+    std::array<GroupCounters, metrics::group_count> groups;
+};
+
+struct MetricsRegistry::State {
+    std::uint64_t id = next_registry_id.fetch_add(1, std::memory_order_relaxed);
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<Shard>> shards;
+    std::vector<Shard*> free_shards;
+
+    Shard* acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!free_shards.empty()) {
+            Shard* shard = free_shards.back();
+            free_shards.pop_back();
+            return shard;
+        }
+        shards.push_back(std::make_unique<Shard>());
+        return shards.back().get();
+    }
+
+    void release(Shard* shard) {
+        std::lock_guard<std::mutex> lock(mutex);
+        free_shards.push_back(shard);
+    }
+};
+
+namespace {
+
+// Per-thread bindings from registry to shard. When the thread exits its shards
+// are handed back to the registries that are still alive so the counters keep
+// accumulating under the next thread that records.
+struct ThreadShards {
+    struct Binding {
+        std::uint64_t registry_id;
+        std::weak_ptr<MetricsRegistry::State> state;
+        MetricsRegistry::Shard* shard;
+    };
+    std::vector<Binding> bindings;
+
+    ~ThreadShards() {
+        for (auto& binding : bindings) {
+            if (auto state = binding.state.lock()) {
+                state->release(binding.shard);
+            }
+        }
+    }
+};
+
+thread_local ThreadShards thread_shards;
+
+} // namespace
+
+MetricsRegistry::MetricsRegistry()
+    : state_(std::make_shared<State>()) {
+}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry::Shard& MetricsRegistry::local_shard() {
+    auto& bindings = thread_shards.bindings;
+    for (const auto& binding : bindings) {
+        if (binding.registry_id == state_->id) {
+            return *binding.shard;
+        }
+    }
+
+    // Drop bindings to registries that no longer exist before adding ours.
+    bindings.erase(std::remove_if(bindings.begin(), bindings.end(),
+                                  [](const ThreadShards::Binding& b) { return b.state.expired(); }),
+                   bindings.end());
+
+    Shard* shard = state_->acquire();
+    bindings.push_back({state_->id, state_, shard});
+    return *shard;
+}
+
+void MetricsRegistry::record_request_start(EndpointGroup group) {
+    local_shard().groups[static_cast<std::size_t>(group)].requests.add(1);
+}
+
+void MetricsRegistry::record_request_end(EndpointGroup group, int http_status) {
+    auto& counters = local_shard().groups[static_cast<std::size_t>(group)];
+    counters.completed.add(1);
+    if (http_status == 0 || http_status >= metrics::min_error_status) {
+        counters.errors[status_slot(http_status)].add(1);
+    }
+}
+
+void MetricsRegistry::record_phase(EndpointGroup group, RequestPhase phase, std::chrono::nanoseconds duration) {
+    auto& counters = local_shard().groups[static_cast<std::size_t>(group)].phases[static_cast<std::size_t>(phase)];
+    counters.count.add(1);
+    counters.total_ns.add(static_cast<std::uint64_t>(std::max<std::int64_t>(0, duration.count())));
+    counters.buckets[bucket_index(duration)].add(1);
+}
+
+void MetricsRegistry::record_bytes(EndpointGroup group, std::uint64_t bytes_in, std::uint64_t bytes_out) {
+    auto& counters = local_shard().groups[static_cast<std::size_t>(group)];
+    counters.bytes_in.add(bytes_in);
+    counters.bytes_out.add(bytes_out);
+}
+
+void MetricsRegistry::record_rate_limit_wait(EndpointGroup group, std::chrono::nanoseconds waited) {
+    auto& counters = local_shard().groups[static_cast<std::size_t>(group)];
+    counters.rate_limit_waits.add(1);
+    counters.rate_limit_wait_ns.add(static_cast<std::uint64_t>(std::max<std::int64_t>(0, waited.count())));
+}
+
+void MetricsRegistry::record_coalesced(EndpointGroup group) {
+    local_shard().groups[static_cast<std::size_t>(group)].coalesced.add(1);
+}
+
+void MetricsRegistry::record_connection_reused(EndpointGroup group) {
+    local_shard().groups[static_cast<std::size_t>(group)].reused_connections.add(1);
+}
+
+void MetricsRegistry::record_decompression(EndpointGroup group, std::uint64_t decoded_bytes,
+                                           std::chrono::nanoseconds duration) {
+    local_shard().groups[static_cast<std::size_t>(group)].decoded_bytes.add(decoded_bytes);
+    record_phase(group, RequestPhase::Decompress, duration);
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot snap;
+    snap.taken_at = std::chrono::system_clock::now();
+    for (std::size_t g = 0; g < metrics::group_count; ++g) {
+        snap.groups[g].group = static_cast<EndpointGroup>(g);
+    }
+
+    std::array<std::uint64_t, metrics::group_count> completed{};
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    for (const auto& shard : state_->shards) {
+        for (std::size_t g = 0; g < metrics::group_count; ++g) {
+            const auto& src = shard->groups[g];
+            auto& dst = snap.groups[g];
+
+            dst.requests += src.requests.get();
+            completed[g] += src.completed.get();
+            dst.bytes_in += src.bytes_in.get();
+            dst.bytes_out += src.bytes_out.get();
+            dst.decoded_bytes += src.decoded_bytes.get();
+            dst.rate_limit_waits += src.rate_limit_waits.get();
+            dst.rate_limit_wait_time += std::chrono::nanoseconds(src.rate_limit_wait_ns.get());
+            dst.coalesced_requests += src.coalesced.get();
+            dst.reused_connections += src.reused_connections.get();
+
+            for (std::size_t s = 0; s < metrics::status_slots; ++s) {
+                auto count = src.errors[s].get();
+                if (count > 0) {
+                    dst.errors_by_status[slot_status(s)] += count;
+                }
+            }
+
+            for (std::size_t p = 0; p < metrics::phase_count; ++p) {
+                const auto& src_phase = src.phases[p];
+                auto& dst_phase = dst.phases[p];
+                dst_phase.count += src_phase.count.get();
+                dst_phase.total += std::chrono::nanoseconds(src_phase.total_ns.get());
+                for (std::size_t b = 0; b < metrics::bucket_count; ++b) {
+                    dst_phase.buckets[b] += src_phase.buckets[b].get();
+                }
+            }
+        }
+    }
+
+    // Start and end of a request may be recorded by different threads, so the
+    // in-flight gauge is derived from the merged totals rather than kept per shard.
+    for (std::size_t g = 0; g < metrics::group_count; ++g) {
+        snap.groups[g].in_flight = static_cast<std::int64_t>(snap.groups[g].requests) -
+                                   static_cast<std::int64_t>(completed[g]);
+    }
+
+    return snap;
+}
+
+RequestMetricsScope::RequestMetricsScope(MetricsRegistry* registry, EndpointGroup group)
+    : registry_(registry)
+    , group_(group)
+    , start_(clock::now())
+    , last_mark_(start_) {
+    if (registry_) {
+        registry_->record_request_start(group_);
+    }
+}
+
+RequestMetricsScope::~RequestMetricsScope() {
+    if (registry_) {
+        registry_->record_phase(group_, RequestPhase::Total, clock::now() - start_);
+        registry_->record_request_end(group_, status_);
+    }
+}
+
+void RequestMetricsScope::mark(RequestPhase phase) {
+    auto now = clock::now();
+    if (registry_) {
+        registry_->record_phase(group_, phase, now - last_mark_);
+    }
+    last_mark_ = now;
+}
+
+void RequestMetricsScope::add_bytes(std::uint64_t bytes_in, std::uint64_t bytes_out) {
+    if (registry_) {
+        registry_->record_bytes(group_, bytes_in, bytes_out);
+    }
+}
+
+namespace {
+
+void append_number(std::string& out, std::uint64_t value) {
+    std::array<char, 24> buf;
+    auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), value);
+    out.append(buf.data(), ptr - buf.data());
+}
+
+void append_number(std::string& out, std::int64_t value) {
+    std::array<char, 24> buf;
+    auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(), value);
+    out.append(buf.data(), ptr - buf.data());
+}
+
+void append_seconds(std::string& out, std::chrono::nanoseconds value) {
+    std::array<char, 32> buf;
+    auto [ptr, ec] = std::to_chars(buf.data(), buf.data() + buf.size(),
+                                   static_cast<double>(value.count()) / 1e9);
+    out.append(buf.data(), ptr - buf.data());
+}
+
+void append_header(std::string& out, std::string_view prefix, std::string_view name,
+                   std::string_view type, std::string_view help) {
+    out += "# HELP ";
+    out += prefix;
+    out += name;
+    out += ' ';
+    out += help;
+    out += "\n# TYPE ";
+    out += prefix;
+    out += name;
+    out += ' ';
+    out += type;
+    out += '\n';
+}
+
+void append_series(std::string& out, std::string_view prefix, std::string_view name, EndpointGroup group) {
+    out += prefix;
+    out += name;
+    out += "{group=\"";
+    out += to_string(group);
+    out += '"';
+}
+
+} // namespace
+
+std::string to_prometheus(const MetricsSnapshot& snapshot, std::string_view prefix_view) {
+    std::string prefix(prefix_view);
+    if (!prefix.empty() && prefix.back() != '_') {
+        prefix += '_';
+    }
+
+    std::vector<const EndpointGroupMetrics*> active;
+    for (const auto& g : snapshot.groups) {
+        if (!g.empty()) {
+            active.push_back(&g);
+        }
+    }
+
+    std::string out;
+    out.reserve(1024 + active.size() * 4096);
+
+    append_header(out, prefix, "requests_total", "counter", "Requests issued per endpoint group.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "requests_total", g->group);
+        out += "} ";
+        append_number(out, g->requests);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "requests_in_flight", "gauge", "Requests currently in flight per endpoint group.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "requests_in_flight", g->group);
+        out += "} ";
+        append_number(out, g->in_flight);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "errors_total", "counter",
+                  "Failed requests by HTTP status; status=\"transport\" covers network failures.");
+    for (const auto* g : active) {
+        for (const auto& [status, count] : g->errors_by_status) {
+            append_series(out, prefix, "errors_total", g->group);
+            out += ",status=\"";
+            if (status == 0) {
+                out += "transport";
+            } else {
+                append_number(out, static_cast<std::int64_t>(status));
+            }
+            out += "\"} ";
+            append_number(out, count);
+            out += '\n';
+        }
+    }
+
+    append_header(out, prefix, "received_bytes_total", "counter", "Bytes read from the wire.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "received_bytes_total", g->group);
+        out += "} ";
+        append_number(out, g->bytes_in);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "decoded_bytes_total", "counter",
+                  "Response body bytes after gzip/deflate decoding; compare with received_bytes_total.");
+    for (const auto* g : active) {
+        if (g->decoded_bytes == 0) {
+            continue;
+        }
+        append_series(out, prefix, "decoded_bytes_total", g->group);
+        out += "} ";
+        append_number(out, g->decoded_bytes);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "sent_bytes_total", "counter", "Bytes written to the wire.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "sent_bytes_total", g->group);
+        out += "} ";
+        append_number(out, g->bytes_out);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "rate_limit_waits_total", "counter", "Requests delayed or rejected by rate limiting.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "rate_limit_waits_total", g->group);
+        out += "} ";
+        append_number(out, g->rate_limit_waits);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "rate_limit_wait_seconds_total", "counter", "Time spent waiting on rate limits.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "rate_limit_wait_seconds_total", g->group);
+        out += "} ";
+        append_seconds(out, g->rate_limit_wait_time);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "coalesced_requests_total", "counter", "Requests answered by joining an identical request in flight.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "coalesced_requests_total", g->group);
+        out += "} ";
+        append_number(out, g->coalesced_requests);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "reused_connections_total", "counter",
+                  "Requests sent on a pooled keep-alive connection instead of a new TLS session.");
+    for (const auto* g : active) {
+        append_series(out, prefix, "reused_connections_total", g->group);
+        out += "} ";
+        append_number(out, g->reused_connections);
+        out += '\n';
+    }
+
+    append_header(out, prefix, "request_phase_seconds", "histogram",
+                  "Request latency broken down by phase (dns, connect, tls, ttfb, decompress, parse, total).");
+    for (const auto* g : active) {
+        for (std::size_t p = 0; p < metrics::phase_count; ++p) {
+            const auto& stats = g->phases[p];
+            if (stats.count == 0) {
+                continue;
+            }
+            auto phase_name = to_string(static_cast<RequestPhase>(p));
+
+            std::uint64_t cumulative = 0;
+            for (std::size_t b = 0; b < metrics::bucket_count; ++b) {
+                cumulative += stats.buckets[b];
+                append_series(out, prefix, "request_phase_seconds_bucket", g->group);
+                out += ",phase=\"";
+                out += phase_name;
+                out += "\",le=\"";
+                if (b < metrics::bucket_bounds_us.size()) {
+                    append_seconds(out, std::chrono::microseconds(metrics::bucket_bounds_us[b]));
+                } else {
+                    out += "+Inf";
+                }
+                out += "\"} ";
+                append_number(out, cumulative);
+                out += '\n';
+            }
+
+            append_series(out, prefix, "request_phase_seconds_sum", g->group);
+            out += ",phase=\"";
+            out += phase_name;
+            out += "\"} ";
+            append_seconds(out, stats.total);
+            out += '\n';
+
+            append_series(out, prefix, "request_phase_seconds_count", g->group);
+            out += ",phase=\"";
+            out += phase_name;
+            out += "\"} ";
+            append_number(out, stats.count);
+            out += '\n';
+        }
+    }
+
+    return out;
+}
+
+} // namespace oqd
\ No newline at end of file
@@ -12,6 +12,7 @@
 */
 
 #include "oqdTradierpp/client.hpp"
+#include "oqdTradierpp/core/json_array_splitter.hpp"
 #include <sstream>
 #include <regex>
 #include <boost/url/url.hpp>
@@ -22,15 +23,61 @@
 
 namespace oqd {
 
+namespace {
+
+// Upper bound on a response body; a larger Content-Length is rejected before
+// any buffer is reserved.
+constexpr std::uint64_t max_response_body_bytes = std::uint64_t{1} << 30;
+
+std::string_view body_view(const std::string& body) {
+    return body;
+}
+
+std::string_view body_view(const PaddedBuffer& body) {
+    return body.view();
+}
+
+} // namespace
+
 TradierClient::TradierClient(Environment env) 
     : environment_(env)
+    , toggles_(std::make_unique<RuntimeToggles>())
+    , rate_limits_(std::make_unique<RateLimitTable>())
     , io_context_(std::make_unique<boost::asio::io_context>())
     , ssl_context_(std::make_unique<boost::asio::ssl::context>(boost::asio::ssl::context::tlsv12_client))
+    , metrics_(std::make_unique<MetricsRegistry>())
+    , in_flight_gets_(std::make_unique<SingleFlight<std::shared_ptr<const SharedResponse>>>())
+    , body_buffers_(std::make_unique<PaddedBufferPool>())
+    , connections_(std::make_unique<ConnectionPool<TlsStream>>())
 {
     update_base_url();
     initialize_ssl_context();
 }
 
+TradierClient& TradierClient::operator=(TradierClient&& other) noexcept {
+    if (this != &other) {
+        // Idle streams are bound to io_context_ and ssl_context_; close them
+        // before either is replaced.
+        connections_.reset();
+        environment_ = other.environment_;
+        base_url_ = std::move(other.base_url_);
+        websocket_url_ = std::move(other.websocket_url_);
+        access_token_ = std::move(other.access_token_);
+        client_id_ = std::move(other.client_id_);
+        client_secret_ = std::move(other.client_secret_);
+        toggles_ = std::move(other.toggles_);
+        rate_limits_ = std::move(other.rate_limits_);
+        io_context_ = std::move(other.io_context_);
+        ssl_context_ = std::move(other.ssl_context_);
+        json_parser_ = std::move(other.json_parser_);
+        metrics_ = std::move(other.metrics_);
+        in_flight_gets_ = std::move(other.in_flight_gets_);
+        body_buffers_ = std::move(other.body_buffers_);
+        connections_ = std::move(other.connections_);
+    }
+    return *this;
+}
+
 void TradierClient::set_access_token(const std::string& token) {
     access_token_ = token;
 }
@@ -45,6 +92,17 @@ void TradierClient::set_environment(Environment env) {
     update_base_url();
 }
 
+void TradierClient::set_base_url(const std::string& url) {
+    base_url_ = url;
+}
+
+void TradierClient::set_connection_pooling(bool enabled) {
+    toggles_->connection_pooling.store(enabled, std::memory_order_release);
+    if (!enabled) {
+        connections_->clear();
+    }
+}
+
 void TradierClient::update_base_url() {
     switch (environment_) {
         case Environment::Production:
@@ -68,21 +126,31 @@ void TradierClient::initialize_ssl_context() {
         });
 }
 
+TradierClient::PreparedRequest TradierClient::prepare_request(
+    boost::beast::http::verb method,
+    const std::string& endpoint,
+    const std::unordered_map<std::string, std::string>& params,
+    const RequestOptions& options) const {
+    
+    namespace http = boost::beast::http;
+    bool has_body = method == http::verb::post || method == http::verb::put;
+    auto url = has_body ? base_url_ + endpoint : build_url(endpoint, params);
+    auto body = has_body ? build_form_data(params) : std::string();
+    auto method_name = http::to_string(method);
+    
+    return {create_request(method, url, body, AuthType::Bearer, options),
+            classify_endpoint(std::string_view(method_name.data(), method_name.size()), endpoint)};
+}
+
 std::future<simdjson::dom::element> TradierClient::get_async(
     const std::string& endpoint,
     const std::unordered_map<std::string, std::string>& params,
     const RequestOptions& options) {
     
-    auto url = build_url(endpoint, params);
-    auto request = create_request(boost::beast::http::verb::get, url, "", AuthType::Bearer, options);
-    
-    return std::async(std::launch::async, [this, request = std::move(request)]() mutable {
-        auto response = perform_request(std::move(request));
-        auto json_doc = json_parser_.parse(response.body());
-        if (json_doc.error() != simdjson::SUCCESS) {
-            throw ApiException("Failed to parse JSON response");
-        }
-        return json_doc.value();
+    auto prepared = prepare_request(boost::beast::http::verb::get, endpoint, params, options);
+    return std::async(std::launch::async, [this, prepared = std::move(prepared)]() mutable {
+        auto response = perform_request(std::move(prepared.request));
+        return parse_json(response.body(), prepared.group);
     });
 }
 
@@ -91,17 +159,10 @@ std::future<simdjson::dom::element> TradierClient::post_async(
     const std::unordered_map<std::string, std::string>& params,
     const RequestOptions& options) {
     
-    auto url = base_url_ + endpoint;
-    auto body = build_form_data(params);
-    auto request = create_request(boost::beast::http::verb::post, url, body, AuthType::Bearer, options);
-    
-    return std::async(std::launch::async, [this, request = std::move(request)]() mutable {
-        auto response = perform_request(std::move(request));
-        auto json_doc = json_parser_.parse(response.body());
-        if (json_doc.error() != simdjson::SUCCESS) {
-            throw ApiException("Failed to parse JSON response");
-        }
-        return json_doc.value();
+    auto prepared = prepare_request(boost::beast::http::verb::post, endpoint, params, options);
+    return std::async(std::launch::async, [this, prepared = std::move(prepared)]() mutable {
+        auto response = perform_request(std::move(prepared.request));
+        return parse_json(response.body(), prepared.group);
     });
 }
 
@@ -110,17 +171,10 @@ std::future<simdjson::dom::element> TradierClient::put_async(
     const std::unordered_map<std::string, std::string>& params,
     const RequestOptions& options) {
     
-    auto url = base_url_ + endpoint;
-    auto body = build_form_data(params);
-    auto request = create_request(boost::beast::http::verb::put, url, body, AuthType::Bearer, options);
-    
-    return std::async(std::launch::async, [this, request = std::move(request)]() mutable {
-        auto response = perform_request(std::move(request));
-        auto json_doc = json_parser_.parse(response.body());
-        if (json_doc.error() != simdjson::SUCCESS) {
-            throw ApiException("Failed to parse JSON response");
-        }
-        return json_doc.value();
+    auto prepared = prepare_request(boost::beast::http::verb::put, endpoint, params, options);
+    return std::async(std::launch::async, [this, prepared = std::move(prepared)]() mutable {
+        auto response = perform_request(std::move(prepared.request));
+        return parse_json(response.body(), prepared.group);
     });
 }
 
@@ -129,16 +183,100 @@ std::future<simdjson::dom::element> TradierClient::delete_async(
     const std::unordered_map<std::string, std::string>& params,
     const RequestOptions& options) {
     
-    auto url = build_url(endpoint, params);
-    auto request = create_request(boost::beast::http::verb::delete_, url, "", AuthType::Bearer, options);
+    auto prepared = prepare_request(boost::beast::http::verb::delete_, endpoint, params, options);
+    return std::async(std::launch::async, [this, prepared = std::move(prepared)]() mutable {
+        auto response = perform_request(std::move(prepared.request));
+        return parse_json(response.body(), prepared.group);
+    });
+}
+
+simdjson::dom::element TradierClient::parse_json(const std::string& body, EndpointGroup group) {
+    return parse_json(json_parser_, body, group);
+}
+
+simdjson::dom::element TradierClient::parse_json(simdjson::dom::parser& parser, const std::string& body, EndpointGroup group) {
+    auto parse_start = std::chrono::steady_clock::now();
+    auto json_doc = parser.parse(body);
+    metrics_->record_phase(group, RequestPhase::Parse, std::chrono::steady_clock::now() - parse_start);
+    if (json_doc.error() != simdjson::SUCCESS) {
+        throw ApiException("Failed to parse JSON response");
+    }
+    return json_doc.value();
+}
+
+simdjson::dom::element TradierClient::parse_json(simdjson::dom::parser& parser, const PaddedBuffer& body, EndpointGroup group) {
+    auto parse_start = std::chrono::steady_clock::now();
+    // The buffer carries SIMDJSON_PADDING, so simdjson reads it without copying.
+    auto json_doc = parser.parse(reinterpret_cast<const std::uint8_t*>(body.data()), body.size(), false);
+    metrics_->record_phase(group, RequestPhase::Parse, std::chrono::steady_clock::now() - parse_start);
+    if (json_doc.error() != simdjson::SUCCESS) {
+        throw ApiException("Failed to parse JSON response");
+    }
+    return json_doc.value();
+}
+
+simdjson::dom::element TradierClient::fetch_into(simdjson::dom::parser& parser, PreparedRequest prepared) {
+    auto response = perform_request_into<padded_body>(std::move(prepared.request), body_buffers_->acquire());
+    // The DOM keeps its own copy of strings, so the buffer can go straight back.
+    auto element = parse_json(parser, response.body(), prepared.group);
+    body_buffers_->release(std::move(response.body()));
+    return element;
+}
+
+std::shared_ptr<const TradierClient::SharedResponse> TradierClient::fetch_shared(PreparedRequest prepared) {
+    auto shared = std::make_shared<SharedResponse>();
+    shared->root = fetch_into(shared->parser, std::move(prepared));
+    return shared;
+}
+
+std::future<std::size_t> TradierClient::get_streamed_async(
+    const std::string& endpoint,
+    const std::unordered_map<std::string, std::string>& params,
+    std::vector<std::string> array_path,
+    std::function<void(const simdjson::dom::element&)> on_element,
+    const RequestOptions& options) {
     
-    return std::async(std::launch::async, [this, request = std::move(request)]() mutable {
-        auto response = perform_request(std::move(request));
-        auto json_doc = json_parser_.parse(response.body());
-        if (json_doc.error() != simdjson::SUCCESS) {
-            throw ApiException("Failed to parse JSON response");
+    check_rate_limit(endpoint);
+    auto prepared = prepare_request(boost::beast::http::verb::get, endpoint, params, options);
+    return std::async(std::launch::async, [this, prepared = std::move(prepared), array_path = std::move(array_path),
+                                           on_element = std::move(on_element)]() mutable {
+        JsonArraySplitter splitter(std::move(array_path));
+        std::vector<JsonArraySplitter::Range> ranges;
+        simdjson::dom::parser element_parser;
+        std::size_t delivered = 0;
+        std::exception_ptr failure;
+        
+        auto deliver = [&](const PaddedBuffer& body) {
+            if (failure || splitter.done()) {
+                return;
+            }
+            try {
+                ranges.clear();
+                splitter.scan(body.view(), ranges);
+                for (const auto& [begin, end] : ranges) {
+                    // Bytes after `end` are either later body bytes or the
+                    // buffer's padding, so the element parses in place.
+                    auto element = element_parser.parse(reinterpret_cast<const std::uint8_t*>(body.data() + begin),
+                                                        end - begin, false);
+                    if (element.error() != simdjson::SUCCESS) {
+                        throw ApiException("Failed to parse streamed JSON element");
+                    }
+                    on_element(element.value_unsafe());
+                    ++delivered;
+                }
+            } catch (...) {
+                failure = std::current_exception();
+            }
+        };
+        
+        auto buffer = body_buffers_->acquire();
+        buffer.on_append = deliver;
+        auto response = perform_request_into<padded_body>(std::move(prepared.request), std::move(buffer));
+        if (failure) {
+            std::rethrow_exception(failure);
         }
-        return json_doc.value();
+        body_buffers_->release(std::move(response.body()));
+        return delivered;
     });
 }
 
@@ -253,62 +391,156 @@ TradierClient::create_request(boost::beast::http::verb method,
 
 boost::beast::http::response<boost::beast::http::string_body>
 TradierClient::perform_request(boost::beast::http::request<boost::beast::http::string_body> request) {
-    
+    return perform_request_into<boost::beast::http::string_body>(std::move(request), {});
+}
+
+std::unique_ptr<TradierClient::TlsStream> TradierClient::open_connection(const std::string& host,
+                                                                        const std::string& port,
+                                                                        RequestMetricsScope& scope) {
     namespace beast = boost::beast;
-    namespace http = beast::http;
     namespace net = boost::asio;
     using tcp = net::ip::tcp;
-    using ssl_stream = net::ssl::stream<tcp::socket>;
+    
+    tcp::resolver resolver(*io_context_);
+    beast::error_code ec;
+    auto const results = resolver.resolve(host, port, ec);
+    if (ec) {
+        throw ApiException("DNS resolution failed for " + host + ":" + port + " - " + ec.message());
+    }
+    scope.mark(RequestPhase::Dns);
+    
+    auto stream = std::make_unique<TlsStream>(*io_context_, *ssl_context_);
+    
+    if (!SSL_set_tlsext_host_name(stream->native_handle(), host.c_str())) {
+        beast::error_code ssl_ec{static_cast<int>(::ERR_get_error()), net::error::get_ssl_category()};
+        throw ApiException("SSL SNI setup failed: " + ssl_ec.message());
+    }
+    
+    net::connect(beast::get_lowest_layer(*stream), results, ec);
+    if (ec) {
+        throw ApiException("TCP connection failed to " + host + ":" + port + " - " + ec.message());
+    }
+    scope.mark(RequestPhase::Connect);
+    
+    stream->handshake(TlsStream::client, ec);
+    if (ec) {
+        throw ApiException("SSL handshake failed: " + ec.message());
+    }
+    scope.mark(RequestPhase::Tls);
+    return stream;
+}
+
+template<typename Body>
+boost::beast::http::response<Body>
+TradierClient::perform_request_into(boost::beast::http::request<boost::beast::http::string_body> request,
+                                    typename Body::value_type body) {
+    
+    namespace beast = boost::beast;
+    namespace http = beast::http;
     
     boost::url base_url(base_url_);
     std::string host = std::string(base_url.host());
     std::string port = base_url.port().empty() ? "443" : std::string(base_url.port());
+    std::string connection_key = host + ":" + port;
     
-    try {
-        tcp::resolver resolver(*io_context_);
-        beast::error_code ec;
-        auto const results = resolver.resolve(host, port, ec);
-        if (ec) {
-            throw ApiException("DNS resolution failed for " + host + ":" + port + " - " + ec.message());
+    auto group = classify_endpoint(std::string_view(request.method_string().data(), request.method_string().size()),
+                                   std::string_view(request.target().data(), request.target().size()));
+    RequestMetricsScope scope(metrics_.get(), group);
+    
+    if constexpr (std::is_same_v<Body, padded_body>) {
+        if (toggles_->compression.load(std::memory_order_relaxed) && request.find(http::field::accept_encoding) == request.end()) {
+            request.set(http::field::accept_encoding, "gzip, deflate");
         }
+    }
+    bool pooling = toggles_->connection_pooling.load(std::memory_order_acquire);
+    request.keep_alive(pooling);
+    bool may_reuse = pooling && request.method() != http::verb::post;
+    
+    try {
+        std::unique_ptr<TlsStream> stream;
+        beast::flat_buffer buffer;
+        std::optional<http::response_parser<Body>> parser;
+        std::size_t bytes_out = 0;
+        std::size_t bytes_in = 0;
         
-        ssl_stream stream(*io_context_, *ssl_context_);
-        
-        if (!SSL_set_tlsext_host_name(stream.native_handle(), host.c_str())) {
-            beast::error_code ssl_ec{static_cast<int>(::ERR_get_error()), net::error::get_ssl_category()};
-            throw ApiException("SSL SNI setup failed: " + ssl_ec.message());
+        // A pooled connection the server has already closed only shows up as
+        // a failed write or an empty read; that attempt is repeated once on a
+        // fresh connection.
+        for (;;) {
+            stream = may_reuse ? connections_->acquire(connection_key) : nullptr;
+            bool reused = stream != nullptr;
+            if (reused) {
+                metrics_->record_connection_reused(group);
+            } else {
+                stream = open_connection(host, port, scope);
+            }
+            
+            buffer.clear();
+            parser.emplace();
+            parser->get().body() = std::move(body);
+            parser->body_limit(max_response_body_bytes);
+            
+            beast::error_code ec;
+            bytes_out = http::write(*stream, request, ec);
+            if (ec) {
+                if (reused) {
+                    body = std::move(parser->get().body());
+                    may_reuse = false;
+                    continue;
+                }
+                throw ApiException("HTTP write failed: " + ec.message());
+            }
+            bytes_in = http::read_header(*stream, buffer, *parser, ec);
+            if (ec) {
+                if (reused && bytes_in == 0) {
+                    body = std::move(parser->get().body());
+                    may_reuse = false;
+                    continue;
+                }
+                throw ApiException("HTTP read failed: " + ec.message());
+            }
+            break;
         }
+        scope.mark(RequestPhase::TimeToFirstByte);
         
-        net::connect(beast::get_lowest_layer(stream), results, ec);
+        beast::error_code ec;
+        bytes_in += http::read(*stream, buffer, *parser, ec);
         if (ec) {
-            throw ApiException("TCP connection failed to " + host + ":" + port + " - " + ec.message());
+            throw ApiException("HTTP read failed: " + ec.message());
         }
+        scope.add_bytes(bytes_in, bytes_out);
         
-        stream.handshake(ssl_stream::client, ec);
-        if (ec) {
-            throw ApiException("SSL handshake failed: " + ec.message());
+        http::response<Body> response = parser->release();
+        // Pooling may have been switched off while this request was in flight.
+        // A release that races the clear() in set_connection_pooling(false) is
+        // swept by the second check.
+        if (pooling && response.keep_alive() && toggles_->connection_pooling.load(std::memory_order_acquire)) {
+            connections_->release(connection_key, std::move(stream));
+            if (!toggles_->connection_pooling.load(std::memory_order_acquire)) {
+                connections_->clear();
+            }
+        } else {
+            beast::error_code close_ec;
+            stream->shutdown(close_ec);
         }
         
-        http::write(stream, request, ec);
-        if (ec) {
-            throw ApiException("HTTP write failed: " + ec.message());
+        if constexpr (std::is_same_v<Body, padded_body>) {
+            if (response.body().encoded_bytes > 0) {
+                metrics_->record_decompression(group, response.body().size(), response.body().decode_time);
+            }
         }
+        scope.set_status(static_cast<int>(response.result_int()));
         
-        beast::flat_buffer buffer;
-        http::response<http::string_body> response;
-        http::read(stream, buffer, response, ec);
-        if (ec) {
-            throw ApiException("HTTP read failed: " + ec.message());
+        if (response.result_int() == 429) {
+            metrics_->record_rate_limit_wait(group);
         }
         
         if (response.result_int() >= 400) {
-            throw ApiException("HTTP error: " + std::to_string(response.result_int()) + " " + response.body());
+            throw ApiException("HTTP error: " + std::to_string(response.result_int()) + " " +
+                               std::string(body_view(response.body())));
         }
         
-        update_rate_limit("default", response);
-        
-        beast::error_code close_ec;
-        stream.shutdown(close_ec);
+        update_rate_limit(group, response);
         
         return response;
         
@@ -319,57 +551,72 @@ TradierClient::perform_request(boost::beast::http::request<boost::beast::http::s
     }
 }
 
-void TradierClient::check_rate_limit(const std::string& endpoint_group) const {
-    auto it = rate_limits_.find(endpoint_group);
-    if (it != rate_limits_.end()) {
-        const auto& limit = it->second;
-        auto now = std::chrono::steady_clock::now();
-        
-        if (now < limit.expiry && limit.available <= 0) {
-            throw RateLimitException("Rate limit exceeded for " + endpoint_group);
-        }
+template boost::beast::http::response<boost::beast::http::string_body>
+TradierClient::perform_request_into<boost::beast::http::string_body>(
+    boost::beast::http::request<boost::beast::http::string_body>, std::string);
+
+template boost::beast::http::response<padded_body>
+TradierClient::perform_request_into<padded_body>(
+    boost::beast::http::request<boost::beast::http::string_body>, PaddedBuffer);
+
+void TradierClient::check_rate_limit(const std::string& endpoint, std::string_view method) const {
+    auto group = classify_endpoint(method, endpoint);
+    if (is_rate_limited(group)) {
+        metrics_->record_rate_limit_wait(group);
+        throw RateLimitException("Rate limit exceeded for " + endpoint);
     }
 }
 
+bool TradierClient::is_rate_limited(EndpointGroup group) const {
+    auto limit = get_rate_limit(group);
+    return limit && std::chrono::steady_clock::now() < limit->expiry && limit->available <= 0;
+}
+
 bool TradierClient::is_rate_limited(const std::string& endpoint_group) const {
-    auto it = rate_limits_.find(endpoint_group);
-    if (it != rate_limits_.end()) {
-        const auto& limit = it->second;
-        auto now = std::chrono::steady_clock::now();
-        return now < limit.expiry && limit.available <= 0;
+    auto limit = get_rate_limit(endpoint_group);
+    return limit && std::chrono::steady_clock::now() < limit->expiry && limit->available <= 0;
+}
+
+std::optional<RateLimit> TradierClient::get_rate_limit(EndpointGroup group) const {
+    if (group >= EndpointGroup::Count) {
+        return std::nullopt;
     }
-    return false;
+    std::lock_guard<std::mutex> lock(rate_limits_->mutex);
+    return rate_limits_->limits[static_cast<std::size_t>(group)];
 }
 
 std::optional<RateLimit> TradierClient::get_rate_limit(const std::string& endpoint_group) const {
-    auto it = rate_limits_.find(endpoint_group);
-    if (it != rate_limits_.end()) {
-        return it->second;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(EndpointGroup::Count); ++i) {
+        if (to_string(static_cast<EndpointGroup>(i)) == endpoint_group) {
+            return get_rate_limit(static_cast<EndpointGroup>(i));
+        }
     }
-    return std::nullopt;
+    return get_rate_limit(classify_endpoint("GET", endpoint_group));
 }
 
-void TradierClient::update_rate_limit(
-    const std::string& endpoint_group,
-    const boost::beast::http::response<boost::beast::http::string_body>& response) {
-    
+void TradierClient::update_rate_limit(EndpointGroup group, const boost::beast::http::fields& response) {
     auto available_header = response.find("X-Ratelimit-Available");
     auto used_header = response.find("X-Ratelimit-Used");
     auto expiry_header = response.find("X-Ratelimit-Expiry");
     
     if (available_header != response.end() && 
         used_header != response.end() && 
-        expiry_header != response.end()) {
+        expiry_header != response.end() &&
+        group < EndpointGroup::Count) {
         
         RateLimit limit;
         limit.available = std::stoi(std::string(available_header->value()));
         limit.used = std::stoi(std::string(used_header->value()));
         
-        auto expiry_timestamp = std::stoll(std::string(expiry_header->value()));
-        limit.expiry = std::chrono::steady_clock::now() + 
-                      std::chrono::seconds(expiry_timestamp - std::time(nullptr));
+        // X-Ratelimit-Expiry is the window end in Unix epoch milliseconds.
+        auto expiry_ms = std::stoll(std::string(expiry_header->value()));
+        auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        limit.expiry = std::chrono::steady_clock::now() +
+                      std::chrono::milliseconds(std::max<long long>(0, expiry_ms - now_ms));
         
-        rate_limits_[endpoint_group] = limit;
+        std::lock_guard<std::mutex> lock(rate_limits_->mutex);
+        rate_limits_->limits[static_cast<std::size_t>(group)] = limit;
     }
 }
 
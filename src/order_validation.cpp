@@ -12,12 +12,16 @@
 */
 
 #include "oqdTradierpp/validation.hpp"
+#include "oqdTradierpp/core/occ_symbol.hpp"
+#include "oqdTradierpp/trading/spread_analytics.hpp"
 #include <regex>
 #include <algorithm>
 #include <set>
 #include <cmath>
 #include <stdexcept>
 #include <cctype>
+#include <cstdint>
+#include <limits>
 
 namespace oqd {
 
@@ -539,12 +543,7 @@ bool OrderValidator::is_valid_symbol(const std::string& symbol) {
 bool OrderValidator::is_valid_option_symbol(const std::string& option_symbol) {
     // OCC format: AAPL240315C00150000
     // Format: SYMBOL + YYMMDD + C/P + STRIKE (8 digits, 3 decimal places)
-    if (option_symbol.length() < 15) {
-        return false;
-    }
-    
-    std::regex option_pattern("^[A-Z]+[0-9]{6}[CP][0-9]{8}$");
-    return std::regex_match(option_symbol, option_pattern);
+    return OccSymbol::parse(option_symbol).has_value();
 }
 
 bool OrderValidator::is_valid_price(double price) {
@@ -598,6 +597,20 @@ bool OrderValidator::is_valid_price_increment(double price, const std::string& s
     return is_valid_stock_price(price);
 }
 
+Price OrderValidator::tick_size(Price price, const std::string& symbol) {
+    if (is_valid_option_symbol(symbol)) {
+        return price < Price::from_cents(300) ? Price::from_cents(1) : Price::from_cents(5);
+    }
+    return price < Price::from_cents(100) ? Price::from_ticks(1) : Price::from_cents(1);
+}
+
+bool OrderValidator::is_valid_price_increment(Price price, const std::string& symbol) {
+    if (symbol.empty() || price <= Price{}) {
+        return false;
+    }
+    return price.is_multiple_of(tick_size(price, symbol));
+}
+
 bool OrderValidator::is_reasonable_price_range(double price, const std::string& symbol) {
     // Additional reasonableness checks based on symbol characteristics
     if (symbol.empty() || price <= 0.0) {
@@ -765,12 +778,9 @@ bool OrderValidator::is_option_symbol_consistent(const std::string& underlying,
         return false;
     }
     
-    // Check if the option symbol starts with the underlying symbol
-    if (option_symbol.length() < underlying.length()) {
-        return false;
-    }
-    
-    return option_symbol.substr(0, underlying.length()) == underlying;
+    // The whole root must match: "SPY" is not the underlying of "SPYG" contracts
+    auto parsed = OccSymbol::parse(option_symbol);
+    return parsed && parsed->has_root(underlying);
 }
 
 bool OrderValidator::is_spread_type_supported(const std::string& spread_type) {
@@ -783,6 +793,18 @@ bool OrderValidator::is_spread_type_supported(const std::string& spread_type) {
     return supported_spreads.find(spread_type) != supported_spreads.end();
 }
 
+std::string OrderValidator::analyze_spread_strategy(const SpreadOrderRequest& order) {
+    return std::string(to_string(classify_spread(order)));
+}
+
+double OrderValidator::calculate_spread_max_profit(const SpreadOrderRequest& order) {
+    return RiskAnalyzer::analyze_spread_order(order).max_profit;
+}
+
+double OrderValidator::calculate_spread_max_loss(const SpreadOrderRequest& order) {
+    return RiskAnalyzer::analyze_spread_order(order).max_loss;
+}
+
 double OrderValidator::calculate_max_loss_otoco(const OTOCOOrderRequest& order) {
     if (order.primary_order.price.has_value() && order.stop_order.stop.has_value()) {
         double entry_price = order.primary_order.price.value();
@@ -912,4 +934,120 @@ OrderBuilder::SpreadBuilder OrderBuilder::create_spread_order() {
     return SpreadBuilder();
 }
 
+
+// RiskAnalyzer implementation
+
+RiskAnalysis RiskAnalyzer::analyze_otoco_order(const OTOCOOrderRequest& order) {
+    RiskAnalysis analysis{};
+    analysis.max_loss = OrderValidator::calculate_max_loss_otoco(order);
+    analysis.max_profit = OrderValidator::calculate_max_profit_otoco(order);
+    analysis.risk_reward_ratio = OrderValidator::calculate_risk_reward_ratio(order);
+    analysis.breakeven_price = order.primary_order.price.value_or(0.0);
+
+    const auto& entry = order.primary_order;
+    analysis.strategy_description = std::string(is_buy(entry.side) ? "Long " : "Short ") +
+        std::to_string(entry.quantity) + " " + entry.symbol + " bracket";
+
+    if (!order.stop_order.stop.has_value()) {
+        analysis.risk_warnings.push_back("Stop order has no stop price; loss is not capped");
+    }
+    if (!entry.price.has_value()) {
+        analysis.risk_warnings.push_back("Entry has no limit price; risk is measured from an unknown fill");
+    }
+    if (analysis.max_loss > 0.0 && analysis.risk_reward_ratio < 1.0) {
+        analysis.risk_warnings.push_back("Reward is smaller than risk");
+    }
+    return analysis;
+}
+
+// The spread analytics engine is the single payoff model: this only picks an
+// axis around the strikes, since an order carries no underlying price, and
+// maps the extremes and the first breakeven onto RiskAnalysis.
+RiskAnalysis RiskAnalyzer::analyze_spread_order(const SpreadOrderRequest& order) {
+    RiskAnalysis analysis{};
+    analysis.strategy_description = order.spread_type.empty() ? "spread" : order.spread_type;
+
+    double highest_strike = 0.0;
+    for (const auto& leg : order.legs) {
+        if (auto occ = OccSymbol::parse(leg.option_symbol)) {
+            highest_strike = std::max(highest_strike, occ->strike().to_double());
+        }
+    }
+    SpreadAnalyticsParams params;
+    params.spot = highest_strike;
+    params.price_range = 1.0;
+    params.vol_points = 1;
+    params.threads = 1;
+
+    auto spread = analyze_spread(order, params);
+    if (!spread.ok()) {
+        analysis.risk_warnings.push_back(spread.error);
+        return analysis;
+    }
+    if (order.spread_type.empty()) {
+        analysis.strategy_description = std::string(to_string(spread.strategy));
+    }
+    analysis.max_profit = spread.max_profit;
+    analysis.max_loss = spread.max_loss;
+    analysis.breakeven_price = spread.breakevens.empty() ? 0.0 : spread.breakevens.front();
+
+    if (std::isinf(analysis.max_loss)) {
+        analysis.risk_warnings.push_back("Loss is unbounded above the highest strike");
+        analysis.risk_reward_ratio = 0.0;
+    } else if (analysis.max_loss > 0.0) {
+        analysis.risk_reward_ratio = analysis.max_profit / analysis.max_loss;
+    }
+    if (!order.price.has_value()) {
+        analysis.risk_warnings.push_back("No net price; premium is not included");
+    }
+    return analysis;
+}
+
+std::vector<std::string> RiskAnalyzer::identify_risk_factors(const OrderRequest& order) {
+    std::vector<std::string> factors;
+    if (order.type == OrderType::Market) {
+        factors.push_back("Market order has no price protection");
+    }
+    if (order.type == OrderType::Stop) {
+        factors.push_back("Stop order becomes a market order when triggered");
+    }
+    if (order.side == OrderSide::SellShort) {
+        factors.push_back("Short sale loss is unbounded");
+    }
+    if (order.side == OrderSide::SellToOpen) {
+        factors.push_back("Uncovered option sale may carry unbounded loss");
+    }
+    if (order.duration == OrderDuration::GTC) {
+        factors.push_back("Good-til-canceled order stays working across sessions");
+    }
+    if (order.duration == OrderDuration::Pre || order.duration == OrderDuration::Post) {
+        factors.push_back("Extended-hours session has thinner liquidity");
+    }
+    if (order.quantity > 10000) {
+        factors.push_back("Large quantity may move the market");
+    }
+    return factors;
+}
+
+double RiskAnalyzer::calculate_position_size_by_risk(double account_value, double risk_percentage,
+                                                     double entry_price, double stop_price) {
+    // risk_percentage is in percent: 2.0 risks 2% of the account.
+    double per_share_risk = std::abs(entry_price - stop_price);
+    if (account_value <= 0.0 || risk_percentage <= 0.0 || per_share_risk <= 0.0 || std::isnan(per_share_risk)) {
+        return 0.0;
+    }
+    return std::floor(account_value * risk_percentage / 100.0 / per_share_risk);
+}
+
+bool RiskAnalyzer::exceeds_position_limit(const OrderRequest& order, double max_position_percentage,
+                                          double account_value, double current_position_value) {
+    // An order without a price cannot be shown to fit, so it is treated as exceeding.
+    auto price = order.price.has_value() ? order.price : order.stop;
+    if (!price.has_value() || account_value <= 0.0) {
+        return true;
+    }
+    double order_value = price.value() * order.quantity * (order.order_class == OrderClass::Option ? option_multiplier : 1.0);
+    return (std::abs(current_position_value) + order_value) / account_value * 100.0 > max_position_percentage;
+}
+
 } // namespace oqd
\ No newline at end of file
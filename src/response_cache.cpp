@@ -0,0 +1,111 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/response_cache.hpp"
+#include <algorithm>
+#include <utility>
+#include "oqdTradierpp/utils.hpp"
+
+namespace oqd {
+
+ResponseCache::ResponseCache(std::size_t max_entries)
+    : max_entries_(std::max<std::size_t>(1, max_entries)) {}
+
+std::string ResponseCache::make_key(std::string_view path,
+                                    const std::unordered_map<std::string, std::string>& params,
+                                    std::string_view origin) {
+    return utils::canonical_request_key(path, params, origin);
+}
+
+ResponseCache::Entry& ResponseCache::begin_load(const std::string& key, std::type_index type) {
+    if (entries_.size() >= max_entries_ && entries_.find(key) == entries_.end()) {
+        auto now = Clock::now();
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (!it->second.pending && it->second.expires <= now) {
+                it = entries_.erase(it);
+                ++stats_.evictions;
+            } else {
+                ++it;
+            }
+        }
+        if (entries_.size() >= max_entries_) {
+            auto oldest = entries_.end();
+            for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+                if (!it->second.pending && (oldest == entries_.end() || it->second.expires < oldest->second.expires)) {
+                    oldest = it;
+                }
+            }
+            if (oldest != entries_.end()) {
+                entries_.erase(oldest);
+                ++stats_.evictions;
+            }
+        }
+    }
+
+    Entry& entry = entries_[key];
+    entry.type = type;
+    entry.generation = ++next_generation_;
+    entry.value.reset();
+    entry.pending.reset();
+    return entry;
+}
+
+void ResponseCache::erase_if_generation(const std::string& key, std::uint64_t generation) {
+    auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.generation == generation) {
+        entries_.erase(it);
+    }
+}
+
+void ResponseCache::publish(const std::string& key, std::uint64_t generation,
+                            std::shared_ptr<const void> value, Clock::duration ttl) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.generation != generation) {
+        return;
+    }
+    it->second.value = std::move(value);
+    it->second.expires = Clock::now() + ttl;
+    it->second.pending.reset();
+}
+
+void ResponseCache::invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(key);
+}
+
+void ResponseCache::invalidate_path(std::string_view path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        std::string_view key = it->first;
+        if (key.size() > path.size() && key.substr(0, path.size()) == path && key[path.size()] == '?') {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void ResponseCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+
+ResponseCacheStats ResponseCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResponseCacheStats snapshot = stats_;
+    snapshot.entries = entries_.size();
+    return snapshot;
+}
+
+} // namespace oqd
@@ -13,6 +13,7 @@
 
 #include "oqdTradierpp/streaming.hpp"
 #include "oqdTradierpp/utils.hpp"
+#include "oqdTradierpp/core/json_builder.hpp"
 #include <boost/beast/core.hpp>
 #include <boost/beast/http.hpp>
 #include <boost/beast/ssl.hpp>
@@ -853,21 +854,23 @@ StreamingQuote StreamingQuote::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string StreamingQuote::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << R"({"symbol":")" << symbol 
-        << R"(","bid":)" << bid
-        << R"(,"ask":)" << ask
-        << R"(,"last":)" << last
-        << R"(,"bid_size":)" << bid_size
-        << R"(,"ask_size":)" << ask_size
-        << R"(,"last_size":)" << last_size
-        << R"(,"bid_exch":")" << bid_exch
-        << R"(","ask_exch":")" << ask_exch
-        << R"(","timestamp":)" << std::chrono::duration_cast<std::chrono::seconds>(
-               timestamp.time_since_epoch()).count()
-        << "}";
-    return oss.str();
+    return json::write_to_string(*this);
+}
+
+void StreamingQuote::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
+        .set_fixed().set_precision(2)
+        .field("symbol", symbol)
+        .field("bid", bid)
+        .field("ask", ask)
+        .field("last", last)
+        .field("bid_size", bid_size)
+        .field("ask_size", ask_size)
+        .field("last_size", last_size)
+        .field("bid_exch", bid_exch)
+        .field("ask_exch", ask_exch)
+        .field("timestamp", std::chrono::duration_cast<std::chrono::seconds>(timestamp.time_since_epoch()).count())
+        .end_object();
 }
 
 StreamingTrade StreamingTrade::from_json(const simdjson::dom::element& elem) {
@@ -910,17 +913,19 @@ StreamingTrade StreamingTrade::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string StreamingTrade::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << R"({"symbol":")" << symbol 
-        << R"(","price":)" << price
-        << R"(,"size":)" << size
-        << R"(,"exch":")" << exch
-        << R"(","condition":")" << condition
-        << R"(","timestamp":)" << std::chrono::duration_cast<std::chrono::seconds>(
-               timestamp.time_since_epoch()).count()
-        << "}";
-    return oss.str();
+    return json::write_to_string(*this);
+}
+
+void StreamingTrade::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
+        .set_fixed().set_precision(2)
+        .field("symbol", symbol)
+        .field("price", price)
+        .field("size", size)
+        .field("exch", exch)
+        .field("condition", condition)
+        .field("timestamp", std::chrono::duration_cast<std::chrono::seconds>(timestamp.time_since_epoch()).count())
+        .end_object();
 }
 
 StreamingSummary StreamingSummary::from_json(const simdjson::dom::element& elem) {
@@ -966,27 +971,41 @@ StreamingSummary StreamingSummary::from_json(const simdjson::dom::element& elem)
 }
 
 std::string StreamingSummary::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << R"({"symbol":")" << symbol 
-        << R"(","open":)" << open
-        << R"(,"high":)" << high
-        << R"(,"low":)" << low
-        << R"(,"close":)" << close
-        << R"(,"prev_close":)" << prev_close
-        << R"(,"volume":)" << volume
-        << R"(,"timestamp":)" << std::chrono::duration_cast<std::chrono::seconds>(
-               timestamp.time_since_epoch()).count()
-        << "}";
-    return oss.str();
+    return json::write_to_string(*this);
+}
+
+void StreamingSummary::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
+        .set_fixed().set_precision(2)
+        .field("symbol", symbol)
+        .field("open", open)
+        .field("high", high)
+        .field("low", low)
+        .field("close", close)
+        .field("prev_close", prev_close)
+        .field("volume", volume)
+        .field("timestamp", std::chrono::duration_cast<std::chrono::seconds>(timestamp.time_since_epoch()).count())
+        .end_object();
 }
 
 StreamingOrderStatus StreamingOrderStatus::from_json(const simdjson::dom::element& elem) {
     StreamingOrderStatus status;
     
+    // Account events carry the order id as a number under "id"; older payloads
+    // used a string "order_id".
     auto order_id_result = elem["id"];
+    if (order_id_result.error() != simdjson::SUCCESS) {
+        order_id_result = elem["order_id"];
+    }
     if (order_id_result.error() == simdjson::SUCCESS) {
-        status.order_id = std::string(order_id_result.value().get_string().value());
+        auto id_elem = order_id_result.value();
+        if (id_elem.is_string()) {
+            status.order_id = std::string(id_elem.get_string().value());
+        } else if (id_elem.is_int64()) {
+            status.order_id = std::to_string(id_elem.get_int64().value());
+        } else if (id_elem.is_uint64()) {
+            status.order_id = std::to_string(id_elem.get_uint64().value());
+        }
     }
     
     auto status_result = elem["status"];
@@ -1001,12 +1020,12 @@ StreamingOrderStatus StreamingOrderStatus::from_json(const simdjson::dom::elemen
     
     auto type_result = elem["type"];
     if (type_result.error() == simdjson::SUCCESS) {
-        status.order_type = order_type_from_string(std::string(type_result.value().get_string().value()));
+        status.order_type = order_type_from_string(type_result.value().get_string().value());
     }
     
     auto side_result = elem["side"];
     if (side_result.error() == simdjson::SUCCESS) {
-        status.side = order_side_from_string(std::string(side_result.value().get_string().value()));
+        status.side = order_side_from_string(side_result.value().get_string().value());
     }
     
     auto quantity_result = elem["quantity"];
@@ -1015,6 +1034,9 @@ StreamingOrderStatus StreamingOrderStatus::from_json(const simdjson::dom::elemen
     }
     
     auto filled_result = elem["filled_quantity"];
+    if (filled_result.error() != simdjson::SUCCESS) {
+        filled_result = elem["executed_quantity"];
+    }
     if (filled_result.error() == simdjson::SUCCESS) {
         status.filled_quantity = filled_result.value().get_double().value();
     }
@@ -1029,26 +1051,34 @@ StreamingOrderStatus StreamingOrderStatus::from_json(const simdjson::dom::elemen
         status.remaining_quantity = remaining_result.value().get_double().value();
     }
     
+    auto tag_result = elem["tag"];
+    if (tag_result.error() == simdjson::SUCCESS && tag_result.value().is_string()) {
+        status.tag = std::string(tag_result.value().get_string().value());
+    }
+    
     status.timestamp = std::chrono::system_clock::now();
     return status;
 }
 
 std::string StreamingOrderStatus::to_json() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2);
-    oss << R"({"order_id":")" << order_id 
-        << R"(","status":")" << status
-        << R"(","symbol":")" << symbol
-        << R"(","order_type":")" << to_string(order_type)
-        << R"(","side":")" << to_string(side)
-        << R"(","quantity":)" << quantity
-        << R"(,"filled_quantity":)" << filled_quantity
-        << R"(,"avg_fill_price":)" << avg_fill_price
-        << R"(,"remaining_quantity":)" << remaining_quantity
-        << R"(","timestamp":)" << std::chrono::duration_cast<std::chrono::seconds>(
-               timestamp.time_since_epoch()).count()
-        << "}";
-    return oss.str();
+    return json::write_to_string(*this);
+}
+
+void StreamingOrderStatus::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
+        .set_fixed().set_precision(2)
+        .field("order_id", order_id)
+        .field("status", status)
+        .field("symbol", symbol)
+        .field("order_type", order_type)
+        .field("side", side)
+        .field("quantity", quantity)
+        .field("filled_quantity", filled_quantity)
+        .field("avg_fill_price", avg_fill_price)
+        .field("remaining_quantity", remaining_quantity)
+        .field_optional("tag", tag)
+        .field("timestamp", std::chrono::duration_cast<std::chrono::seconds>(timestamp.time_since_epoch()).count())
+        .end_object();
 }
 
 std::unique_ptr<StreamingSession> create_streaming_session(std::shared_ptr<TradierClient> client) {
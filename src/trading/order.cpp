@@ -20,29 +20,32 @@ namespace oqd {
 Leg Leg::from_json(const simdjson::dom::element& elem) {
     Leg leg;
     leg.option_symbol = std::string(elem["option_symbol"].get_string().value_unsafe());
-    leg.side = order_side_from_string(std::string(elem["side"].get_string().value_unsafe()));
+    leg.side = order_side_from_string(elem["side"].get_string().value_unsafe());
     leg.quantity = elem["quantity"].get_int64().value_unsafe();
     return leg;
 }
 
 std::string Leg::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void Leg::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .field("option_symbol", option_symbol)
         .field("side", side)
         .field("quantity", quantity)
-        .end_object()
-        .str();
+        .end_object();
 }
 
 Order Order::from_json(const simdjson::dom::element& elem) {
     Order order;
     order.id = std::string(elem["id"].get_string().value_unsafe());
-    order.type = order_type_from_string(std::string(elem["type"].get_string().value_unsafe()));
+    order.type = order_type_from_string(elem["type"].get_string().value_unsafe());
     order.symbol = std::string(elem["symbol"].get_string().value_unsafe());
-    order.side = order_side_from_string(std::string(elem["side"].get_string().value_unsafe()));
+    order.side = order_side_from_string(elem["side"].get_string().value_unsafe());
     order.quantity = elem["quantity"].get_int64().value_unsafe();
-    order.status = order_status_from_string(std::string(elem["status"].get_string().value_unsafe()));
-    order.duration = order_duration_from_string(std::string(elem["duration"].get_string().value_unsafe()));
+    order.status = order_status_from_string(elem["status"].get_string().value_unsafe());
+    order.duration = order_duration_from_string(elem["duration"].get_string().value_unsafe());
     
     if (!elem["price"].is_null()) {
         order.price = elem["price"].get_double().value_unsafe();
@@ -60,7 +63,7 @@ Order Order::from_json(const simdjson::dom::element& elem) {
     order.remaining_quantity = elem["remaining_quantity"].get_int64().value_unsafe();
     order.create_date = std::string(elem["create_date"].get_string().value_unsafe());
     order.transaction_date = std::string(elem["transaction_date"].get_string().value_unsafe());
-    order.order_class = order_class_from_string(std::string(elem["class"].get_string().value_unsafe()));
+    order.order_class = order_class_from_string(elem["class"].get_string().value_unsafe());
     
     auto legs_elem = elem["legs"];
     if (legs_elem.error() == simdjson::SUCCESS && legs_elem.is_array()) {
@@ -69,11 +72,20 @@ Order Order::from_json(const simdjson::dom::element& elem) {
         }
     }
     
+    auto tag_elem = elem["tag"];
+    if (tag_elem.error() == simdjson::SUCCESS && tag_elem.is_string()) {
+        order.tag = std::string(tag_elem.get_string().value_unsafe());
+    }
+    
     return order;
 }
 
 std::string Order::to_json() const {
-    return json::create_object()
+    return json::write_to_string(*this);
+}
+
+void Order::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .field("id", id)
         .field("type", type)
         .field("symbol", symbol)
@@ -92,8 +104,8 @@ std::string Order::to_json() const {
         .field("transaction_date", transaction_date)
         .field("class", order_class)
         .array_field("legs", legs)
-        .end_object()
-        .str();
+        .field_optional("tag", tag)
+        .end_object();
 }
 
 } // namespace oqd
\ No newline at end of file
@@ -0,0 +1,334 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/trading/order_guard.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include "oqdTradierpp/core/price.hpp"
+
+namespace oqd {
+
+namespace {
+
+constexpr std::uint64_t fnv_prime = 1099511628211ull;
+
+// Rate slots pack the sub-window number above a 24-bit order count.
+constexpr unsigned count_bits = 24;
+constexpr std::uint64_t count_mask = (1ull << count_bits) - 1;
+
+std::unique_ptr<std::atomic<std::uint64_t>[]> zeroed(std::size_t size) {
+    auto slots = std::make_unique<std::atomic<std::uint64_t>[]>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        slots[i].store(0, std::memory_order_relaxed);
+    }
+    return slots;
+}
+
+std::size_t bucket_of(std::string_view key, std::size_t buckets) {
+    return std::hash<std::string_view>{}(key) & (buckets - 1);
+}
+
+void add_component(OrderFingerprint& fp, const OrderComponent& order) {
+    fp.add(order.symbol)
+      .add(order.option_symbol.value_or(""))
+      .add(static_cast<std::int64_t>(order.side))
+      .add(order.quantity)
+      .add(static_cast<std::int64_t>(order.type))
+      .add(static_cast<std::int64_t>(order.duration))
+      .add_price(order.price)
+      .add_price(order.stop)
+      .add(order.tag.value_or(""));
+}
+
+void add_simple(OrderFingerprint& fp, const OrderRequest& order) {
+    fp.add(static_cast<std::int64_t>(order.order_class))
+      .add(order.symbol)
+      .add(static_cast<std::int64_t>(order.side))
+      .add(order.quantity)
+      .add(static_cast<std::int64_t>(order.type))
+      .add(static_cast<std::int64_t>(order.duration))
+      .add_price(order.price)
+      .add_price(order.stop)
+      .add(order.tag.value_or(""));
+}
+
+template<typename LegList>
+void add_legs(OrderFingerprint& fp, const LegList& legs) {
+    fp.add(static_cast<std::int64_t>(legs.size()));
+    for (const auto& leg : legs) {
+        fp.add(leg.option_symbol)
+          .add(static_cast<std::int64_t>(leg.side))
+          .add(leg.quantity);
+    }
+}
+
+} // namespace
+
+std::string_view to_string(GuardVerdict verdict) {
+    switch (verdict) {
+        case GuardVerdict::Allowed: return "allowed";
+        case GuardVerdict::AccountRate: return "account_rate";
+        case GuardVerdict::SymbolRate: return "symbol_rate";
+        case GuardVerdict::Duplicate: return "duplicate";
+    }
+    return "unknown";
+}
+
+OrderFingerprint& OrderFingerprint::add(std::string_view text) {
+    std::size_t i = 0;
+    for (; i + 8 <= text.size(); i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, text.data() + i, 8);
+        hash_ = (hash_ ^ word) * fnv_prime;
+    }
+    std::uint64_t tail = 0;
+    if (i < text.size()) {
+        std::memcpy(&tail, text.data() + i, text.size() - i);
+    }
+    // The length goes in with the tail, so ("AB","C") and ("A","BC") differ.
+    return add(static_cast<std::int64_t>(tail ^ (static_cast<std::uint64_t>(text.size()) << 56)));
+}
+
+OrderFingerprint& OrderFingerprint::add(std::int64_t value) {
+    hash_ = (hash_ ^ static_cast<std::uint64_t>(value)) * fnv_prime;
+    return *this;
+}
+
+std::uint64_t OrderFingerprint::value() const {
+    // Word-at-a-time FNV only carries entropy upwards; fold it back down
+    // (murmur3 finalizer) since the table is indexed by the low bits.
+    std::uint64_t h = hash_;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+OrderFingerprint& OrderFingerprint::add_price(std::optional<double> price) {
+    // from_double() is undefined past max_units; such prices hash as their raw bits.
+    if (price && !Price::representable(*price)) {
+        return add(std::bit_cast<std::int64_t>(*price));
+    }
+    return add(price ? Price::from_double(*price).ticks() : std::numeric_limits<std::int64_t>::min());
+}
+
+OrderSubmissionGuard::OrderSubmissionGuard(OrderGuardLimits limits)
+    : limits_(limits) {
+    limits_.rate_buckets = std::bit_ceil(std::max<std::size_t>(limits_.rate_buckets, 1));
+    limits_.duplicate_slots = std::bit_ceil(std::max<std::size_t>(limits_.duplicate_slots, 1));
+    sub_window_ms_ = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(limits_.rate_window.count()) / sub_windows);
+    account_counts_ = zeroed(account_buckets * sub_windows);
+    symbol_counts_ = zeroed(limits_.rate_buckets * sub_windows);
+    recent_orders_ = zeroed(limits_.duplicate_slots);
+}
+
+OrderSubmissionGuard::~OrderSubmissionGuard() = default;
+
+std::uint64_t OrderSubmissionGuard::clock_milliseconds(Clock::time_point now) {
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(ms, 0));
+}
+
+bool OrderSubmissionGuard::try_acquire(std::atomic<std::uint64_t>* bucket, std::uint32_t limit, std::uint64_t epoch) {
+    auto& slot = bucket[epoch % sub_windows];
+    std::uint64_t current = slot.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do {
+        next = (current >> count_bits) == epoch ? current + 1 : (epoch << count_bits) | 1;
+    } while (!slot.compare_exchange_weak(current, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    std::uint64_t in_window = 0;
+    for (std::size_t i = 0; i < sub_windows; ++i) {
+        std::uint64_t value = bucket[i].load(std::memory_order_acquire);
+        std::uint64_t age = epoch - (value >> count_bits);
+        if ((value >> count_bits) <= epoch && age < sub_windows) {
+            in_window += value & count_mask;
+        }
+    }
+    if (in_window > limit) {
+        give_back(bucket, epoch);
+        return false;
+    }
+    return true;
+}
+
+void OrderSubmissionGuard::give_back(std::atomic<std::uint64_t>* bucket, std::uint64_t epoch) {
+    auto& slot = bucket[epoch % sub_windows];
+    std::uint64_t current = slot.load(std::memory_order_relaxed);
+    // Once the slot has rolled to a later sub-window our reservation has
+    // already aged out.
+    while ((current >> count_bits) == epoch && (current & count_mask) > 0) {
+        if (slot.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+GuardVerdict OrderSubmissionGuard::admit(std::string_view account_id, std::string_view symbol,
+                                         std::uint64_t fingerprint, Clock::time_point now) {
+    const std::uint64_t ms = clock_milliseconds(now);
+
+    // Recent orders pack the fingerprint's top 32 bits above a 32-bit
+    // timestamp (ms + 1, so an empty slot never matches).
+    std::atomic<std::uint64_t>* recent = nullptr;
+    std::uint64_t previous = 0;
+    std::uint64_t stamped = 0;
+    if (limits_.duplicate_window.count() > 0) {
+        recent = &recent_orders_[fingerprint & (limits_.duplicate_slots - 1)];
+        const auto window = static_cast<std::uint64_t>(limits_.duplicate_window.count());
+        const std::uint32_t stamp = static_cast<std::uint32_t>(ms + 1);
+        stamped = (fingerprint & 0xffffffff00000000ull) | stamp;
+        previous = recent->load(std::memory_order_relaxed);
+        do {
+            const auto age = static_cast<std::uint32_t>(stamp - static_cast<std::uint32_t>(previous));
+            if (previous != 0 && (previous >> 32) == (fingerprint >> 32) && age < window) {
+                return GuardVerdict::Duplicate;
+            }
+        } while (!recent->compare_exchange_weak(previous, stamped, std::memory_order_acq_rel, std::memory_order_relaxed));
+    }
+
+    // A rate rejection means the order never left, so a retry is not a duplicate.
+    auto forget = [&] {
+        if (recent) {
+            recent->compare_exchange_strong(stamped, previous, std::memory_order_acq_rel);
+        }
+    };
+
+    const std::uint64_t epoch = ms / sub_window_ms_;
+    std::atomic<std::uint64_t>* account = nullptr;
+    if (limits_.max_orders_per_account > 0) {
+        account = &account_counts_[bucket_of(account_id, account_buckets) * sub_windows];
+        if (!try_acquire(account, limits_.max_orders_per_account, epoch)) {
+            forget();
+            return GuardVerdict::AccountRate;
+        }
+    }
+    if (limits_.max_orders_per_symbol > 0) {
+        auto* bucket = &symbol_counts_[bucket_of(symbol, limits_.rate_buckets) * sub_windows];
+        if (!try_acquire(bucket, limits_.max_orders_per_symbol, epoch)) {
+            if (account) {
+                give_back(account, epoch);
+            }
+            forget();
+            return GuardVerdict::SymbolRate;
+        }
+    }
+    return GuardVerdict::Allowed;
+}
+
+std::string_view OrderSubmissionGuard::rate_symbol(const MultilegOrderRequest& order) {
+    return order.legs.empty() ? std::string_view() : std::string_view(order.legs.front().option_symbol);
+}
+
+std::string_view OrderSubmissionGuard::rate_symbol(const ComboOrderRequest& order) {
+    if (order.equity_symbol) {
+        return *order.equity_symbol;
+    }
+    return order.legs.empty() ? std::string_view() : std::string_view(order.legs.front().option_symbol);
+}
+
+std::string_view OrderSubmissionGuard::rate_symbol(const SpreadOrderRequest& order) {
+    return order.legs.empty() ? std::string_view() : std::string_view(order.legs.front().option_symbol);
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const OrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id);
+    add_simple(fp, order);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const OptionOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id).add(order.option_symbol);
+    add_simple(fp, order);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const MultilegOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id)
+      .add(static_cast<std::int64_t>(order.order_class))
+      .add(static_cast<std::int64_t>(order.type))
+      .add(static_cast<std::int64_t>(order.duration))
+      .add_price(order.price)
+      .add(order.tag.value_or(""));
+    add_legs(fp, order.legs);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const ComboOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id)
+      .add(static_cast<std::int64_t>(order.order_class))
+      .add(static_cast<std::int64_t>(order.type))
+      .add(static_cast<std::int64_t>(order.duration))
+      .add_price(order.price)
+      .add(order.equity_symbol.value_or(""))
+      .add(order.equity_side ? static_cast<std::int64_t>(*order.equity_side) : -1)
+      .add(order.equity_quantity.value_or(0))
+      .add(order.tag.value_or(""));
+    add_legs(fp, order.legs);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const OTOOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id).add(static_cast<std::int64_t>(order.order_class)).add(order.tag.value_or(""));
+    add_component(fp, order.first_order);
+    add_component(fp, order.second_order);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const OCOOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id).add(static_cast<std::int64_t>(order.order_class)).add(order.tag.value_or(""));
+    add_component(fp, order.first_order);
+    add_component(fp, order.second_order);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const OTOCOOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id).add(static_cast<std::int64_t>(order.order_class)).add(order.tag.value_or(""));
+    add_component(fp, order.primary_order);
+    add_component(fp, order.profit_order);
+    add_component(fp, order.stop_order);
+    return fp.value();
+}
+
+std::uint64_t OrderSubmissionGuard::fingerprint(std::string_view account_id, const SpreadOrderRequest& order) {
+    OrderFingerprint fp;
+    fp.add(account_id)
+      .add(static_cast<std::int64_t>(order.order_class))
+      .add(static_cast<std::int64_t>(order.type))
+      .add(static_cast<std::int64_t>(order.duration))
+      .add_price(order.price)
+      .add(order.spread_type)
+      .add(order.tag.value_or(""));
+    fp.add(static_cast<std::int64_t>(order.legs.size()));
+    for (const auto& leg : order.legs) {
+        fp.add(leg.option_symbol)
+          .add(static_cast<std::int64_t>(leg.side))
+          .add(leg.quantity)
+          .add_price(leg.ratio);
+    }
+    return fp.value();
+}
+
+} // namespace oqd
@@ -46,9 +46,9 @@ OrderPreview OrderPreview::from_json(const simdjson::dom::element& elem) {
     preview.fees = elem["fees"].get_double().value_unsafe();
     preview.symbol = std::string(elem["symbol"].get_string().value_unsafe());
     preview.quantity = static_cast<int>(elem["quantity"].get_int64().value_unsafe());
-    preview.side = order_side_from_string(std::string(elem["side"].get_string().value_unsafe()));
-    preview.type = order_type_from_string(std::string(elem["type"].get_string().value_unsafe()));
-    preview.duration = order_duration_from_string(std::string(elem["duration"].get_string().value_unsafe()));
+    preview.side = order_side_from_string(elem["side"].get_string().value_unsafe());
+    preview.type = order_type_from_string(elem["type"].get_string().value_unsafe());
+    preview.duration = order_duration_from_string(elem["duration"].get_string().value_unsafe());
     
     auto price_result = elem["price"];
     if (price_result.error() == simdjson::SUCCESS) {
@@ -18,8 +18,12 @@
 namespace oqd {
 
 std::string OrderRequest::to_json() const {
-    auto builder = json::create_object()
-        .set_fixed().set_precision(2)
+    return json::write_to_string(*this);
+}
+
+void OrderRequest::write_json(json::JsonBuilder& builder) const {
+    builder.set_fixed().set_precision(2)
+        .start_object()
         .field("class", order_class)
         .field("symbol", symbol)
         .field("side", side)
@@ -37,12 +41,16 @@ std::string OrderRequest::to_json() const {
         builder.field("tag", tag.value());
     }
     
-    return builder.end_object().str();
+    builder.end_object();
 }
 
 std::string OptionOrderRequest::to_json() const {
-    auto builder = json::create_object()
-        .set_fixed().set_precision(2)
+    return json::write_to_string(*this);
+}
+
+void OptionOrderRequest::write_json(json::JsonBuilder& builder) const {
+    builder.set_fixed().set_precision(2)
+        .start_object()
         .field("class", order_class)
         .field("symbol", symbol)
         .field("side", side)
@@ -61,7 +69,7 @@ std::string OptionOrderRequest::to_json() const {
         builder.field("tag", tag.value());
     }
     
-    return builder.end_object().str();
+    builder.end_object();
 }
 
 } // namespace oqd
\ No newline at end of file
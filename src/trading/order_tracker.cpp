@@ -0,0 +1,365 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/trading/order_tracker.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace oqd {
+
+namespace {
+
+constexpr double quantity_epsilon = 1e-9;
+
+TrackedOrder tracked_from_order(const Order& order, std::uint64_t sequence) {
+    TrackedOrder tracked;
+    tracked.id = order.id;
+    tracked.tag = order.tag;
+    tracked.symbol = order.symbol;
+    tracked.side = order.side;
+    tracked.type = order.type;
+    tracked.status = order.status;
+    tracked.quantity = order.quantity;
+    tracked.filled_quantity = order.exec_quantity;
+    tracked.remaining_quantity = order.remaining_quantity;
+    tracked.avg_fill_price = order.avg_fill_price.value_or(0.0);
+    tracked.sequence = sequence;
+    tracked.last_update = std::chrono::system_clock::now();
+    return tracked;
+}
+
+} // namespace
+
+bool TrackedOrder::is_terminal() const {
+    return OrderTracker::is_terminal(status);
+}
+
+OrderTracker::OrderTracker(std::shared_ptr<ApiMethods> api, std::string account_id)
+    : api_(std::move(api))
+    , account_id_(std::move(account_id)) {
+}
+
+bool OrderTracker::is_terminal(OrderStatus status) {
+    switch (status) {
+        case OrderStatus::Filled:
+        case OrderStatus::Canceled:
+        case OrderStatus::Expired:
+        case OrderStatus::Rejected:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool OrderTracker::can_transition(OrderStatus from, OrderStatus to) {
+    if (from == to || is_terminal(from)) {
+        return false;
+    }
+    switch (from) {
+        case OrderStatus::Pending:
+            return true;
+        case OrderStatus::Open:
+            return to != OrderStatus::Pending;
+        case OrderStatus::PartiallyFilled:
+            return to == OrderStatus::Filled || to == OrderStatus::Canceled || to == OrderStatus::Expired;
+        default:
+            return false;
+    }
+}
+
+std::size_t OrderTracker::seed() {
+    if (!api_) {
+        throw std::runtime_error("OrderTracker::seed requires an ApiMethods instance");
+    }
+    return seed(api_->get_account_orders(account_id_, true));
+}
+
+std::size_t OrderTracker::seed(const std::vector<Order>& orders) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::size_t inserted = 0;
+    for (const auto& order : orders) {
+        // The stream may already have advanced an order past the REST snapshot.
+        if (orders_.count(order.id) != 0 || pruned_.count(order.id) != 0) {
+            continue;
+        }
+        auto [it, added] = orders_.emplace(order.id, tracked_from_order(order, ++sequence_));
+        if (!it->second.is_terminal()) {
+            ++open_count_;
+        }
+        index_tag(it->second);
+        ++inserted;
+    }
+    return inserted;
+}
+
+bool OrderTracker::apply(const StreamingOrderStatus& event) {
+    Update update;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        update = apply_locked(event);
+    }
+    dispatch(update);
+    return update.fill.has_value() || update.status_change.has_value();
+}
+
+bool OrderTracker::on_stream_event(const simdjson::dom::element& elem) {
+    auto event_type = elem["event"];
+    if (event_type.error() == simdjson::SUCCESS && event_type.value().is_string() &&
+        event_type.value().get_string().value() != "order") {
+        return false;
+    }
+    if (elem["status"].error() != simdjson::SUCCESS) {
+        return false;
+    }
+    return apply(StreamingOrderStatus::from_json(elem));
+}
+
+StreamingCallback OrderTracker::stream_callback() {
+    return [this](const simdjson::dom::element& elem) {
+        on_stream_event(elem);
+    };
+}
+
+OrderTracker::Update OrderTracker::apply_locked(const StreamingOrderStatus& event) {
+    Update update;
+    if (event.order_id.empty()) {
+        return update;
+    }
+
+    auto it = orders_.find(event.order_id);
+    if (it == orders_.end()) {
+        // A replayed event for a pruned order would otherwise re-create it
+        // with no fills and report its whole fill a second time.
+        if (pruned_.count(event.order_id) != 0) {
+            return update;
+        }
+        TrackedOrder order;
+        order.id = event.order_id;
+        order.symbol = event.symbol;
+        order.side = event.side;
+        order.type = event.order_type;
+        order.quantity = event.quantity;
+        order.remaining_quantity = event.quantity;
+        it = orders_.emplace(event.order_id, std::move(order)).first;
+        ++open_count_;
+    }
+    auto& order = it->second;
+
+    if (event.tag && !order.tag) {
+        order.tag = event.tag;
+        index_tag(order);
+    }
+    if (order.quantity <= 0.0 && event.quantity > 0.0) {
+        order.quantity = event.quantity;
+    }
+
+    bool changed = false;
+
+    // Fill quantities only move forward; the price of this fill is recovered
+    // from the change in the cumulative average fill price.
+    if (event.filled_quantity > order.filled_quantity + quantity_epsilon) {
+        double delta = event.filled_quantity - order.filled_quantity;
+        double notional = event.avg_fill_price * event.filled_quantity -
+                          order.avg_fill_price * order.filled_quantity;
+        double price = notional / delta;
+        if (!std::isfinite(price) || price <= 0.0) {
+            price = event.avg_fill_price;
+        }
+
+        order.filled_quantity = event.filled_quantity;
+        order.avg_fill_price = event.avg_fill_price;
+        order.remaining_quantity = event.remaining_quantity > 0.0
+            ? event.remaining_quantity
+            : std::max(0.0, order.quantity - order.filled_quantity);
+
+        OrderFill fill;
+        fill.order_id = order.id;
+        fill.tag = order.tag;
+        fill.symbol = order.symbol;
+        fill.side = order.side;
+        fill.quantity = delta;
+        fill.price = price;
+        fill.cumulative_quantity = order.filled_quantity;
+        fill.remaining_quantity = order.remaining_quantity;
+        fill.timestamp = event.timestamp;
+        update.fill = std::move(fill);
+        changed = true;
+    }
+
+    auto previous = order.status;
+    auto next = order_status_from_string(event.status);
+    if (can_transition(previous, next)) {
+        order.status = next;
+        if (is_terminal(next)) {
+            --open_count_;
+            if (next == OrderStatus::Filled) {
+                order.remaining_quantity = 0.0;
+            }
+        }
+        changed = true;
+    }
+
+    if (changed) {
+        order.sequence = ++sequence_;
+        order.last_update = event.timestamp;
+        if (update.fill) {
+            update.fill->status = order.status;
+        }
+        if (order.status != previous) {
+            update.status_change.emplace(order, previous);
+        }
+    }
+    return update;
+}
+
+void OrderTracker::index_tag(const TrackedOrder& order) {
+    if (order.tag && !order.tag->empty()) {
+        tag_index_[*order.tag] = order.id;
+    }
+}
+
+void OrderTracker::dispatch(const Update& update) const {
+    if (!update.fill && !update.status_change) {
+        return;
+    }
+    // Callbacks run on copies, outside the lock, so they may register more.
+    std::vector<StatusCallback> status_callbacks;
+    std::vector<FillCallback> fill_callbacks;
+    {
+        std::lock_guard<std::mutex> lock(callback_mutex_);
+        if (update.status_change) {
+            status_callbacks = status_callbacks_;
+        }
+        if (update.fill) {
+            fill_callbacks = fill_callbacks_;
+        }
+    }
+    for (const auto& callback : status_callbacks) {
+        callback(update.status_change->first, update.status_change->second);
+    }
+    for (const auto& callback : fill_callbacks) {
+        callback(*update.fill);
+    }
+}
+
+void OrderTracker::on_fill(FillCallback callback) {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    fill_callbacks_.push_back(std::move(callback));
+}
+
+void OrderTracker::on_status_change(StatusCallback callback) {
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    status_callbacks_.push_back(std::move(callback));
+}
+
+std::optional<TrackedOrder> OrderTracker::find(const std::string& order_id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = orders_.find(order_id);
+    if (it == orders_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<TrackedOrder> OrderTracker::find_by_tag(const std::string& tag) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto tag_it = tag_index_.find(tag);
+    if (tag_it == tag_index_.end()) {
+        return std::nullopt;
+    }
+    auto it = orders_.find(tag_it->second);
+    if (it == orders_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<OrderStatus> OrderTracker::status_of(const std::string& order_id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = orders_.find(order_id);
+    if (it == orders_.end()) {
+        return std::nullopt;
+    }
+    return it->second.status;
+}
+
+std::vector<TrackedOrder> OrderTracker::open_orders() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<TrackedOrder> result;
+    result.reserve(open_count_);
+    for (const auto& [id, order] : orders_) {
+        if (!order.is_terminal()) {
+            result.push_back(order);
+        }
+    }
+    return result;
+}
+
+std::vector<TrackedOrder> OrderTracker::all_orders() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<TrackedOrder> result;
+    result.reserve(orders_.size());
+    for (const auto& [id, order] : orders_) {
+        result.push_back(order);
+    }
+    return result;
+}
+
+std::size_t OrderTracker::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return orders_.size();
+}
+
+std::size_t OrderTracker::open_count() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return open_count_;
+}
+
+std::size_t OrderTracker::prune_terminal() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::size_t removed = 0;
+    for (auto it = orders_.begin(); it != orders_.end();) {
+        if (it->second.is_terminal()) {
+            if (it->second.tag) {
+                auto tag_it = tag_index_.find(*it->second.tag);
+                if (tag_it != tag_index_.end() && tag_it->second == it->first) {
+                    tag_index_.erase(tag_it);
+                }
+            }
+            if (pruned_.insert(it->first).second) {
+                pruned_order_.push_back(it->first);
+            }
+            it = orders_.erase(it);
+            ++removed;
+        } else {
+            ++it;
+        }
+    }
+    while (pruned_order_.size() > pruned_history) {
+        pruned_.erase(pruned_order_.front());
+        pruned_order_.pop_front();
+    }
+    return removed;
+}
+
+void OrderTracker::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    orders_.clear();
+    tag_index_.clear();
+    pruned_.clear();
+    pruned_order_.clear();
+    open_count_ = 0;
+}
+
+} // namespace oqd
\ No newline at end of file
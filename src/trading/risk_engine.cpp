@@ -0,0 +1,273 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/trading/risk_engine.hpp"
+#include <algorithm>
+#include <cmath>
+#include "oqdTradierpp/account/portfolio_engine.hpp"
+
+namespace oqd {
+
+std::string_view to_string(RiskVerdict verdict) {
+    switch (verdict) {
+        case RiskVerdict::Accepted: return "accepted";
+        case RiskVerdict::InvalidOrder: return "invalid_order";
+        case RiskVerdict::NoReferencePrice: return "no_reference_price";
+        case RiskVerdict::PriceBand: return "price_band";
+        case RiskVerdict::OrderNotional: return "order_notional";
+        case RiskVerdict::OpenNotional: return "open_notional";
+        case RiskVerdict::PositionLimit: return "position_limit";
+        case RiskVerdict::OrderRate: return "order_rate";
+    }
+    return "unknown";
+}
+
+PreTradeRiskEngine::PreTradeRiskEngine(RiskLimits limits)
+    : limits_(limits) {
+}
+
+std::uint32_t PreTradeRiskEngine::slot_for(const std::string& symbol) {
+    auto [it, inserted] = symbol_index_.try_emplace(symbol, static_cast<std::uint32_t>(last_price_.size()));
+    if (inserted) {
+        last_price_.push_back(0.0);
+        multiplier_.push_back(PortfolioEngine::contract_multiplier(symbol));
+        held_.push_back(0.0);
+        pending_buy_.push_back(0.0);
+        pending_sell_.push_back(0.0);
+        max_position_.push_back(0.0);
+    }
+    return it->second;
+}
+
+std::uint32_t PreTradeRiskEngine::symbol_id(const std::string& symbol) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return slot_for(symbol);
+}
+
+std::optional<std::uint32_t> PreTradeRiskEngine::find_symbol(const std::string& symbol) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = symbol_index_.find(symbol);
+    if (it == symbol_index_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void PreTradeRiskEngine::set_limits(const RiskLimits& limits) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    limits_ = limits;
+    tokens_ = std::min(tokens_, std::max(1.0, limits_.max_orders_per_second));
+}
+
+RiskLimits PreTradeRiskEngine::limits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return limits_;
+}
+
+void PreTradeRiskEngine::set_position_limit(std::uint32_t symbol, double max_position) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (symbol < max_position_.size()) {
+        max_position_[symbol] = max_position;
+    }
+}
+
+void PreTradeRiskEngine::seed(const std::vector<Position>& positions) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::fill(held_.begin(), held_.end(), 0.0);
+    for (const auto& position : positions) {
+        held_[slot_for(position.symbol)] += position.quantity;
+    }
+}
+
+void PreTradeRiskEngine::set_position(std::uint32_t symbol, double quantity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (symbol < held_.size()) {
+        held_[symbol] = quantity;
+    }
+}
+
+void PreTradeRiskEngine::set_last_price(std::uint32_t symbol, double price) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (symbol < last_price_.size()) {
+        last_price_[symbol] = price;
+    }
+}
+
+bool PreTradeRiskEngine::on_quote(const StreamingQuote& quote) {
+    double price = quote.last;
+    if (!(price > 0.0) && quote.bid > 0.0 && quote.ask > 0.0) {
+        price = (quote.bid + quote.ask) / 2.0;
+    }
+    if (!(price > 0.0)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = symbol_index_.find(quote.symbol);
+    if (it == symbol_index_.end()) {
+        return false;
+    }
+    last_price_[it->second] = price;
+    return true;
+}
+
+void PreTradeRiskEngine::refill_locked(Clock::time_point now) {
+    const double burst = std::max(1.0, limits_.max_orders_per_second);
+    if (refilled_ == Clock::time_point{}) {
+        tokens_ = burst;
+    } else if (now > refilled_) {
+        double elapsed = std::chrono::duration<double>(now - refilled_).count();
+        tokens_ = std::min(burst, tokens_ + elapsed * limits_.max_orders_per_second);
+    }
+    refilled_ = std::max(refilled_, now);
+}
+
+RiskDecision PreTradeRiskEngine::check_locked(const RiskOrder& order, Clock::time_point now) {
+    RiskDecision decision;
+    if (order.symbol >= last_price_.size() || !(order.quantity > 0.0) || !(order.limit_price >= 0.0)) {
+        return decision;
+    }
+    const std::size_t slot = order.symbol;
+    const double last = last_price_[slot];
+    const double price = order.limit_price > 0.0 ? order.limit_price : last;
+    if (!(price > 0.0)) {
+        decision.verdict = RiskVerdict::NoReferencePrice;
+        return decision;
+    }
+    // Fat-finger band: a limit too far from the last trade.
+    if (limits_.price_band > 0.0 && order.limit_price > 0.0 && last > 0.0 &&
+        std::abs(order.limit_price - last) > limits_.price_band * last) {
+        decision.verdict = RiskVerdict::PriceBand;
+        return decision;
+    }
+
+    decision.notional = price * order.quantity * multiplier_[slot];
+    if (limits_.max_order_notional > 0.0 && decision.notional > limits_.max_order_notional) {
+        decision.verdict = RiskVerdict::OrderNotional;
+        return decision;
+    }
+    if (limits_.max_open_notional > 0.0 && open_notional_ + decision.notional > limits_.max_open_notional) {
+        decision.verdict = RiskVerdict::OpenNotional;
+        return decision;
+    }
+
+    // Working buys and sells are bounded separately: a resting sell may be
+    // canceled, so it never makes room for more buys (and vice versa). The
+    // order is checked against the extreme on its own side; orders that do
+    // not push that extreme further out always pass the position limit.
+    const double delta = PortfolioEngine::signed_quantity(order.side, order.quantity);
+    const double extreme = delta > 0.0 ? held_[slot] + pending_buy_[slot] : held_[slot] - pending_sell_[slot];
+    const double projected = std::abs(extreme + delta);
+    const double max_position = max_position_[slot] > 0.0 ? max_position_[slot] : limits_.max_position;
+    if (max_position > 0.0 && projected > max_position && projected > std::abs(extreme)) {
+        decision.verdict = RiskVerdict::PositionLimit;
+        return decision;
+    }
+
+    if (limits_.max_orders_per_second > 0.0) {
+        refill_locked(now);
+        if (tokens_ < 1.0) {
+            decision.verdict = RiskVerdict::OrderRate;
+            return decision;
+        }
+        tokens_ -= 1.0;
+    }
+
+    (delta > 0.0 ? pending_buy_ : pending_sell_)[slot] += order.quantity;
+    open_notional_ += decision.notional;
+    decision.verdict = RiskVerdict::Accepted;
+    return decision;
+}
+
+RiskDecision PreTradeRiskEngine::check(const RiskOrder& order, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return check_locked(order, now);
+}
+
+std::size_t PreTradeRiskEngine::check_batch(std::span<const RiskOrder> orders, std::span<RiskDecision> decisions,
+                                            Clock::time_point now) {
+    std::size_t count = std::min(orders.size(), decisions.size());
+    std::size_t accepted = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < count; ++i) {
+        decisions[i] = check_locked(orders[i], now);
+        accepted += decisions[i].accepted() ? 1 : 0;
+    }
+    return accepted;
+}
+
+RiskOrder PreTradeRiskEngine::to_risk_order(std::uint32_t symbol, const OrderRequest& order) {
+    RiskOrder risk;
+    risk.symbol = symbol;
+    risk.side = order.side;
+    risk.quantity = static_cast<double>(order.quantity);
+    if (order.type == OrderType::Limit || order.type == OrderType::StopLimit) {
+        risk.limit_price = order.price.value_or(-1.0);
+    }
+    return risk;
+}
+
+RiskDecision PreTradeRiskEngine::check(const OrderRequest& order, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return check_locked(to_risk_order(slot_for(order.symbol), order), now);
+}
+
+RiskDecision PreTradeRiskEngine::check(const OptionOrderRequest& order, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return check_locked(to_risk_order(slot_for(order.option_symbol), order), now);
+}
+
+void PreTradeRiskEngine::unreserve_locked(std::uint32_t symbol, OrderSide side, double quantity) {
+    auto& pending = is_buy(side) ? pending_buy_[symbol] : pending_sell_[symbol];
+    pending = std::max(0.0, pending - quantity);
+}
+
+void PreTradeRiskEngine::apply_fill(std::uint32_t symbol, OrderSide side, double quantity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (symbol < held_.size()) {
+        held_[symbol] += PortfolioEngine::signed_quantity(side, quantity);
+        unreserve_locked(symbol, side, quantity);
+    }
+}
+
+void PreTradeRiskEngine::release(const RiskOrder& order, const RiskDecision& decision, double unfilled_quantity) {
+    if (!decision.accepted()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (order.symbol < held_.size()) {
+        unreserve_locked(order.symbol, order.side, unfilled_quantity);
+    }
+    open_notional_ = std::max(0.0, open_notional_ - decision.notional);
+}
+
+double PreTradeRiskEngine::open_notional() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return open_notional_;
+}
+
+double PreTradeRiskEngine::position(std::uint32_t symbol) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return symbol < held_.size() ? held_[symbol] : 0.0;
+}
+
+double PreTradeRiskEngine::pending(std::uint32_t symbol) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return symbol < held_.size() ? pending_buy_[symbol] - pending_sell_[symbol] : 0.0;
+}
+
+std::size_t PreTradeRiskEngine::symbol_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_price_.size();
+}
+
+} // namespace oqd
@@ -0,0 +1,489 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include "oqdTradierpp/trading/spread_analytics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <thread>
+#include "oqdTradierpp/core/enum_table.hpp"
+#include "oqdTradierpp/core/occ_symbol.hpp"
+#include "oqdTradierpp/core/vector_math.hpp"
+
+namespace oqd {
+
+namespace {
+
+using vmath::norm_cdf;
+using vmath::norm_pdf;
+using vmath::vexp;
+using vmath::vlog;
+
+constexpr double days_per_year = 365.0;
+constexpr double min_volatility = 1e-4;
+constexpr double infinity = std::numeric_limits<double>::infinity();
+constexpr EnumTable<SpreadStrategy, 13> strategy_names{{
+    "invalid", "single", "vertical", "ratio", "calendar", "diagonal", "straddle",
+    "strangle", "butterfly", "condor", "iron_butterfly", "iron_condor", "custom"}};
+
+// P&L within half a cent of a level counts as reaching it.
+constexpr double cent_tolerance = 0.005;
+
+struct DecodedLeg {
+    OccSymbol symbol;
+    int quantity = 0;          // signed: long > 0
+    double sign = 1.0;         // +1 call, -1 put
+    double strike = 0.0;
+    double years = 0.0;        // to expiry from now
+};
+
+struct DecodedSpread {
+    std::vector<DecodedLeg> legs;
+    double first_expiry = 0.0;
+    bool single_expiry = true;
+    double premium = 0.0;      // dollars, positive when received
+    double tail_slope = 0.0;   // dollars per $1 of underlying above every strike
+};
+
+// Expiration taken as the regular-session close, approximated as 20:00 UTC.
+double years_until(const OccSymbol& symbol, std::chrono::system_clock::time_point now) {
+    auto expiry = std::chrono::sys_days{symbol.expiry_date()} + std::chrono::hours{20};
+    auto remaining = std::chrono::duration<double>(expiry - now).count();
+    return std::max(0.0, remaining / (days_per_year * 86400.0));
+}
+
+bool decode(const SpreadOrderRequest& order, std::chrono::system_clock::time_point now,
+            DecodedSpread& out, std::string& error) {
+    if (order.legs.empty()) {
+        error = "Spread has no legs";
+        return false;
+    }
+    out.legs.reserve(order.legs.size());
+    int units = 0;
+    for (const auto& leg : order.legs) {
+        auto symbol = OccSymbol::parse(leg.option_symbol);
+        if (!symbol) {
+            error = "Leg " + leg.option_symbol + " is not an OCC option symbol";
+            return false;
+        }
+        if (leg.quantity <= 0) {
+            error = "Leg " + leg.option_symbol + " has no quantity";
+            return false;
+        }
+        DecodedLeg decoded;
+        decoded.symbol = *symbol;
+        decoded.quantity = is_buy(leg.side) ? leg.quantity : -leg.quantity;
+        decoded.sign = symbol->is_call() ? 1.0 : -1.0;
+        decoded.strike = symbol->strike().to_double();
+        decoded.years = years_until(*symbol, now);
+        out.legs.push_back(decoded);
+        units = units == 0 ? leg.quantity : std::min(units, leg.quantity);
+    }
+
+    out.first_expiry = out.legs.front().years;
+    for (const auto& leg : out.legs) {
+        out.single_expiry &= leg.symbol.expiry_date() == out.legs.front().symbol.expiry_date();
+        out.first_expiry = std::min(out.first_expiry, leg.years);
+        out.tail_slope += leg.sign > 0.0 ? leg.quantity * option_multiplier : 0.0;
+    }
+    // A positive net price is a debit paid, a negative one a credit received.
+    out.premium = -order.price.value_or(0.0) * option_multiplier * units;
+    return true;
+}
+
+SpreadStrategy classify(std::vector<DecodedLeg> legs, bool single_expiry) {
+    auto by_strike = [](const DecodedLeg& a, const DecodedLeg& b) { return a.strike < b.strike; };
+    auto same_size = [](const DecodedLeg& a, const DecodedLeg& b) { return std::abs(a.quantity) == std::abs(b.quantity); };
+    auto opposite = [](const DecodedLeg& a, const DecodedLeg& b) { return (a.quantity > 0) != (b.quantity > 0); };
+    const bool one_right = std::all_of(legs.begin(), legs.end(),
+                                       [&](const DecodedLeg& leg) { return leg.sign == legs.front().sign; });
+    std::sort(legs.begin(), legs.end(), by_strike);
+
+    switch (legs.size()) {
+        case 0:
+            return SpreadStrategy::Invalid;
+        case 1:
+            return SpreadStrategy::Single;
+        case 2: {
+            const auto& a = legs[0];
+            const auto& b = legs[1];
+            const bool same_strike = a.strike == b.strike;
+            if (one_right && opposite(a, b)) {
+                if (!single_expiry) {
+                    return same_strike ? SpreadStrategy::Calendar : SpreadStrategy::Diagonal;
+                }
+                if (!same_strike) {
+                    return same_size(a, b) ? SpreadStrategy::Vertical : SpreadStrategy::Ratio;
+                }
+            } else if (!one_right && single_expiry && !opposite(a, b) && same_size(a, b)) {
+                return same_strike ? SpreadStrategy::Straddle : SpreadStrategy::Strangle;
+            }
+            return SpreadStrategy::Custom;
+        }
+        case 3: {
+            const auto& [low, mid, high] = std::tie(legs[0], legs[1], legs[2]);
+            if (one_right && single_expiry && low.strike < mid.strike && mid.strike < high.strike &&
+                !opposite(low, high) && opposite(low, mid) && same_size(low, high) &&
+                std::abs(mid.quantity) == 2 * std::abs(low.quantity)) {
+                return SpreadStrategy::Butterfly;
+            }
+            return SpreadStrategy::Custom;
+        }
+        case 4: {
+            if (!single_expiry || !std::all_of(legs.begin(), legs.end(),
+                                               [&](const DecodedLeg& leg) { return same_size(leg, legs[0]); })) {
+                return SpreadStrategy::Custom;
+            }
+            if (one_right) {
+                bool condor = opposite(legs[0], legs[1]) && !opposite(legs[1], legs[2]) && opposite(legs[2], legs[3]) &&
+                              legs[1].strike < legs[2].strike;
+                return condor ? SpreadStrategy::Condor : SpreadStrategy::Custom;
+            }
+            std::vector<DecodedLeg> puts;
+            std::vector<DecodedLeg> calls;
+            for (const auto& leg : legs) {
+                (leg.sign > 0.0 ? calls : puts).push_back(leg);
+            }
+            if (puts.size() != 2 || calls.size() != 2) {
+                return SpreadStrategy::Custom;
+            }
+            // Two verticals whose inner (body) legs share a side.
+            bool iron = opposite(puts[0], puts[1]) && opposite(calls[0], calls[1]) &&
+                        !opposite(puts[1], calls[0]) && puts[0].strike < puts[1].strike &&
+                        puts[1].strike <= calls[0].strike && calls[0].strike < calls[1].strike;
+            if (!iron) {
+                return SpreadStrategy::Custom;
+            }
+            return puts[1].strike == calls[0].strike ? SpreadStrategy::IronButterfly : SpreadStrategy::IronCondor;
+        }
+        default:
+            return SpreadStrategy::Custom;
+    }
+}
+
+// Underlying prices with their logs, which every leg and vol row shares.
+struct PriceGrid {
+    std::vector<double> spot;
+    std::vector<double> log_spot;   // 0 where spot <= 0
+
+    explicit PriceGrid(std::vector<double> prices);
+};
+
+OQD_SIMD_CLONES
+void log_kernel(std::size_t n, const double* __restrict spot, double* __restrict out) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = spot[i] > 0.0 ? vlog(spot[i]) : 0.0;
+    }
+}
+
+PriceGrid::PriceGrid(std::vector<double> prices) : spot(std::move(prices)), log_spot(spot.size()) {
+    log_kernel(spot.size(), spot.data(), log_spot.data());
+}
+
+// Adds weight * Black-Scholes value of one option at every grid price.
+OQD_SIMD_CLONES
+void leg_value_kernel(std::size_t n, const double* __restrict spot, const double* __restrict log_spot,
+                      double* __restrict out, double strike, double sign, double weight, double years,
+                      double vol, double rate, double dividend_yield) {
+    const double sqrt_t = std::sqrt(years);
+    const double vol_sqrt_t = vol * sqrt_t;
+    const double inv_vol_sqrt_t = 1.0 / vol_sqrt_t;
+    const double shift = (rate - dividend_yield + 0.5 * vol * vol) * years - vlog(strike);
+    const double df_q = vexp(-dividend_yield * years);
+    const double k_df = strike * vexp(-rate * years);
+    const double at_zero = sign < 0.0 ? k_df : 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        double s = spot[i];
+        double d1 = (log_spot[i] + shift) * inv_vol_sqrt_t;
+        double d2 = d1 - vol_sqrt_t;
+        double value = sign * (s * df_q * norm_cdf(sign * d1) - k_df * norm_cdf(sign * d2));
+        out[i] += weight * (s > 0.0 ? value : at_zero);
+    }
+}
+
+OQD_SIMD_CLONES
+void leg_intrinsic_kernel(std::size_t n, const double* __restrict spot, double* __restrict out,
+                          double strike, double sign, double weight) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] += weight * std::max(0.0, sign * (spot[i] - strike));
+    }
+}
+
+// Adds the spread's dollar value at every spot, `elapsed` years from now.
+void add_spread_value(const DecodedSpread& spread, const PriceGrid& grid, double elapsed, double vol,
+                      const SpreadAnalyticsParams& params, double* out) {
+    for (const auto& leg : spread.legs) {
+        const double weight = leg.quantity * option_multiplier;
+        const double remaining = leg.years - elapsed;
+        if (remaining <= 1e-9) {
+            leg_intrinsic_kernel(grid.spot.size(), grid.spot.data(), out, leg.strike, leg.sign, weight);
+        } else {
+            leg_value_kernel(grid.spot.size(), grid.spot.data(), grid.log_spot.data(), out, leg.strike, leg.sign,
+                             weight, remaining, vol, params.rate, params.dividend_yield);
+        }
+    }
+}
+
+// Risk-neutral lognormal distribution of the underlying at the first expiry.
+class Terminal {
+public:
+    Terminal(const SpreadAnalyticsParams& params, double years)
+        : spot_(params.spot),
+          vol_sqrt_t_(std::max(params.volatility, min_volatility) * std::sqrt(years)),
+          mean_((params.rate - params.dividend_yield -
+                 0.5 * std::max(params.volatility, min_volatility) * std::max(params.volatility, min_volatility)) * years) {}
+
+    double cdf(double x) const {
+        if (x <= 0.0) {
+            return 0.0;
+        }
+        if (std::isinf(x)) {
+            return 1.0;
+        }
+        if (vol_sqrt_t_ <= 0.0 || spot_ <= 0.0) {
+            return x >= spot_ ? 1.0 : 0.0;
+        }
+        return norm_cdf((vlog(x / spot_) - mean_) / vol_sqrt_t_);
+    }
+
+private:
+    double spot_;
+    double vol_sqrt_t_;
+    double mean_;
+};
+
+// Probability that the piecewise-linear P&L through (x, v), continued with
+// `tail_slope` past the last point, is at least `threshold`.
+double probability_at_least(const std::vector<double>& x, const std::vector<double>& v, double tail_slope,
+                            double threshold, const Terminal& terminal) {
+    double probability = 0.0;
+    for (std::size_t i = 0; i + 1 < x.size(); ++i) {
+        double a = x[i];
+        double b = x[i + 1];
+        bool a_in = v[i] >= threshold;
+        bool b_in = v[i + 1] >= threshold;
+        if (!a_in && !b_in) {
+            continue;
+        }
+        if (a_in != b_in) {
+            double cross = a + (threshold - v[i]) / (v[i + 1] - v[i]) * (b - a);
+            (a_in ? b : a) = cross;
+        }
+        probability += terminal.cdf(b) - terminal.cdf(a);
+    }
+
+    double last = x.back();
+    double at_last = v.back();
+    double from = last;
+    double to = infinity;
+    if (tail_slope == 0.0) {
+        if (at_last < threshold) {
+            return probability;
+        }
+    } else {
+        double cross = last + (threshold - at_last) / tail_slope;
+        if (tail_slope > 0.0) {
+            from = std::max(last, cross);
+        } else if (at_last >= threshold) {
+            to = cross;
+        } else {
+            return probability;
+        }
+    }
+    return probability + terminal.cdf(to) - terminal.cdf(from);
+}
+
+void add_greeks(const DecodedSpread& spread, const SpreadAnalyticsParams& params, SpreadAnalysis& out) {
+    const double s = params.spot;
+    const double vol = std::max(params.volatility, min_volatility);
+    const double r = params.rate;
+    const double q = params.dividend_yield;
+    for (const auto& leg : spread.legs) {
+        const double weight = leg.quantity * option_multiplier;
+        const double t = leg.years;
+        const double w = leg.sign;
+        if (t <= 1e-9 || s <= 0.0) {
+            out.delta += weight * (w * (s - leg.strike) > 0.0 ? w : 0.0);
+            continue;
+        }
+        double sqrt_t = std::sqrt(t);
+        double vol_sqrt_t = vol * sqrt_t;
+        double df_r = vexp(-r * t);
+        double df_q = vexp(-q * t);
+        double d1 = (vlog(s / leg.strike) + (r - q + 0.5 * vol * vol) * t) / vol_sqrt_t;
+        double d2 = d1 - vol_sqrt_t;
+        double pdf = norm_pdf(d1);
+        double nd1 = norm_cdf(w * d1);
+        double nd2 = norm_cdf(w * d2);
+        double s_df = s * df_q;
+        double k_df = leg.strike * df_r;
+
+        out.delta += weight * w * df_q * nd1;
+        out.gamma += weight * df_q * pdf / (s * vol_sqrt_t);
+        out.theta += weight * (-s_df * pdf * vol / (2.0 * sqrt_t) - w * r * k_df * nd2 + w * q * s_df * nd1) /
+                     days_per_year;
+        out.vega += weight * s_df * pdf * sqrt_t * 0.01;
+    }
+}
+
+SpreadAnalysis analyze_decoded(const DecodedSpread& spread, const PriceGrid& prices,
+                               const std::vector<double>& vols, const SpreadAnalyticsParams& params) {
+    SpreadAnalysis out;
+    out.strategy = classify(spread.legs, spread.single_expiry);
+    out.net_premium = spread.premium;
+    const double base_vol = std::max(params.volatility, min_volatility);
+
+    out.expiry_pnl.assign(prices.spot.size(), spread.premium);
+    add_spread_value(spread, prices, spread.first_expiry, base_vol, params, out.expiry_pnl.data());
+
+    const double horizon = std::max(0.0, params.horizon_days) / days_per_year;
+    out.surface.assign(vols.size() * prices.spot.size(), spread.premium);
+    for (std::size_t row = 0; row < vols.size(); ++row) {
+        add_spread_value(spread, prices, horizon, vols[row], params, out.surface.data() + row * prices.spot.size());
+    }
+
+    // Single-expiry payoffs are linear between strikes, so the strikes and
+    // zero pin them down exactly; later-dated legs curve, so the grid joins in.
+    std::vector<double> points = {0.0};
+    for (const auto& leg : spread.legs) {
+        points.push_back(leg.strike);
+    }
+    if (!spread.single_expiry) {
+        points.insert(points.end(), prices.spot.begin(), prices.spot.end());
+    }
+    std::sort(points.begin(), points.end());
+    points.erase(std::unique(points.begin(), points.end()), points.end());
+    const PriceGrid kinks(std::move(points));
+    const auto& x = kinks.spot;
+    std::vector<double> values(x.size(), spread.premium);
+    add_spread_value(spread, kinks, spread.first_expiry, base_vol, params, values.data());
+
+    auto [worst, best] = std::minmax_element(values.begin(), values.end());
+    out.max_profit = spread.tail_slope > 0.0 ? infinity : std::max(0.0, *best);
+    out.max_loss = spread.tail_slope < 0.0 ? infinity : std::max(0.0, -*worst);
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (values[i] == 0.0) {
+            if (out.breakevens.empty() || out.breakevens.back() != x[i]) {
+                out.breakevens.push_back(x[i]);
+            }
+        } else if (i + 1 < x.size() && values[i + 1] != 0.0 && (values[i] < 0.0) != (values[i + 1] < 0.0)) {
+            out.breakevens.push_back(x[i] + (x[i + 1] - x[i]) * (-values[i] / (values[i + 1] - values[i])));
+        }
+    }
+    if (spread.tail_slope != 0.0 && values.back() != 0.0 && (values.back() < 0.0) == (spread.tail_slope > 0.0)) {
+        out.breakevens.push_back(x.back() - values.back() / spread.tail_slope);
+    }
+
+    Terminal terminal(params, spread.first_expiry);
+    out.probability_of_profit = probability_at_least(x, values, spread.tail_slope, cent_tolerance, terminal);
+    if (std::isfinite(out.max_profit)) {
+        out.probability_of_max_profit =
+            probability_at_least(x, values, spread.tail_slope, out.max_profit - cent_tolerance, terminal);
+    }
+    if (std::isfinite(out.max_loss)) {
+        for (auto& value : values) {
+            value = -value;
+        }
+        out.probability_of_max_loss =
+            probability_at_least(x, values, -spread.tail_slope, out.max_loss - cent_tolerance, terminal);
+    }
+
+    add_greeks(spread, params, out);
+    return out;
+}
+
+SpreadAnalysis analyze_one(const SpreadOrderRequest& order, const PriceGrid& prices,
+                           const std::vector<double>& vols, const SpreadAnalyticsParams& params) {
+    DecodedSpread spread;
+    std::string error;
+    if (!decode(order, params.now, spread, error)) {
+        SpreadAnalysis failed;
+        failed.error = std::move(error);
+        return failed;
+    }
+    return analyze_decoded(spread, prices, vols, params);
+}
+
+} // namespace
+
+std::string_view to_string(SpreadStrategy strategy) {
+    return strategy_names.name(strategy);
+}
+
+SpreadStrategy classify_spread(const SpreadOrderRequest& order) {
+    DecodedSpread spread;
+    std::string error;
+    if (!decode(order, std::chrono::system_clock::now(), spread, error)) {
+        return SpreadStrategy::Invalid;
+    }
+    return classify(std::move(spread.legs), spread.single_expiry);
+}
+
+std::vector<double> spread_price_axis(const SpreadAnalyticsParams& params) {
+    std::vector<double> axis(std::max<std::size_t>(params.price_points, 2));
+    const double low = std::max(0.0, params.spot * (1.0 - params.price_range));
+    const double high = params.spot * (1.0 + params.price_range);
+    const double step = (high - low) / static_cast<double>(axis.size() - 1);
+    for (std::size_t i = 0; i < axis.size(); ++i) {
+        axis[i] = low + step * static_cast<double>(i);
+    }
+    return axis;
+}
+
+std::vector<double> spread_vol_axis(const SpreadAnalyticsParams& params) {
+    std::vector<double> axis(std::max<std::size_t>(params.vol_points, 1));
+    const double step = axis.size() > 1
+        ? (params.vol_shift_high - params.vol_shift_low) / static_cast<double>(axis.size() - 1) : 0.0;
+    const double first = axis.size() > 1 ? params.vol_shift_low : 0.0;
+    for (std::size_t i = 0; i < axis.size(); ++i) {
+        axis[i] = std::max(min_volatility, params.volatility + first + step * static_cast<double>(i));
+    }
+    return axis;
+}
+
+SpreadAnalysis analyze_spread(const SpreadOrderRequest& order, const SpreadAnalyticsParams& params) {
+    return analyze_one(order, PriceGrid(spread_price_axis(params)), spread_vol_axis(params), params);
+}
+
+std::vector<SpreadAnalysis> analyze_spreads(std::span<const SpreadOrderRequest> orders,
+                                            const SpreadAnalyticsParams& params) {
+    const PriceGrid prices(spread_price_axis(params));
+    const auto vols = spread_vol_axis(params);
+    std::vector<SpreadAnalysis> results(orders.size());
+
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < orders.size(); i = next++) {
+            results[i] = analyze_one(orders[i], prices, vols, params);
+        }
+    };
+
+    std::size_t threads = params.threads != 0 ? params.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, orders.size());
+    if (threads <= 1) {
+        worker();
+        return results;
+    }
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers.emplace_back(worker);
+    }
+    workers.clear();
+    return results;
+}
+
+} // namespace oqd
@@ -20,7 +20,7 @@ namespace oqd {
 SpreadLeg SpreadLeg::from_json(const simdjson::dom::element& elem) {
     SpreadLeg leg;
     leg.option_symbol = std::string(elem["option_symbol"].get_string().value_unsafe());
-    leg.side = order_side_from_string(std::string(elem["side"].get_string().value_unsafe()));
+    leg.side = order_side_from_string(elem["side"].get_string().value_unsafe());
     leg.quantity = static_cast<int>(elem["quantity"].get_int64().value_unsafe());
     
     auto ratio_result = elem["ratio"];
@@ -32,7 +32,11 @@ SpreadLeg SpreadLeg::from_json(const simdjson::dom::element& elem) {
 }
 
 std::string SpreadLeg::to_json() const {
-    auto builder = json::create_object()
+    return json::write_to_string(*this);
+}
+
+void SpreadLeg::write_json(json::JsonBuilder& builder) const {
+    builder.start_object()
         .field("option_symbol", option_symbol)
         .field("side", side)
         .field("quantity", quantity);
@@ -41,7 +45,7 @@ std::string SpreadLeg::to_json() const {
         builder.set_fixed().set_precision(2).field("ratio", ratio.value());
     }
     
-    return builder.end_object().str();
+    builder.end_object();
 }
 
 std::string SpreadOrderRequest::to_json() const {
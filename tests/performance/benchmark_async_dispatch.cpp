@@ -0,0 +1,129 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "oqdTradierpp/client.hpp"
+#include "oqdTradierpp/endpoints.hpp"
+#include "oqdTradierpp/market/market_status.hpp"
+#include "../unit/loopback_server.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+// Per-call cost of TradierClient::get_endpoint_then against a loopback HTTPS
+// server: request build, pooled TLS round trip, padded read, parse and
+// decode. The nested variant adds the second std::async that ApiMethods used
+// to wrap around every client future, so the difference is the extra hop.
+class AsyncDispatchBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 2000;
+    static constexpr int WARMUP_ITERATIONS = 100;
+    static constexpr int CONCURRENT_CALLS = 16;
+
+    void SetUp() override {
+        server_ = std::make_unique<LoopbackServer>(
+            R"({"clock":{"date":"2025-06-30","description":"Market is open from 09:30 to 16:00",)"
+            R"("state":"open","timestamp":1751290200,"next_change":"16:00","next_state":"postmarket"}})");
+        client_ = std::make_unique<TradierClient>(Environment::Sandbox);
+        client_->set_base_url(server_->base_url());
+        client_->set_access_token("benchmark");
+        // Identical GETs would otherwise join one request under fan-out.
+        options_.share_in_flight = false;
+    }
+
+    void TearDown() override {
+        // Closing the pooled connections lets the server's sessions finish.
+        client_.reset();
+        server_.reset();
+    }
+
+    std::future<MarketClock> single_hop_call() {
+        return client_->get_endpoint_then(endpoints::markets::clock, {}, MarketClock::from_json, options_);
+    }
+
+    std::future<MarketClock> nested_call() {
+        return std::async(std::launch::async, [this] { return single_hop_call().get(); });
+    }
+
+    template<typename Call>
+    double benchmark_sequential(const std::string& name, Call&& call) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            call().get();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            auto clock = call().get();
+            EXPECT_EQ(clock.state, "open");
+        }
+        auto end = high_resolution_clock::now();
+
+        double avg_microseconds = duration_cast<nanoseconds>(end - start).count() / 1000.0 / ITERATIONS;
+        std::cout << name << ": " << std::fixed << std::setprecision(3)
+                  << avg_microseconds << " µs/call (" << ITERATIONS << " calls)" << std::endl;
+        return avg_microseconds;
+    }
+
+    template<typename Call>
+    double benchmark_fan_out(const std::string& name, Call&& call) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            call().get();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS / CONCURRENT_CALLS; ++i) {
+            std::vector<std::future<MarketClock>> pending;
+            pending.reserve(CONCURRENT_CALLS);
+            for (int j = 0; j < CONCURRENT_CALLS; ++j) {
+                pending.push_back(call());
+            }
+            for (auto& future : pending) {
+                EXPECT_EQ(future.get().state, "open");
+            }
+        }
+        auto end = high_resolution_clock::now();
+
+        int calls = (ITERATIONS / CONCURRENT_CALLS) * CONCURRENT_CALLS;
+        double avg_microseconds = duration_cast<nanoseconds>(end - start).count() / 1000.0 / calls;
+        std::cout << name << ": " << std::fixed << std::setprecision(3)
+                  << avg_microseconds << " µs/call (" << CONCURRENT_CALLS << " in flight)" << std::endl;
+        return avg_microseconds;
+    }
+
+    std::unique_ptr<LoopbackServer> server_;
+    std::unique_ptr<TradierClient> client_;
+    RequestOptions options_;
+};
+
+TEST_F(AsyncDispatchBenchmark, SequentialCalls) {
+    std::cout << "\n=== API Dispatch Overhead, loopback HTTPS (sequential) ===" << std::endl;
+    double nested = benchmark_sequential("Nested std::async (2 threads/call)", [this] { return nested_call(); });
+    double single = benchmark_sequential("Single hop       (1 thread/call) ", [this] { return single_hop_call(); });
+    std::cout << "Speedup: " << std::setprecision(2) << nested / single << "x" << std::endl;
+    EXPECT_GT(client_->idle_connections(), 0u);
+}
+
+TEST_F(AsyncDispatchBenchmark, FanOutCalls) {
+    std::cout << "\n=== API Dispatch Overhead, loopback HTTPS (fan-out) ===" << std::endl;
+    double nested = benchmark_fan_out("Nested std::async (2 threads/call)", [this] { return nested_call(); });
+    double single = benchmark_fan_out("Single hop       (1 thread/call) ", [this] { return single_hop_call(); });
+    std::cout << "Speedup: " << std::setprecision(2) << nested / single << "x" << std::endl;
+}
@@ -18,6 +18,8 @@
 #include <iomanip>
 #include <numeric>
 #include "oqdTradierpp/core/json_builder.hpp"
+#include "oqdTradierpp/market/option_chain.hpp"
+#include "oqdTradierpp/trading/order.hpp"
 
 using namespace oqd::json;
 using namespace std::chrono;
@@ -28,22 +30,22 @@ protected:
     static constexpr int WARMUP_ITERATIONS = 1000;
     
     template<typename Func>
-    double benchmark_function(const std::string& name, Func&& func) {
-        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+    double benchmark_function(const std::string& name, Func&& func, int iterations = ITERATIONS) {
+        for (int i = 0; i < std::min(WARMUP_ITERATIONS, iterations); ++i) {
             func();
         }
         
         auto start = high_resolution_clock::now();
-        for (int i = 0; i < ITERATIONS; ++i) {
+        for (int i = 0; i < iterations; ++i) {
             func();
         }
         auto end = high_resolution_clock::now();
         
         auto duration = duration_cast<microseconds>(end - start).count();
-        double avg_microseconds = static_cast<double>(duration) / ITERATIONS;
+        double avg_microseconds = static_cast<double>(duration) / iterations;
         
         std::cout << name << ": " << std::fixed << std::setprecision(3) 
-                  << avg_microseconds << " µs/op (" << ITERATIONS << " iterations)" << std::endl;
+                  << avg_microseconds << " µs/op (" << iterations << " iterations)" << std::endl;
         
         return avg_microseconds;
     }
@@ -189,4 +191,120 @@ TEST_F(JsonBuilderBenchmark, ClearAndReuse) {
         auto result = builder.str();
         (void)result;
     });
-}
\ No newline at end of file
+}
+
+namespace {
+
+// The pre-write_json path: every child renders its own string, which the
+// parent then copies.
+template<typename T>
+struct ViaToJson {
+    const T* value;
+    std::string to_json() const { return value->to_json(); }
+};
+
+template<typename T>
+std::vector<ViaToJson<T>> via_to_json(const std::vector<T>& values) {
+    std::vector<ViaToJson<T>> wrapped;
+    for (const auto& value : values) {
+        wrapped.push_back({&value});
+    }
+    return wrapped;
+}
+
+} // namespace
+
+TEST_F(JsonBuilderBenchmark, NestedOptionChain) {
+    oqd::OptionChain chain;
+    chain.underlying = "SPY";
+    for (int i = 0; i < 5000; ++i) {
+        oqd::Quote quote{};
+        quote.symbol = "SPY250117C00" + std::to_string(300000 + i * 1000);
+        quote.description = "SPY Jan 17 2025 Call";
+        quote.type = "option";
+        quote.last = 1.25 + i * 0.01;
+        quote.bid = quote.last - 0.05;
+        quote.ask = quote.last + 0.05;
+        chain.options.push_back(quote);
+    }
+    auto wrapped = via_to_json(chain.options);
+    auto legacy = [&]() {
+        return create_object()
+            .field("underlying", chain.underlying)
+            .array_field("options", wrapped)
+            .end_object().str();
+    };
+    ASSERT_EQ(chain.to_json(), legacy());
+
+    double in_place = benchmark_function("5000-option chain (write_json in place)", [&]() {
+        auto result = chain.to_json();
+        (void)result;
+    }, 20);
+    double per_child = benchmark_function("5000-option chain (per-child to_json)", [&]() {
+        auto result = legacy();
+        (void)result;
+    }, 20);
+    std::cout << "  speedup: " << std::setprecision(2) << per_child / in_place << "x" << std::endl;
+}
+
+TEST_F(JsonBuilderBenchmark, NestedOrderList) {
+    std::vector<oqd::Order> orders(500);
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        auto& order = orders[i];
+        order.id = std::to_string(100000 + i);
+        order.symbol = "SPY";
+        order.quantity = 4;
+        order.price = 1.05;
+        order.create_date = "2025-01-02T14:30:00.000Z";
+        order.transaction_date = order.create_date;
+        for (int leg = 0; leg < 4; ++leg) {
+            order.legs.push_back({"SPY250117C0050" + std::to_string(leg) + "000", oqd::OrderSide::BuyToOpen, 1});
+        }
+    }
+    auto wrapped = via_to_json(orders);
+    auto list = [](const auto& values) {
+        auto builder = create_array();
+        for (const auto& value : values) {
+            builder.element(value);
+        }
+        return std::move(builder.end_array()).str();
+    };
+    ASSERT_EQ(list(orders), list(wrapped));
+
+    double in_place = benchmark_function("500 orders x 4 legs (write_json in place)", [&]() {
+        auto result = list(orders);
+        (void)result;
+    }, 200);
+    double per_child = benchmark_function("500 orders x 4 legs (per-child to_json)", [&]() {
+        auto result = list(wrapped);
+        (void)result;
+    }, 200);
+    std::cout << "  speedup: " << std::setprecision(2) << per_child / in_place << "x" << std::endl;
+}
+
+TEST_F(JsonBuilderBenchmark, ReusedWriterLoop) {
+    std::vector<oqd::Quote> quotes(1000);
+    for (std::size_t i = 0; i < quotes.size(); ++i) {
+        quotes[i].symbol = "SPY250117C00" + std::to_string(400 + i) + "000";
+        quotes[i].description = "SPY Jan 17 2025 Call";
+        quotes[i].last = 1.25 + i * 0.01;
+        quotes[i].bid = quotes[i].last - 0.05;
+        quotes[i].ask = quotes[i].last + 0.05;
+    }
+    std::size_t bytes = 0;
+
+    double fresh = benchmark_function("1000 quotes (fresh to_json each)", [&]() {
+        for (const auto& quote : quotes) {
+            bytes += quote.to_json().size();
+        }
+    }, 200);
+    std::string target;
+    double reused = benchmark_function("1000 quotes (reused JsonWriter)", [&]() {
+        for (const auto& quote : quotes) {
+            target.clear();
+            JsonWriter writer(target);
+            bytes += to_json_into(writer, quote).size();
+        }
+    }, 200);
+    std::cout << "  speedup: " << std::setprecision(2) << fresh / reused << "x (" << bytes << " bytes)" << std::endl;
+}
@@ -0,0 +1,151 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+#include "oqdTradierpp/core/number_format.hpp"
+#include "oqdTradierpp/streaming.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class NumberFormatBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 200;
+    static constexpr int WARMUP_ITERATIONS = 10;
+    static constexpr std::size_t PRICE_COUNT = 10000;
+
+    void SetUp() override {
+        std::mt19937_64 rng(7);
+        std::uniform_int_distribution<int> cents(1, 5000000);
+        for (std::size_t i = 0; i < PRICE_COUNT; ++i) {
+            prices_.push_back(cents(rng) / 100.0);
+        }
+    }
+
+    template<typename Func>
+    double benchmark_function(const std::string& name, Func&& func) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            func();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+        auto end = high_resolution_clock::now();
+
+        double avg_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) /
+                        (static_cast<double>(ITERATIONS) * PRICE_COUNT);
+        std::cout << name << ": " << std::fixed << std::setprecision(1) << avg_ns << " ns/value" << std::endl;
+        return avg_ns;
+    }
+
+    std::vector<double> prices_;
+    std::array<char, 64> buffer_{};
+    std::size_t bytes_ = 0;
+};
+
+TEST_F(NumberFormatBenchmark, FixedTwoDecimals) {
+    double scaled = benchmark_function("format_fixed (scaled integer)", [&]() {
+        for (double price : prices_) {
+            auto result = json::format_fixed(buffer_.data(), buffer_.data() + buffer_.size(), price, 2);
+            bytes_ += result.ptr - buffer_.data();
+        }
+    });
+    double chars = benchmark_function("std::to_chars fixed", [&]() {
+        for (double price : prices_) {
+            auto result = std::to_chars(buffer_.data(), buffer_.data() + buffer_.size(), price,
+                                        std::chars_format::fixed, 2);
+            bytes_ += result.ptr - buffer_.data();
+        }
+    });
+    double printf_path = benchmark_function("snprintf %.2f", [&]() {
+        for (double price : prices_) {
+            bytes_ += std::snprintf(buffer_.data(), buffer_.size(), "%.*f", 2, price);
+        }
+    });
+    double stream = benchmark_function("ostringstream setprecision(2)", [&]() {
+        for (double price : prices_) {
+            std::ostringstream oss;
+            oss << std::fixed << std::setprecision(2) << price;
+            bytes_ += oss.str().size();
+        }
+    });
+    std::cout << "  vs to_chars: " << std::setprecision(2) << chars / scaled << "x, vs snprintf: "
+              << printf_path / scaled << "x, vs ostringstream: " << stream / scaled << "x" << std::endl;
+    EXPECT_GT(bytes_, 0u);
+}
+
+TEST_F(NumberFormatBenchmark, Shortest) {
+    double chars = benchmark_function("format_shortest", [&]() {
+        for (double price : prices_) {
+            auto result = json::format_shortest(buffer_.data(), buffer_.data() + buffer_.size(), price);
+            bytes_ += result.ptr - buffer_.data();
+        }
+    });
+    double printf_path = benchmark_function("snprintf %.17g", [&]() {
+        for (double price : prices_) {
+            bytes_ += std::snprintf(buffer_.data(), buffer_.size(), "%.17g", price);
+        }
+    });
+    std::cout << "  vs snprintf: " << std::setprecision(2) << printf_path / chars << "x" << std::endl;
+    EXPECT_GT(bytes_, 0u);
+}
+
+TEST_F(NumberFormatBenchmark, StreamingQuoteToJson) {
+    std::vector<StreamingQuote> quotes(PRICE_COUNT);
+    for (std::size_t i = 0; i < quotes.size(); ++i) {
+        quotes[i].symbol = "SPY";
+        quotes[i].bid = prices_[i];
+        quotes[i].ask = prices_[i] + 0.01;
+        quotes[i].last = prices_[i];
+        quotes[i].bid_size = 3;
+        quotes[i].ask_size = 5;
+        quotes[i].last_size = 100;
+        quotes[i].bid_exch = "Q";
+        quotes[i].ask_exch = "P";
+    }
+    // The ostringstream serializer StreamingQuote used before JsonBuilder.
+    auto legacy = [](const StreamingQuote& quote) {
+        std::ostringstream oss;
+        oss << std::fixed << std::setprecision(2);
+        oss << R"({"symbol":")" << quote.symbol << R"(","bid":)" << quote.bid << R"(,"ask":)" << quote.ask
+            << R"(,"last":)" << quote.last << R"(,"bid_size":)" << quote.bid_size
+            << R"(,"ask_size":)" << quote.ask_size << R"(,"last_size":)" << quote.last_size
+            << R"(,"bid_exch":")" << quote.bid_exch << R"(","ask_exch":")" << quote.ask_exch
+            << R"(","timestamp":)"
+            << duration_cast<seconds>(quote.timestamp.time_since_epoch()).count() << "}";
+        return oss.str();
+    };
+    ASSERT_EQ(quotes[0].to_json(), legacy(quotes[0]));
+
+    double builder = benchmark_function("StreamingQuote::to_json (JsonBuilder)", [&]() {
+        for (const auto& quote : quotes) {
+            bytes_ += quote.to_json().size();
+        }
+    });
+    double stream = benchmark_function("StreamingQuote (ostringstream)", [&]() {
+        for (const auto& quote : quotes) {
+            bytes_ += legacy(quote).size();
+        }
+    });
+    std::cout << "  speedup: " << std::setprecision(2) << stream / builder << "x" << std::endl;
+}
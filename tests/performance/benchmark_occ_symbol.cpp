@@ -0,0 +1,90 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+#include "oqdTradierpp/core/occ_symbol.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OccSymbolBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 20;
+
+    void SetUp() override {
+        // A chain's worth of symbols: 40 expiries x 100 strikes x both rights.
+        for (int expiry = 0; expiry < 40; ++expiry) {
+            for (int strike = 0; strike < 100; ++strike) {
+                for (OccSymbol::Right right : {OccSymbol::Right::Call, OccSymbol::Right::Put}) {
+                    auto symbol = OccSymbol::make("SPY", sys_days(2025y / January / 3) + days(7 * expiry), right,
+                                                  Price::from_cents(40000 + strike * 100));
+                    texts_.push_back(symbol->to_string());
+                }
+            }
+        }
+    }
+
+    template<typename Func>
+    double benchmark_function(const std::string& name, Func&& func) {
+        func();
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+        auto end = high_resolution_clock::now();
+        double avg_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) /
+                        (static_cast<double>(ITERATIONS) * static_cast<double>(texts_.size()));
+        std::cout << name << ": " << std::fixed << std::setprecision(1) << avg_ns << " ns/symbol" << std::endl;
+        return avg_ns;
+    }
+
+    std::vector<std::string> texts_;
+};
+
+TEST_F(OccSymbolBenchmark, ParseVersusRegex) {
+    std::size_t valid = 0;
+    double codec = benchmark_function("OccSymbol::parse", [&]() {
+        for (const auto& text : texts_) {
+            valid += OccSymbol::parse(text).has_value() ? 1 : 0;
+        }
+    });
+    double regex = benchmark_function("std::regex_match (previous validator)", [&]() {
+        std::regex pattern("^[A-Z]+[0-9]{6}[CP][0-9]{8}$");
+        for (const auto& text : texts_) {
+            valid += std::regex_match(text, pattern) ? 1 : 0;
+        }
+    });
+    EXPECT_EQ(valid, 2 * (ITERATIONS + 1) * texts_.size());
+    std::cout << "  speedup: " << std::setprecision(1) << regex / codec << "x" << std::endl;
+}
+
+TEST_F(OccSymbolBenchmark, Format) {
+    std::vector<OccSymbol> symbols;
+    for (const auto& text : texts_) {
+        symbols.push_back(*OccSymbol::parse(text));
+    }
+    std::array<char, OccSymbol::max_length> buffer;
+    std::size_t bytes = 0;
+    benchmark_function("OccSymbol::to_chars", [&]() {
+        for (const auto& symbol : symbols) {
+            bytes += static_cast<std::size_t>(symbol.to_chars(buffer.data(), buffer.data() + buffer.size()).ptr - buffer.data());
+        }
+    });
+    EXPECT_EQ(bytes, 18 * (ITERATIONS + 1) * symbols.size());
+}
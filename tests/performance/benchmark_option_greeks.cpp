@@ -0,0 +1,104 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include "oqdTradierpp/market/option_greeks.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OptionGreeksBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 200;
+    static constexpr int WARMUP_ITERATIONS = 10;
+    static constexpr std::size_t CHAIN_SIZE = 10000;
+
+    void SetUp() override {
+        params_.spot = 500.0;
+        params_.rate = 0.045;
+        params_.dividend_yield = 0.013;
+
+        // 10k contracts: 50 expirations x 100 strikes x call/put, priced at a
+        // volatility smile so the solver sees realistic inputs.
+        std::vector<double> smile;
+        for (std::size_t e = 0; e < 50; ++e) {
+            double years = 0.01 + 0.04 * static_cast<double>(e);
+            for (std::size_t s = 0; s < 100; ++s) {
+                double strike = 300.0 + 4.0 * static_cast<double>(s);
+                double moneyness = std::log(strike / params_.spot);
+                double vol = 0.18 + 0.4 * moneyness * moneyness - 0.1 * moneyness;
+                for (bool call : {true, false}) {
+                    columns_.push_back(strike, years, call, 0.0);
+                    smile.push_back(vol);
+                }
+            }
+        }
+        GreeksColumns priced;
+        compute_greeks(columns_, smile, params_, priced);
+        columns_.price = priced.theoretical;
+    }
+
+    template<typename Func>
+    double benchmark_function(const std::string& name, Func&& func) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            func();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+        auto end = high_resolution_clock::now();
+
+        auto duration = duration_cast<microseconds>(end - start).count();
+        double avg_microseconds = static_cast<double>(duration) / ITERATIONS;
+
+        std::cout << name << ": " << std::fixed << std::setprecision(3)
+                  << avg_microseconds << " µs/op, "
+                  << avg_microseconds * 1000.0 / CHAIN_SIZE << " ns/contract ("
+                  << ITERATIONS << " iterations)" << std::endl;
+
+        return avg_microseconds;
+    }
+
+    GreeksParams params_;
+    OptionColumns columns_;
+};
+
+TEST_F(OptionGreeksBenchmark, GreeksFor10kContracts) {
+    ASSERT_EQ(columns_.size(), CHAIN_SIZE);
+    std::cout << "Greeks kernel ISA: " << greeks_kernel_isa() << std::endl;
+    std::vector<double> vols(CHAIN_SIZE, 0.2);
+    GreeksColumns out;
+    benchmark_function("Greeks (10k contracts)", [&]() {
+        compute_greeks(columns_, vols, params_, out);
+    });
+}
+
+TEST_F(OptionGreeksBenchmark, ImpliedVolatilityFor10kContracts) {
+    std::vector<double> iv;
+    benchmark_function("Implied volatility (10k contracts)", [&]() {
+        compute_implied_volatility(columns_, params_, iv);
+    });
+}
+
+TEST_F(OptionGreeksBenchmark, FullChainAnalysisFor10kContracts) {
+    benchmark_function("IV + greeks (10k contracts)", [&]() {
+        auto out = analyze_chain(columns_, params_);
+        (void)out;
+    });
+}
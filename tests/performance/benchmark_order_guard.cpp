@@ -0,0 +1,88 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "oqdTradierpp/trading/order_guard.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OrderGuardBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 20;
+    static constexpr std::size_t ORDERS = 100000;
+
+    void SetUp() override {
+        for (std::size_t i = 0; i < ORDERS; ++i) {
+            EquityOrderRequest order;
+            order.symbol = "SYM" + std::to_string(i % 500);
+            order.side = i % 2 ? OrderSide::Buy : OrderSide::Sell;
+            order.quantity = static_cast<int>(i % 1000) + 1;
+            order.type = OrderType::Limit;
+            order.price = 10.0 + static_cast<double>(i % 9000) * 0.01;
+            orders_.push_back(order);
+        }
+    }
+
+    // Every check on, none binding, so each admit runs the full path.
+    static OrderGuardLimits open_limits() {
+        return {.max_orders_per_account = 1u << 23, .max_orders_per_symbol = 1u << 23,
+                .rate_window = milliseconds(1000), .duplicate_window = milliseconds(1)};
+    }
+
+    std::vector<EquityOrderRequest> orders_;
+};
+
+TEST_F(OrderGuardBenchmark, AdmitLatency) {
+    std::size_t allowed = 0;
+    auto start = high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        OrderSubmissionGuard guard(open_limits());
+        for (const auto& order : orders_) {
+            allowed += guard.admit("ACC", order) == GuardVerdict::Allowed ? 1 : 0;
+        }
+    }
+    auto end = high_resolution_clock::now();
+    double avg_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) /
+                    (static_cast<double>(ITERATIONS) * ORDERS);
+    std::cout << "admit (rate + duplicate checks): " << std::fixed << std::setprecision(1)
+              << avg_ns << " ns/order" << std::endl;
+    EXPECT_GT(allowed, 0u);
+    EXPECT_LT(avg_ns, 1000.0);
+}
+
+TEST_F(OrderGuardBenchmark, ContendedAdmit) {
+    OrderSubmissionGuard guard(open_limits());
+    constexpr int THREADS = 4;
+    auto start = high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (std::size_t i = static_cast<std::size_t>(t); i < ORDERS; i += THREADS) {
+                guard.admit("ACC", orders_[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = high_resolution_clock::now();
+    double avg_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) / ORDERS;
+    std::cout << "admit, " << THREADS << " threads on one account: " << std::fixed << std::setprecision(1)
+              << avg_ns << " ns/order (wall)" << std::endl;
+}
@@ -0,0 +1,86 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "oqdTradierpp/trading/risk_engine.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class RiskEngineBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 200;
+    static constexpr int WARMUP_ITERATIONS = 10;
+    static constexpr std::size_t SYMBOLS = 2000;
+    static constexpr std::size_t BATCH = 10000;
+
+    void SetUp() override {
+        // Every limit on, none binding, so each check runs the full sequence.
+        engine_.set_limits({.max_order_notional = 1e12, .max_open_notional = 1e18, .max_position = 1e12,
+                            .max_orders_per_second = 1e12, .price_band = 0.5});
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<double> prices(5.0, 500.0);
+        std::uniform_int_distribution<std::size_t> symbols(0, SYMBOLS - 1);
+        for (std::size_t i = 0; i < SYMBOLS; ++i) {
+            auto id = engine_.symbol_id("SYM" + std::to_string(i));
+            engine_.set_last_price(id, prices(rng));
+        }
+        for (std::size_t i = 0; i < BATCH; ++i) {
+            auto id = static_cast<std::uint32_t>(symbols(rng));
+            orders_.push_back({id, i % 2 ? OrderSide::Buy : OrderSide::Sell, 100.0, 0.0});
+        }
+        decisions_.resize(BATCH);
+    }
+
+    template<typename Func>
+    double benchmark_function(const std::string& name, Func&& func) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            func();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+        auto end = high_resolution_clock::now();
+
+        double avg_ns = static_cast<double>(duration_cast<nanoseconds>(end - start).count()) /
+                        (static_cast<double>(ITERATIONS) * BATCH);
+        std::cout << name << ": " << std::fixed << std::setprecision(1) << avg_ns << " ns/order" << std::endl;
+        return avg_ns;
+    }
+
+    PreTradeRiskEngine engine_;
+    std::vector<RiskOrder> orders_;
+    std::vector<RiskDecision> decisions_;
+};
+
+TEST_F(RiskEngineBenchmark, BatchVersusSingleChecks) {
+    std::size_t accepted = 0;
+    double batch = benchmark_function("check_batch (10k orders, 2k symbols)", [&]() {
+        accepted += engine_.check_batch(orders_, decisions_);
+    });
+    double single = benchmark_function("check per order", [&]() {
+        for (const auto& order : orders_) {
+            accepted += engine_.check(order).accepted() ? 1 : 0;
+        }
+    });
+    EXPECT_EQ(accepted, 2 * (ITERATIONS + WARMUP_ITERATIONS) * BATCH);
+    EXPECT_LT(batch, 1000.0);
+    std::cout << "  batch speedup: " << std::setprecision(2) << single / batch << "x" << std::endl;
+}
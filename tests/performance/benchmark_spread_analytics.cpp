@@ -0,0 +1,105 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "oqdTradierpp/market/option_greeks.hpp"
+#include "oqdTradierpp/trading/spread_analytics.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class SpreadAnalyticsBenchmark : public ::testing::Test {
+protected:
+    static constexpr int ITERATIONS = 20;
+    static constexpr int WARMUP_ITERATIONS = 2;
+    static constexpr std::size_t CANDIDATES = 1000;
+
+    void SetUp() override {
+        params_.spot = 500.0;
+        params_.rate = 0.045;
+        params_.dividend_yield = 0.013;
+        params_.volatility = 0.2;
+        params_.now = sys_days{2024y / January / 2} + hours{20};
+
+        // 1000 iron condors: 10 wing widths over 100 short-strike pairs.
+        for (int width = 1; width <= 10; ++width) {
+            for (int offset = 0; offset < 100; ++offset) {
+                int put = 400 + offset;
+                int call = 500 + offset;
+                SpreadOrderRequest order{};
+                order.type = OrderType::Limit;
+                order.duration = OrderDuration::Day;
+                order.price = -1.5;
+                order.legs = {leg('P', put - 5 * width, OrderSide::BuyToOpen), leg('P', put, OrderSide::SellToOpen),
+                              leg('C', call, OrderSide::SellToOpen), leg('C', call + 5 * width, OrderSide::BuyToOpen)};
+                orders_.push_back(std::move(order));
+            }
+        }
+    }
+
+    static SpreadLeg leg(char right, int strike, OrderSide side) {
+        char symbol[32];
+        std::snprintf(symbol, sizeof(symbol), "SPY240216%c%05d000", right, strike);
+        return SpreadLeg{symbol, side, 1, std::nullopt};
+    }
+
+    template<typename Func>
+    double benchmark_function(const std::string& name, Func&& func) {
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i) {
+            func();
+        }
+
+        auto start = high_resolution_clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+        auto end = high_resolution_clock::now();
+
+        auto duration = duration_cast<microseconds>(end - start).count();
+        double avg_microseconds = static_cast<double>(duration) / ITERATIONS;
+
+        std::cout << name << ": " << std::fixed << std::setprecision(3)
+                  << avg_microseconds << " µs/op, "
+                  << avg_microseconds / CANDIDATES << " µs/spread ("
+                  << ITERATIONS << " iterations)" << std::endl;
+
+        return avg_microseconds;
+    }
+
+    SpreadAnalyticsParams params_;
+    std::vector<SpreadOrderRequest> orders_;
+};
+
+TEST_F(SpreadAnalyticsBenchmark, SingleThreaded1kIronCondors) {
+    std::cout << "Grid kernel ISA: " << greeks_kernel_isa() << std::endl;
+    params_.threads = 1;
+    std::vector<SpreadAnalysis> results;
+    benchmark_function("Spread analytics, 1 thread (1k spreads, 201x5 grid)", [&]() {
+        results = analyze_spreads(orders_, params_);
+    });
+    ASSERT_EQ(results.size(), CANDIDATES);
+    EXPECT_EQ(results.front().strategy, SpreadStrategy::IronCondor);
+}
+
+TEST_F(SpreadAnalyticsBenchmark, AllThreads1kIronCondors) {
+    std::vector<SpreadAnalysis> results;
+    benchmark_function("Spread analytics, all threads (1k spreads, 201x5 grid)", [&]() {
+        results = analyze_spreads(orders_, params_);
+    });
+    ASSERT_EQ(results.size(), CANDIDATES);
+}
@@ -0,0 +1,51 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+// Test fakes call pass() from each simulated request. A caller is held until
+// `target` callers have been inside at once, so the recorded peak shows how
+// much concurrency the code under test allowed without relying on timing.
+// The timeout only keeps a broken scheduler from hanging the test.
+class ConcurrencyGate {
+public:
+    void set_target(int target) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        target_ = target;
+    }
+
+    void pass() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        peak_ = std::max(peak_, ++inside_);
+        opened_.notify_all();
+        opened_.wait_for(lock, std::chrono::seconds(5), [this] { return peak_ >= target_; });
+        --inside_;
+    }
+
+    int peak() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return peak_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::condition_variable opened_;
+    int inside_ = 0;
+    int peak_ = 0;
+    int target_ = 0;
+};
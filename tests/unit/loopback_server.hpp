@@ -0,0 +1,139 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/http.hpp>
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+
+// HTTPS server on 127.0.0.1 answering every request with one canned JSON
+// body over keep-alive connections, one thread per connection. The
+// certificate is self-signed and generated at start-up; the client accepts
+// it because its verify callback admits every peer.
+class LoopbackServer {
+public:
+    explicit LoopbackServer(std::string body)
+        : body_(std::move(body)), ssl_(boost::asio::ssl::context::tlsv12_server),
+          acceptor_(io_, {boost::asio::ip::make_address("127.0.0.1"), 0}) {
+        install_self_signed_certificate();
+        accept_thread_ = std::thread([this] { accept_loop(); });
+    }
+
+    ~LoopbackServer() {
+        stopping_ = true;
+        // Wake the blocking accept with a throwaway connection.
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::socket wake(io_);
+        wake.connect(acceptor_.local_endpoint(), ec);
+        accept_thread_.join();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& session : sessions_) {
+            session.join();
+        }
+    }
+
+    std::string base_url() const { return "https://127.0.0.1:" + std::to_string(acceptor_.local_endpoint().port()); }
+
+private:
+    using TlsStream = boost::asio::ssl::stream<boost::asio::ip::tcp::socket>;
+
+    void install_self_signed_certificate() {
+        EVP_PKEY* key = EVP_EC_gen("P-256");
+        X509* cert = X509_new();
+        if (!key || !cert) {
+            throw std::runtime_error("could not create loopback certificate");
+        }
+        X509_set_version(cert, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+        X509_gmtime_adj(X509_getm_notAfter(cert), 24 * 3600);
+        X509_set_pubkey(cert, key);
+        X509_NAME* name = X509_get_subject_name(cert);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("127.0.0.1"), -1, -1, 0);
+        X509_set_issuer_name(cert, name);
+        X509_sign(cert, key, EVP_sha256());
+        bool installed = SSL_CTX_use_certificate(ssl_.native_handle(), cert) == 1 &&
+                         SSL_CTX_use_PrivateKey(ssl_.native_handle(), key) == 1;
+        X509_free(cert);
+        EVP_PKEY_free(key);
+        if (!installed) {
+            throw std::runtime_error("could not install loopback certificate");
+        }
+    }
+
+    void accept_loop() {
+        for (;;) {
+            boost::asio::ip::tcp::socket socket(io_);
+            boost::system::error_code ec;
+            acceptor_.accept(socket, ec);
+            if (stopping_) {
+                return;
+            }
+            if (ec) {
+                continue;
+            }
+            socket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+            std::lock_guard<std::mutex> lock(mutex_);
+            sessions_.emplace_back([this, socket = std::move(socket)]() mutable { serve(std::move(socket)); });
+        }
+    }
+
+    // Answers requests until the client closes the connection.
+    void serve(boost::asio::ip::tcp::socket socket) {
+        namespace http = boost::beast::http;
+        TlsStream stream(std::move(socket), ssl_);
+        boost::system::error_code ec;
+        stream.handshake(TlsStream::server, ec);
+        if (ec) {
+            return;
+        }
+        boost::beast::flat_buffer buffer;
+        for (;;) {
+            http::request<http::string_body> request;
+            http::read(stream, buffer, request, ec);
+            if (ec) {
+                return;
+            }
+            http::response<http::string_body> response{http::status::ok, request.version()};
+            response.set(http::field::content_type, "application/json");
+            response.keep_alive(request.keep_alive());
+            response.body() = body_;
+            response.prepare_payload();
+            http::write(stream, response, ec);
+            if (ec || !response.keep_alive()) {
+                return;
+            }
+        }
+    }
+
+    std::string body_;
+    boost::asio::io_context io_;
+    boost::asio::ssl::context ssl_;
+    boost::asio::ip::tcp::acceptor acceptor_;
+    std::atomic<bool> stopping_{false};
+    std::mutex mutex_;
+    std::vector<std::thread> sessions_;
+    std::thread accept_thread_;
+};
+
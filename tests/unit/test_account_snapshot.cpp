@@ -0,0 +1,216 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include "concurrency_gate.hpp"
+#include "oqdTradierpp/account/account_snapshot.hpp"
+#include "oqdTradierpp/connection_pool.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class AccountSnapshotTest : public ::testing::Test {
+protected:
+    // Fake endpoint; every response passes through the concurrency gate.
+    template<typename T>
+    auto endpoint(T value) {
+        return [this, value](const std::string& account_id) {
+            return std::async(std::launch::async, [this, value, account_id] {
+                gate_.pass();
+                if (account_id == "VA-broken") {
+                    throw std::runtime_error("HTTP error: 401");
+                }
+                return value;
+            });
+        };
+    }
+
+    ConcurrencyGate gate_;
+};
+
+TEST_F(AccountSnapshotTest, FetchesEveryAccountConcurrently) {
+    std::vector<std::string> ids;
+    for (int i = 0; i < 20; ++i) {
+        ids.push_back("VA" + std::to_string(i));
+    }
+    AccountBalances balances;
+    balances.total_equity = 1000.0;
+    AccountSnapshotOptions options;
+    options.max_in_flight = 30;
+    RequestWindowBudget budget(0, seconds(60));
+
+    gate_.set_target(30);
+    auto snapshot = gather_account_snapshots(ids, options, budget,
+                                             endpoint(balances),
+                                             endpoint(std::vector<Position>(2)),
+                                             endpoint(std::vector<Order>(1)));
+
+    ASSERT_EQ(snapshot.accounts.size(), 20u);
+    EXPECT_TRUE(snapshot.ok());
+    EXPECT_EQ(snapshot.requests, 60u);
+    EXPECT_EQ(snapshot.accounts[7].account_id, "VA7");
+    EXPECT_DOUBLE_EQ(snapshot.accounts[7].balances.value->total_equity, 1000.0);
+    EXPECT_EQ(snapshot.accounts[19].positions.value->size(), 2u);
+    // The whole in-flight bound was outstanding at once.
+    EXPECT_EQ(gate_.peak(), 30);
+    EXPECT_EQ(snapshot.budget_waits, 0u);
+}
+
+TEST_F(AccountSnapshotTest, BoundsInFlightRequests) {
+    std::vector<std::string> ids{"VA1", "VA2", "VA3", "VA4"};
+    AccountSnapshotOptions options;
+    options.max_in_flight = 3;
+    RequestWindowBudget budget(0, seconds(60));
+    gate_.set_target(3);
+    auto snapshot = gather_account_snapshots(ids, options, budget,
+                                             endpoint(AccountBalances{}),
+                                             endpoint(std::vector<Position>{}),
+                                             endpoint(std::vector<Order>{}));
+    EXPECT_TRUE(snapshot.ok());
+    EXPECT_EQ(gate_.peak(), 3);
+}
+
+TEST_F(AccountSnapshotTest, ReportsFailuresPerAccountAndPart) {
+    std::vector<std::string> ids{"VA1", "VA-broken", "VA2"};
+    RequestWindowBudget budget(0, seconds(60));
+    auto snapshot = gather_account_snapshots(
+        ids, AccountSnapshotOptions{}, budget,
+        endpoint(AccountBalances{}),
+        endpoint(std::vector<Position>{}),
+        [](const std::string&) -> std::future<std::vector<Order>> { throw std::invalid_argument("bad id"); });
+
+    EXPECT_FALSE(snapshot.ok());
+    EXPECT_EQ(snapshot.failed_accounts(), (std::vector<std::string>{"VA1", "VA-broken", "VA2"}));
+    EXPECT_TRUE(snapshot.accounts[0].balances.ok());
+    EXPECT_EQ(snapshot.accounts[0].orders.error, "bad id");
+    EXPECT_FALSE(snapshot.accounts[1].balances.ok());
+    EXPECT_EQ(snapshot.accounts[1].balances.error, "HTTP error: 401");
+}
+
+TEST_F(AccountSnapshotTest, LatencyComesFromTheCompletionStamp) {
+    // Each response is stamped 5ms after it was issued but only becomes ready
+    // 50ms later, so a latency taken at collection would be at least 50ms.
+    auto stamped = [](auto value) {
+        return [value](const std::string&) {
+            auto issued = steady_clock::now();
+            return std::async(std::launch::async, [value, issued] {
+                std::this_thread::sleep_for(milliseconds(50));
+                return Timed<decltype(value)>{value, issued + milliseconds(5)};
+            });
+        };
+    };
+    std::vector<std::string> ids{"VA1", "VA2"};
+    RequestWindowBudget budget(0, seconds(60));
+    auto snapshot = gather_account_snapshots(ids, AccountSnapshotOptions{}, budget,
+                                             stamped(AccountBalances{}),
+                                             stamped(std::vector<Position>(1)),
+                                             stamped(std::vector<Order>{}));
+    ASSERT_TRUE(snapshot.ok());
+    EXPECT_EQ(snapshot.accounts[1].positions.value->size(), 1u);
+    for (const auto& account : snapshot.accounts) {
+        EXPECT_GE(account.latency(), milliseconds(5));
+        EXPECT_LT(account.latency(), milliseconds(50));
+    }
+}
+
+TEST_F(AccountSnapshotTest, DeferredResponsesDoNotWaitBehindSlowOnes) {
+    // With room for two requests, the deferred positions response is taken
+    // ahead of the slow balances one, so orders are issued without waiting.
+    AccountSnapshotOptions options;
+    options.max_in_flight = 2;
+    std::vector<std::string> ids{"VA1"};
+    RequestWindowBudget budget(0, seconds(60));
+    auto started = steady_clock::now();
+    steady_clock::time_point orders_issued;
+    auto snapshot = gather_account_snapshots(
+        ids, options, budget,
+        [](const std::string&) {
+            return std::async(std::launch::async, [] {
+                std::this_thread::sleep_for(milliseconds(200));
+                return AccountBalances{};
+            });
+        },
+        [](const std::string&) {
+            return std::async(std::launch::deferred, [] { return std::vector<Position>(1); });
+        },
+        [&orders_issued](const std::string&) {
+            orders_issued = steady_clock::now();
+            return std::async(std::launch::deferred, [] { return std::vector<Order>{}; });
+        });
+
+    ASSERT_TRUE(snapshot.ok());
+    EXPECT_EQ(snapshot.accounts[0].positions.value->size(), 1u);
+    EXPECT_LT(orders_issued - started, milliseconds(100));
+}
+
+TEST_F(AccountSnapshotTest, BudgetHoldsRequestsUntilNextWindow) {
+    auto created = steady_clock::now();
+    RequestWindowBudget budget(2, milliseconds(60));
+    EXPECT_EQ(budget.acquire(), steady_clock::duration::zero());
+    EXPECT_EQ(budget.acquire(), steady_clock::duration::zero());
+    budget.acquire();
+    // The third request only runs once the first window has closed.
+    EXPECT_GE(steady_clock::now() - created, milliseconds(60));
+
+    // A current server reading caps the first window.
+    auto window_end = steady_clock::now() + milliseconds(30);
+    RequestWindowBudget reported(10, seconds(60), 0, window_end);
+    reported.acquire();
+    EXPECT_GE(steady_clock::now(), window_end);
+    RequestWindowBudget expired(10, seconds(60), 0, steady_clock::now() - seconds(1));
+    EXPECT_EQ(expired.acquire(), steady_clock::duration::zero());
+
+    // A reading claiming a window far longer than ours is held to our window.
+    RequestWindowBudget runaway(10, milliseconds(30), 0, steady_clock::now() + hours(24 * 365));
+    EXPECT_LT(runaway.acquire(), seconds(30));
+}
+
+TEST_F(AccountSnapshotTest, BudgetPacesSnapshot) {
+    std::vector<std::string> ids{"VA1", "VA2"};
+    RequestWindowBudget budget(4, milliseconds(250));
+    auto snapshot = gather_account_snapshots(ids, AccountSnapshotOptions{}, budget,
+                                             endpoint(AccountBalances{}),
+                                             endpoint(std::vector<Position>{}),
+                                             endpoint(std::vector<Order>{}));
+    EXPECT_TRUE(snapshot.ok());
+    // Six requests against four per window: only the fifth waits.
+    EXPECT_EQ(snapshot.budget_waits, 1u);
+    EXPECT_GT(snapshot.budget_wait, microseconds(0));
+}
+
+TEST_F(AccountSnapshotTest, ConnectionPoolReusesNewestLiveConnection) {
+    ConnectionPool<int> pool(2, milliseconds(40));
+    EXPECT_EQ(pool.acquire("api.tradier.com:443"), nullptr);
+
+    pool.release("api.tradier.com:443", std::make_unique<int>(1));
+    pool.release("api.tradier.com:443", std::make_unique<int>(2));
+    pool.release("api.tradier.com:443", std::make_unique<int>(3));
+    EXPECT_EQ(pool.idle_count(), 2u);
+
+    auto newest = pool.acquire("api.tradier.com:443");
+    ASSERT_NE(newest, nullptr);
+    EXPECT_EQ(*newest, 3);
+    EXPECT_EQ(pool.acquire("sandbox.tradier.com:443"), nullptr);
+
+    std::this_thread::sleep_for(milliseconds(60));
+    EXPECT_EQ(pool.acquire("api.tradier.com:443"), nullptr);
+    EXPECT_EQ(pool.idle_count(), 0u);
+
+    pool.release("api.tradier.com:443", std::move(newest));
+    pool.clear();
+    EXPECT_EQ(pool.idle_count(), 0u);
+}
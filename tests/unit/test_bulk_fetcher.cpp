@@ -0,0 +1,160 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include "oqdTradierpp/fundamentals/bulk_fetcher.hpp"
+
+using namespace oqd;
+
+class BulkFetcherTest : public ::testing::Test {
+protected:
+    static std::vector<std::string> universe(std::size_t count) {
+        std::vector<std::string> symbols;
+        for (std::size_t i = 0; i < count; ++i) {
+            symbols.push_back("S" + std::to_string(i));
+        }
+        return symbols;
+    }
+
+    static BulkFetchOptions unpaced() {
+        BulkFetchOptions options;
+        options.requests_per_second = 0;
+        return options;
+    }
+};
+
+TEST_F(BulkFetcherTest, ChunksAreEvenAndDeduplicated) {
+    auto symbols = universe(250);
+    symbols.push_back("S0");
+    symbols.push_back("");
+
+    auto options = unpaced();
+    options.max_symbols_per_request = 100;
+    auto chunks = FundamentalsFetcher::make_chunks(symbols, options);
+
+    ASSERT_EQ(chunks.size(), 3u);
+    std::size_t total = 0;
+    for (const auto& chunk : chunks) {
+        EXPECT_GE(chunk.size(), 82u);
+        EXPECT_LE(chunk.size(), 84u);
+        total += chunk.size();
+    }
+    EXPECT_EQ(total, 250u);
+    EXPECT_TRUE(FundamentalsFetcher::make_chunks({}, options).empty());
+}
+
+TEST_F(BulkFetcherTest, ChunksRespectQueryLength) {
+    auto options = unpaced();
+    options.max_symbols_per_request = 1000;
+    options.max_query_length = 50;
+
+    // "S100".."S199" are 4 bytes plus a 3-byte encoded comma.
+    std::vector<std::string> symbols;
+    for (int i = 100; i < 200; ++i) {
+        symbols.push_back("S" + std::to_string(i));
+    }
+    auto chunks = FundamentalsFetcher::make_chunks(symbols, options);
+    for (const auto& chunk : chunks) {
+        EXPECT_LE(chunk.size() * 4 + (chunk.size() - 1) * 3, 50u);
+    }
+    EXPECT_EQ(chunks.size(), 15u);
+}
+
+TEST_F(BulkFetcherTest, MergesRowsPerSymbolWithBoundedConcurrency) {
+    auto options = unpaced();
+    options.max_symbols_per_request = 50;
+    options.max_in_flight = 3;
+    FundamentalsFetcher fetcher(nullptr, options);
+
+    std::atomic<int> active{0};
+    std::atomic<int> peak{0};
+    auto result = fetcher.scatter_gather<DividendInfo>(universe(1000), [&](const std::vector<std::string>& chunk) {
+        return std::async(std::launch::async, [&, chunk]() {
+            int now = ++active;
+            int seen = peak.load();
+            while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::vector<DividendInfo> rows;
+            for (const auto& symbol : chunk) {
+                for (int i = 0; i < 2; ++i) {
+                    DividendInfo row{};
+                    row.symbol = symbol;
+                    rows.push_back(row);
+                }
+            }
+            --active;
+            return rows;
+        });
+    });
+
+    EXPECT_TRUE(result.ok());
+    EXPECT_EQ(result.requests, 20u);
+    EXPECT_EQ(result.by_symbol.size(), 1000u);
+    EXPECT_EQ(result.by_symbol["S999"].size(), 2u);
+    EXPECT_LE(peak.load(), 3);
+}
+
+TEST_F(BulkFetcherTest, FailedChunksAreReportedNotThrown) {
+    auto options = unpaced();
+    options.max_symbols_per_request = 10;
+    FundamentalsFetcher fetcher(nullptr, options);
+
+    auto result = fetcher.scatter_gather<CompanyInfo>(universe(30), [](const std::vector<std::string>& chunk) {
+        if (chunk.front() == "S10") {
+            throw std::runtime_error("dispatch failed");
+        }
+        return std::async(std::launch::async, [chunk]() -> std::vector<CompanyInfo> {
+            if (chunk.front() == "S20") {
+                throw std::runtime_error("HTTP error: 414");
+            }
+            std::vector<CompanyInfo> rows(chunk.size());
+            for (std::size_t i = 0; i < chunk.size(); ++i) {
+                rows[i].symbol = chunk[i];
+            }
+            return rows;
+        });
+    });
+
+    EXPECT_FALSE(result.ok());
+    EXPECT_EQ(result.by_symbol.size(), 10u);
+    EXPECT_EQ(result.failed_symbols.size(), 20u);
+    ASSERT_EQ(result.errors.size(), 2u);
+    EXPECT_EQ(result.requests, 2u);
+}
+
+TEST_F(BulkFetcherTest, PacesRequestStarts) {
+    BulkFetchOptions options;
+    options.max_symbols_per_request = 1;
+    options.requests_per_second = 200;
+    FundamentalsFetcher fetcher(nullptr, options);
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = fetcher.scatter_gather<PriceStatistics>(universe(11), [](const std::vector<std::string>& chunk) {
+        std::promise<std::vector<PriceStatistics>> promise;
+        std::vector<PriceStatistics> rows(1);
+        rows[0].symbol = chunk.front();
+        promise.set_value(rows);
+        return promise.get_future();
+    });
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(result.by_symbol.size(), 11u);
+    // Eleven starts at 5 ms spacing span at least 50 ms.
+    EXPECT_GE(elapsed, std::chrono::milliseconds(50));
+    EXPECT_THROW(fetcher.company_info({"AAPL"}), std::runtime_error);
+}
@@ -0,0 +1,70 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include "oqdTradierpp/account/history_event.hpp"
+#include "oqdTradierpp/core/enums.hpp"
+#include "oqdTradierpp/core/json_builder.hpp"
+
+using namespace oqd;
+
+namespace {
+
+template<typename Enum, std::size_t N>
+void expect_round_trip(const EnumTable<Enum, N>& table) {
+    for (std::size_t i = 0; i < N; ++i) {
+        auto value = static_cast<Enum>(i);
+        auto name = table.name(value);
+        ASSERT_EQ(table.parse(name), value) << name;
+        // Right length and ends, wrong middle: must not alias.
+        std::string near(name);
+        near[near.size() / 2] = near[near.size() / 2] == 'x' ? 'y' : 'x';
+        EXPECT_FALSE(table.parse(near).has_value()) << near;
+    }
+}
+
+} // namespace
+
+TEST(EnumTableTest, EveryNameRoundTrips) {
+    expect_round_trip(order_class_names);
+    expect_round_trip(order_type_names);
+    expect_round_trip(order_duration_names);
+    expect_round_trip(order_side_names);
+    expect_round_trip(order_status_names);
+}
+
+TEST(EnumTableTest, ResolvedAtCompileTime) {
+    static_assert(to_string(OrderSide::SellToClose) == "sell_to_close");
+    static_assert(to_string(OrderClass::OCO) == "oco");
+    static_assert(order_class_names.parse("oto") == OrderClass::OTO);
+    static_assert(order_status_names.parse("partially_filled") == OrderStatus::PartiallyFilled);
+    static_assert(!order_type_names.parse("").has_value());
+    SUCCEED();
+}
+
+TEST(EnumTableTest, UnknownNamesFallBack) {
+    EXPECT_EQ(to_string(static_cast<OrderType>(42)), "unknown");
+    EXPECT_EQ(order_side_from_string("hold"), OrderSide::Buy);
+    EXPECT_EQ(order_status_from_string("Filled"), OrderStatus::Open);
+    EXPECT_EQ(order_duration_from_string(std::string("gtc")), OrderDuration::GTC);
+    EXPECT_EQ(history_event_type_from_string("interest"), HistoryEventType::Interest);
+    EXPECT_EQ(to_string(HistoryEventType::Other), "other");
+}
+
+TEST(EnumTableTest, JsonBuilderWritesNames) {
+    auto json = json::create_object()
+        .field("side", OrderSide::BuyToOpen)
+        .field("status", OrderStatus::Canceled)
+        .end_object().str();
+    EXPECT_EQ(json, "{\"side\":\"buy_to_open\",\"status\":\"canceled\"}");
+}
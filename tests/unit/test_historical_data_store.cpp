@@ -0,0 +1,176 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include "oqdTradierpp/market/historical_data_store.hpp"
+
+using namespace oqd;
+
+class HistoricalDataStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::random_device rd;
+        root_ = std::filesystem::temp_directory_path() / ("oqd_bars_" + std::to_string(rd()));
+        store_ = std::make_unique<HistoricalDataStore>(nullptr, root_);
+    }
+
+    void TearDown() override {
+        store_.reset();
+        std::filesystem::remove_all(root_);
+    }
+
+    // Consecutive calendar days starting at `first`, closing at base + i.
+    static std::vector<HistoricalData> make_bars(const std::string& first, int count, double base) {
+        std::vector<HistoricalData> bars;
+        auto start = HistoricalDataStore::parse_date(first);
+        for (int i = 0; i < count; ++i) {
+            HistoricalData bar{};
+            bar.date = HistoricalDataStore::format_date(start + i * 86400LL);
+            bar.open = base + i - 0.5;
+            bar.high = base + i + 1.0;
+            bar.low = base + i - 1.0;
+            bar.close = base + i;
+            bar.volume = 1000.0 * (i + 1);
+            bars.push_back(bar);
+        }
+        return bars;
+    }
+
+    std::filesystem::path root_;
+    std::unique_ptr<HistoricalDataStore> store_;
+};
+
+TEST_F(HistoricalDataStoreTest, DateRoundTrip) {
+    EXPECT_EQ(HistoricalDataStore::parse_date("1970-01-02"), 86400);
+    EXPECT_EQ(HistoricalDataStore::format_date(HistoricalDataStore::parse_date("2024-02-29")), "2024-02-29");
+    EXPECT_THROW(HistoricalDataStore::parse_date("2024-02-30"), std::invalid_argument);
+    EXPECT_THROW(HistoricalDataStore::parse_date("yesterday"), std::invalid_argument);
+    EXPECT_THROW(HistoricalDataStore::parse_date("2024-2-09"), std::invalid_argument);
+}
+
+TEST_F(HistoricalDataStoreTest, MergeAndMapColumns) {
+    EXPECT_TRUE(store_->load("AAPL", "daily").empty());
+
+    store_->merge("AAPL", "daily", make_bars("2020-01-01", 10, 100.0), "2020-01-01", "2020-01-10");
+    auto series = store_->load("AAPL", "daily");
+    ASSERT_EQ(series.size(), 10u);
+    EXPECT_EQ(series.time().front(), HistoricalDataStore::parse_date("2020-01-01"));
+    EXPECT_DOUBLE_EQ(series.close()[9], 109.0);
+    EXPECT_DOUBLE_EQ(series.high()[0], 101.0);
+    EXPECT_DOUBLE_EQ(series.volume()[4], 5000.0);
+
+    auto round_trip = series.to_historical_data();
+    ASSERT_EQ(round_trip.size(), 10u);
+    EXPECT_EQ(round_trip[3].date, "2020-01-04");
+    EXPECT_DOUBLE_EQ(round_trip[3].open, 102.5);
+}
+
+TEST_F(HistoricalDataStoreTest, MissingRangesOnlyCoverHeadAndTail) {
+    EXPECT_EQ(store_->missing_ranges("MSFT", "daily", "2020-01-01", "2020-12-31").size(), 1u);
+
+    store_->merge("MSFT", "daily", make_bars("2020-03-01", 31, 50.0), "2020-03-01", "2020-03-31");
+    auto coverage = store_->coverage("MSFT", "daily");
+    ASSERT_TRUE(coverage.has_value());
+    EXPECT_EQ(coverage->bars, 31u);
+
+    EXPECT_TRUE(store_->missing_ranges("MSFT", "daily", "2020-03-05", "2020-03-20").empty());
+
+    auto ranges = store_->missing_ranges("MSFT", "daily", "2020-02-01", "2020-04-15");
+    ASSERT_EQ(ranges.size(), 2u);
+    EXPECT_EQ(ranges[0], std::make_pair(std::string("2020-02-01"), std::string("2020-02-29")));
+    EXPECT_EQ(ranges[1], std::make_pair(std::string("2020-04-01"), std::string("2020-04-15")));
+
+    // Fully cached requests never need the API.
+    auto series = store_->get("MSFT", "daily", "2020-03-10", "2020-03-12");
+    EXPECT_EQ(series.size(), 31u);
+    EXPECT_THROW(store_->get("MSFT", "daily", "2020-01-01", "2020-03-12"), std::runtime_error);
+}
+
+TEST_F(HistoricalDataStoreTest, DisjointRequestsFetchTheGap) {
+    store_->merge("IBM", "daily", make_bars("2020-01-01", 31, 120.0), "2020-01-01", "2020-01-31");
+
+    auto later = store_->missing_ranges("IBM", "daily", "2020-06-01", "2020-06-30");
+    ASSERT_EQ(later.size(), 1u);
+    EXPECT_EQ(later[0], std::make_pair(std::string("2020-02-01"), std::string("2020-06-30")));
+    auto earlier = store_->missing_ranges("IBM", "daily", "2019-06-01", "2019-06-30");
+    ASSERT_EQ(earlier.size(), 1u);
+    EXPECT_EQ(earlier[0], std::make_pair(std::string("2019-06-01"), std::string("2019-12-31")));
+
+    // Merging a range that does not touch the coverage keeps its bars but
+    // leaves the gap uncached.
+    store_->merge("IBM", "daily", make_bars("2023-01-01", 31, 140.0), "2023-01-01", "2023-01-31");
+    auto coverage = store_->coverage("IBM", "daily");
+    ASSERT_TRUE(coverage.has_value());
+    EXPECT_EQ(coverage->first, HistoricalDataStore::parse_date("2020-01-01"));
+    EXPECT_EQ(coverage->last, HistoricalDataStore::parse_date("2020-01-31"));
+    EXPECT_EQ(coverage->bars, 62u);
+    auto gap = store_->missing_ranges("IBM", "daily", "2021-03-01", "2021-03-31");
+    ASSERT_EQ(gap.size(), 1u);
+    EXPECT_EQ(gap[0].first, "2020-02-01");
+
+    // An adjoining range extends the coverage.
+    store_->merge("IBM", "daily", make_bars("2020-02-01", 29, 150.0), "2020-02-01", "2020-02-29");
+    EXPECT_EQ(store_->coverage("IBM", "daily")->last, HistoricalDataStore::parse_date("2020-02-29"));
+}
+
+TEST_F(HistoricalDataStoreTest, AppendsGrowPastCapacityAndBackfillMerges) {
+    // 300 days appended in chunks crosses the initial 256-row capacity.
+    for (int chunk = 0; chunk < 6; ++chunk) {
+        auto first = HistoricalDataStore::format_date(HistoricalDataStore::parse_date("2021-01-01") +
+                                                      chunk * 50 * 86400LL);
+        auto bars = make_bars(first, 50, 200.0 + chunk * 50);
+        store_->merge("SPY", "daily", bars, bars.front().date, bars.back().date);
+    }
+    auto series = store_->load("SPY", "daily");
+    ASSERT_EQ(series.size(), 300u);
+    for (std::size_t i = 0; i < series.size(); ++i) {
+        ASSERT_DOUBLE_EQ(series.close()[i], 200.0 + static_cast<double>(i));
+    }
+
+    // Back-fill ahead of the cached range and overwrite one existing day.
+    auto older = make_bars("2020-12-20", 13, 10.0);
+    older.back().close = -1.0;  // 2021-01-01 replaces the stored bar
+    store_->merge("SPY", "daily", older, "2020-12-20", "2021-01-01");
+
+    auto merged = store_->load("SPY", "daily");
+    ASSERT_EQ(merged.size(), 312u);
+    EXPECT_EQ(HistoricalDataStore::format_date(merged.time().front()), "2020-12-20");
+    EXPECT_DOUBLE_EQ(merged.close()[12], -1.0);
+    EXPECT_DOUBLE_EQ(merged.close()[13], 201.0);
+    for (std::size_t i = 1; i < merged.size(); ++i) {
+        ASSERT_LT(merged.time()[i - 1], merged.time()[i]);
+    }
+
+    // The earlier mapping is a stable snapshot.
+    EXPECT_EQ(series.size(), 300u);
+    EXPECT_DOUBLE_EQ(series.close()[0], 200.0);
+}
+
+TEST_F(HistoricalDataStoreTest, TodayIsNeverCovered) {
+    auto today = HistoricalDataStore::format_date(
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    store_->merge("QQQ", "daily", {}, today, today);
+    EXPECT_FALSE(store_->coverage("QQQ", "daily").has_value());
+    EXPECT_EQ(store_->missing_ranges("QQQ", "daily", today, today).size(), 1u);
+}
+
+TEST_F(HistoricalDataStoreTest, RejectsForeignFiles) {
+    auto path = store_->path_for("BRK/B", "daily");
+    EXPECT_EQ(path.filename(), "BRK_B.bars");
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream(path) << std::string(128, 'x');
+    EXPECT_THROW(store_->load("BRK/B", "daily"), std::runtime_error);
+}
@@ -0,0 +1,154 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <boost/beast/http.hpp>
+#include <zlib.h>
+#include "oqdTradierpp/core/inflater.hpp"
+#include "oqdTradierpp/core/padded_body.hpp"
+
+using namespace oqd;
+
+class InflaterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 2000; ++i) {
+            json_ += i == 0 ? R"({"history":{"day":[)" : ",";
+            json_ += R"({"date":"2025-06-02","open":101.25,"high":102.5,"low":100.75,"close":101.9,"volume":)" +
+                     std::to_string(1000000 + i) + "}";
+        }
+        json_ += "]}}";
+    }
+
+    // window_bits: 15 zlib, 15 + 16 gzip, -15 raw deflate.
+    static std::string compress(const std::string& input, int window_bits) {
+        z_stream z{};
+        deflateInit2(&z, Z_BEST_SPEED, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+        std::string out(deflateBound(&z, input.size()), '\0');
+        z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        z.avail_in = static_cast<uInt>(input.size());
+        z.next_out = reinterpret_cast<Bytef*>(out.data());
+        z.avail_out = static_cast<uInt>(out.size());
+        deflate(&z, Z_FINISH);
+        out.resize(z.total_out);
+        deflateEnd(&z);
+        return out;
+    }
+
+    // Feeds a full HTTP response to a padded_body parser `step` bytes at a time.
+    static boost::beast::error_code read(const std::string& encoding, const std::string& body,
+                                         std::size_t step, PaddedBuffer& out) {
+        namespace http = boost::beast::http;
+        std::string raw = "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Encoding: " + encoding +
+                          "\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+        std::size_t header_size = raw.size();
+        raw += body;
+
+        http::response_parser<padded_body> parser;
+        parser.get().body() = std::move(out);
+        boost::beast::error_code ec;
+        std::size_t offset = parser.put(boost::asio::buffer(raw.data(), header_size), ec);
+        while (!ec && offset < raw.size()) {
+            offset += parser.put(boost::asio::buffer(raw.data() + offset, std::min(step, raw.size() - offset)), ec);
+        }
+        if (!ec) {
+            parser.put_eof(ec);
+        }
+        out = std::move(parser.get().body());
+        return ec;
+    }
+
+    std::string json_;
+};
+
+TEST_F(InflaterTest, ParsesContentEncodingHeader) {
+    EXPECT_EQ(content_encoding_from_string(""), ContentEncoding::Identity);
+    EXPECT_EQ(content_encoding_from_string("identity"), ContentEncoding::Identity);
+    EXPECT_EQ(content_encoding_from_string(" GZIP "), ContentEncoding::Gzip);
+    EXPECT_EQ(content_encoding_from_string("x-gzip"), ContentEncoding::Gzip);
+    EXPECT_EQ(content_encoding_from_string("Deflate"), ContentEncoding::Deflate);
+    EXPECT_FALSE(content_encoding_from_string("br").has_value());
+}
+
+TEST_F(InflaterTest, DecodesEveryWrapperAtAnyChunking) {
+    struct Case { const char* encoding; int window_bits; };
+    for (auto [encoding, window_bits] : {Case{"gzip", 15 + 16}, Case{"deflate", 15}, Case{"deflate", -15}}) {
+        std::string compressed = compress(json_, window_bits);
+        ASSERT_LT(compressed.size() * 5, json_.size());
+        for (std::size_t step : {1u, 1000u, 1u << 20}) {
+            PaddedBuffer body;
+            auto ec = read(encoding, compressed, step, body);
+            ASSERT_FALSE(ec) << encoding << " " << window_bits << " step " << step << ": " << ec.message();
+            EXPECT_EQ(body.view(), json_);
+            EXPECT_EQ(body.encoded_bytes, compressed.size());
+        }
+    }
+}
+
+TEST_F(InflaterTest, DecodedBodyParsesInPlace) {
+    PaddedBuffer body;
+    ASSERT_FALSE(read("gzip", compress(json_, 15 + 16), 4096, body));
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(reinterpret_cast<const std::uint8_t*>(body.data()), body.size(), false);
+    ASSERT_EQ(doc.error(), simdjson::SUCCESS);
+    simdjson::dom::array days = doc.value()["history"]["day"].get_array();
+    EXPECT_EQ(days.size(), 2000u);
+}
+
+TEST_F(InflaterTest, StreamedElementsSeeDecodedBytes) {
+    PaddedBuffer body;
+    std::size_t calls = 0;
+    body.on_append = [&](const PaddedBuffer& received) {
+        ++calls;
+        ASSERT_EQ(received.view(), std::string_view(json_).substr(0, received.size()));
+    };
+    ASSERT_FALSE(read("gzip", compress(json_, 15 + 16), 512, body));
+    EXPECT_GT(calls, 1u);
+}
+
+TEST_F(InflaterTest, RejectsCorruptTruncatedAndUnknownBodies) {
+    std::string compressed = compress(json_, 15 + 16);
+
+    std::string corrupt = compressed;
+    corrupt[corrupt.size() / 2] ^= 0x5A;
+    corrupt[corrupt.size() / 2 + 1] ^= 0xA5;
+    PaddedBuffer body;
+    EXPECT_TRUE(read("gzip", corrupt, 4096, body));
+
+    // A Content-Length matching the truncated size lets the message end early.
+    PaddedBuffer truncated;
+    EXPECT_TRUE(read("gzip", compressed.substr(0, compressed.size() / 2), 4096, truncated));
+
+    PaddedBuffer unknown;
+    EXPECT_TRUE(read("br", compressed, 4096, unknown));
+}
+
+TEST_F(InflaterTest, LeasedInflatersAreReused) {
+    Inflater* first = nullptr;
+    {
+        auto lease = Inflater::acquire();
+        first = lease.get();
+    }
+    auto again = Inflater::acquire();
+    EXPECT_EQ(again.get(), first);
+
+    std::string compressed = compress(json_, 15);
+    for (int round = 0; round < 2; ++round) {
+        again->begin(ContentEncoding::Deflate);
+        PaddedBuffer out;
+        ASSERT_TRUE(again->write(compressed.data(), compressed.size(), out));
+        EXPECT_TRUE(again->finished());
+        EXPECT_EQ(out.view(), json_);
+    }
+}
@@ -12,6 +12,10 @@
 */
 
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
 #include "oqdTradierpp/core/json_builder.hpp"
 #include "oqdTradierpp/core/enums.hpp"
 
@@ -201,4 +205,117 @@ TEST_F(JsonBuilderTest, ComplexNestedStructure) {
         .end_object().str();
     
     EXPECT_EQ(result, "{\"name\":\"complex\",\"count\":100,\"active\":true,\"numbers\":[1,2,3],\"letters\":[\"a\",\"b\",\"c\"],\"price\":100.00}");
-}
\ No newline at end of file
+}
+namespace {
+
+struct WritableLeg {
+    std::string symbol;
+    double ratio = 0.0;
+
+    void write_json(JsonBuilder& builder) const {
+        builder.start_object()
+            .set_fixed().set_precision(4)
+            .field("symbol", symbol)
+            .field("ratio", ratio)
+            .end_object();
+    }
+    std::string to_json() const { return "unused"; }
+};
+
+struct EmptyWritable {
+    void write_json(JsonBuilder& builder) const { builder.start_object().end_object(); }
+};
+
+} // namespace
+
+TEST_F(JsonBuilderTest, WritableChildrenAppendInPlace) {
+    std::vector<WritableLeg> legs = {{"SPY", 0.5}, {"QQQ", 1.0}};
+    auto result = create_object()
+        .set_fixed().set_precision(2)
+        .field("price", 1.5)
+        .array_field("legs", legs)
+        .field("limit", 2.25)
+        .end_object().str();
+
+    // write_json wins over to_json, and the child's precision does not leak.
+    EXPECT_EQ(result, "{\"price\":1.50,\"legs\":[{\"symbol\":\"SPY\",\"ratio\":0.5000},"
+                      "{\"symbol\":\"QQQ\",\"ratio\":1.0000}],\"limit\":2.25}");
+    EXPECT_EQ(write_to_string(legs[0]), "{\"symbol\":\"SPY\",\"ratio\":0.5000}");
+}
+
+TEST_F(JsonBuilderTest, EmptyContainersKeepSiblingCommas) {
+    std::vector<int> none;
+    auto result = create_object()
+        .field("a", EmptyWritable{})
+        .array_field("b", none)
+        .field("c", 1)
+        .end_object().str();
+    EXPECT_EQ(result, "{\"a\":{},\"b\":[],\"c\":1}");
+}
+
+TEST_F(JsonBuilderTest, WriterReusesCallerString) {
+    std::vector<WritableLeg> legs = {{"SPY", 0.5}, {"QQQ", 1.0}};
+    std::string target;
+    target.reserve(256);
+    const char* data = target.data();
+
+    for (int i = 0; i < 100; ++i) {
+        target.clear();
+        JsonWriter writer(target);
+        auto view = to_json_into(writer, legs[i % 2]);
+        EXPECT_EQ(view, write_to_string(legs[i % 2]));
+    }
+    // The loop never outgrew the reserved buffer.
+    EXPECT_EQ(target.data(), data);
+
+    // Writers append; clear() empties the target but keeps its storage.
+    JsonWriter writer(target);
+    writer.start_array().element(1).end_array();
+    EXPECT_EQ(target, "{\"symbol\":\"QQQ\",\"ratio\":1.0000}[1]");
+    writer.clear();
+    EXPECT_TRUE(target.empty());
+    EXPECT_EQ(target.data(), data);
+}
+
+TEST_F(JsonBuilderTest, WriterDrawsFromPmrArena) {
+    alignas(std::max_align_t) std::array<std::byte, 4096> storage;
+    // Anything past the arena would throw from the null upstream resource.
+    std::pmr::monotonic_buffer_resource arena(storage.data(), storage.size(), std::pmr::null_memory_resource());
+    std::pmr::string target(&arena);
+
+    JsonWriter writer(target);
+    writer.start_object()
+        .field("a_key_longer_than_small_string_storage", "value")
+        .array_field("numbers", std::vector<int>{1, 2, 3})
+        .end_object();
+    EXPECT_EQ(writer.view(), "{\"a_key_longer_than_small_string_storage\":\"value\",\"numbers\":[1,2,3]}");
+    EXPECT_EQ(writer.str(), std::string(target));
+}
+
+TEST_F(JsonBuilderTest, WriterSignalsFixedSpanOverflow) {
+    std::array<char, 32> storage;
+    JsonWriter writer{std::span<char>(storage)};
+    writer.start_object().field("symbol", "SPY").end_object();
+    EXPECT_FALSE(writer.overflowed());
+    EXPECT_EQ(writer.view(), "{\"symbol\":\"SPY\"}");
+
+    writer.clear();
+    writer.start_object().field("description", "SPDR S&P 500 ETF Trust").end_object();
+    EXPECT_TRUE(writer.overflowed());
+    EXPECT_LE(writer.view().size(), storage.size());
+    // Writes stop at the first one that does not fit.
+    EXPECT_EQ(writer.view(), "{\"description\":\"");
+
+    writer.clear();
+    EXPECT_FALSE(writer.overflowed());
+    EXPECT_EQ(std::move(writer).str(), "");
+}
+
+TEST_F(JsonBuilderTest, ThreadScratchIsClearedPerCall) {
+    std::string& first = thread_scratch();
+    first = "leftover";
+    JsonWriter writer(thread_scratch());
+    writer.start_array().element(true).end_array();
+    EXPECT_EQ(writer.view(), "[true]");
+    EXPECT_EQ(&thread_scratch(), &first);
+}
@@ -0,0 +1,174 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include "oqdTradierpp/metrics.hpp"
+#include <thread>
+#include <vector>
+
+using namespace oqd;
+
+class MetricsTest : public ::testing::Test {
+protected:
+    MetricsRegistry registry_;
+};
+
+TEST_F(MetricsTest, ClassifyEndpoint) {
+    EXPECT_EQ(classify_endpoint("GET", "/v1/markets/quotes?symbols=AAPL"), EndpointGroup::Markets);
+    EXPECT_EQ(classify_endpoint("GET", "/v1/markets/options/chains"), EndpointGroup::Options);
+    EXPECT_EQ(classify_endpoint("POST", "/v1/markets/events/session"), EndpointGroup::Streaming);
+    EXPECT_EQ(classify_endpoint("GET", "/v1/accounts/VA000001/balances"), EndpointGroup::Accounts);
+    EXPECT_EQ(classify_endpoint("GET", "/v1/accounts/VA000001/orders"), EndpointGroup::Accounts);
+    EXPECT_EQ(classify_endpoint("POST", "/v1/accounts/VA000001/orders"), EndpointGroup::Trading);
+    EXPECT_EQ(classify_endpoint("DELETE", "/v1/accounts/VA000001/orders/12345678"), EndpointGroup::Trading);
+    EXPECT_EQ(classify_endpoint("GET", "/beta/markets/fundamentals/company"), EndpointGroup::Fundamentals);
+    EXPECT_EQ(classify_endpoint("GET", "/v1/watchlists"), EndpointGroup::Watchlists);
+    EXPECT_EQ(classify_endpoint("POST", "/oauth/accesstoken"), EndpointGroup::Auth);
+    EXPECT_EQ(classify_endpoint("GET", "https://api.tradier.com/v1/user/profile"), EndpointGroup::User);
+    EXPECT_EQ(classify_endpoint("GET", "/unknown"), EndpointGroup::Other);
+}
+
+TEST_F(MetricsTest, RequestScopeRecordsCountsAndStatus) {
+    {
+        RequestMetricsScope scope(&registry_, EndpointGroup::Markets);
+        scope.mark(RequestPhase::Dns);
+        scope.mark(RequestPhase::Connect);
+        scope.add_bytes(2048, 256);
+        scope.set_status(200);
+
+        auto during = registry_.snapshot();
+        EXPECT_EQ(during.group(EndpointGroup::Markets).in_flight, 1);
+    }
+    {
+        RequestMetricsScope scope(&registry_, EndpointGroup::Markets);
+        scope.set_status(429);
+    }
+    {
+        RequestMetricsScope scope(&registry_, EndpointGroup::Markets);
+        // No status set: transport failure
+    }
+
+    auto snap = registry_.snapshot();
+    const auto& markets = snap.group(EndpointGroup::Markets);
+    EXPECT_EQ(markets.requests, 3u);
+    EXPECT_EQ(markets.in_flight, 0);
+    EXPECT_EQ(markets.bytes_in, 2048u);
+    EXPECT_EQ(markets.bytes_out, 256u);
+    EXPECT_EQ(markets.error_count(), 2u);
+    EXPECT_EQ(markets.errors_by_status.at(429), 1u);
+    EXPECT_EQ(markets.errors_by_status.at(0), 1u);
+    EXPECT_EQ(markets.phase(RequestPhase::Dns).count, 1u);
+    EXPECT_EQ(markets.phase(RequestPhase::Total).count, 3u);
+    EXPECT_TRUE(snap.group(EndpointGroup::Accounts).empty());
+    EXPECT_EQ(snap.total_requests(), 3u);
+}
+
+TEST_F(MetricsTest, PhaseHistogramBuckets) {
+    registry_.record_phase(EndpointGroup::Options, RequestPhase::Parse, std::chrono::microseconds(50));
+    registry_.record_phase(EndpointGroup::Options, RequestPhase::Parse, std::chrono::milliseconds(3));
+    registry_.record_phase(EndpointGroup::Options, RequestPhase::Parse, std::chrono::seconds(20));
+
+    auto stats = registry_.snapshot().group(EndpointGroup::Options).phase(RequestPhase::Parse);
+    EXPECT_EQ(stats.count, 3u);
+    EXPECT_EQ(stats.buckets[0], 1u);                          // <= 100us
+    EXPECT_EQ(stats.buckets[5], 1u);                          // <= 5ms
+    EXPECT_EQ(stats.buckets[metrics::bucket_count - 1], 1u);  // +Inf
+}
+
+TEST_F(MetricsTest, MergesCountersAcrossThreads) {
+    constexpr int threads = 8;
+    constexpr int per_thread = 1000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([this]() {
+            for (int i = 0; i < per_thread; ++i) {
+                registry_.record_request_start(EndpointGroup::Trading);
+                registry_.record_bytes(EndpointGroup::Trading, 10, 1);
+                registry_.record_request_end(EndpointGroup::Trading, 200);
+            }
+            registry_.record_rate_limit_wait(EndpointGroup::Trading, std::chrono::milliseconds(1));
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    auto trading = registry_.snapshot().group(EndpointGroup::Trading);
+    EXPECT_EQ(trading.requests, static_cast<std::uint64_t>(threads * per_thread));
+    EXPECT_EQ(trading.bytes_in, static_cast<std::uint64_t>(threads * per_thread * 10));
+    EXPECT_EQ(trading.in_flight, 0);
+    EXPECT_EQ(trading.error_count(), 0u);
+    EXPECT_EQ(trading.rate_limit_waits, static_cast<std::uint64_t>(threads));
+    EXPECT_EQ(trading.rate_limit_wait_time, std::chrono::milliseconds(threads));
+}
+
+TEST_F(MetricsTest, PrometheusFormat) {
+    {
+        RequestMetricsScope scope(&registry_, EndpointGroup::Accounts);
+        scope.add_bytes(100, 10);
+        scope.set_status(503);
+    }
+
+    auto text = to_prometheus(registry_.snapshot());
+    EXPECT_NE(text.find("# TYPE oqd_tradier_requests_total counter"), std::string::npos);
+    EXPECT_NE(text.find("oqd_tradier_requests_total{group=\"accounts\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("oqd_tradier_errors_total{group=\"accounts\",status=\"503\"} 1"), std::string::npos);
+    EXPECT_NE(text.find("oqd_tradier_received_bytes_total{group=\"accounts\"} 100"), std::string::npos);
+    EXPECT_NE(text.find("oqd_tradier_request_phase_seconds_bucket{group=\"accounts\",phase=\"total\",le=\"+Inf\"} 1"),
+              std::string::npos);
+    EXPECT_EQ(text.find("group=\"markets\""), std::string::npos);
+
+    auto custom = to_prometheus(registry_.snapshot(), "trader");
+    EXPECT_NE(custom.find("trader_requests_total{group=\"accounts\"} 1"), std::string::npos);
+}
+TEST_F(MetricsTest, CoalescedRequests) {
+    registry_.record_coalesced(EndpointGroup::Accounts);
+    registry_.record_coalesced(EndpointGroup::Accounts);
+
+    auto snapshot = registry_.snapshot();
+    EXPECT_EQ(snapshot.group(EndpointGroup::Accounts).coalesced_requests, 2u);
+    EXPECT_FALSE(snapshot.group(EndpointGroup::Accounts).empty());
+
+    auto text = to_prometheus(snapshot);
+    EXPECT_NE(text.find("oqd_tradier_coalesced_requests_total{group=\"accounts\"} 2"), std::string::npos);
+}
+
+TEST_F(MetricsTest, DecompressionCounters) {
+    registry_.record_request_start(EndpointGroup::Markets);
+    registry_.record_bytes(EndpointGroup::Markets, 1200, 300);
+    registry_.record_decompression(EndpointGroup::Markets, 9000, std::chrono::microseconds(250));
+    registry_.record_request_end(EndpointGroup::Markets, 200);
+
+    auto snapshot = registry_.snapshot();
+    const auto& markets = snapshot.group(EndpointGroup::Markets);
+    EXPECT_EQ(markets.bytes_in, 1200u);
+    EXPECT_EQ(markets.decoded_bytes, 9000u);
+    EXPECT_EQ(markets.phase(RequestPhase::Decompress).count, 1u);
+
+    auto text = to_prometheus(snapshot);
+    EXPECT_NE(text.find("oqd_tradier_decoded_bytes_total{group=\"markets\"} 9000"), std::string::npos);
+    EXPECT_NE(text.find("phase=\"decompress\""), std::string::npos);
+}
+
+TEST_F(MetricsTest, ReusedConnections) {
+    registry_.record_request_start(EndpointGroup::Accounts);
+    registry_.record_connection_reused(EndpointGroup::Accounts);
+    registry_.record_request_end(EndpointGroup::Accounts, 200);
+
+    auto snapshot = registry_.snapshot();
+    EXPECT_EQ(snapshot.group(EndpointGroup::Accounts).reused_connections, 1u);
+
+    auto text = to_prometheus(snapshot);
+    EXPECT_NE(text.find("oqd_tradier_reused_connections_total{group=\"accounts\"} 1"), std::string::npos);
+}
@@ -0,0 +1,117 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <string>
+#include "oqdTradierpp/core/number_format.hpp"
+#include "oqdTradierpp/streaming.hpp"
+
+using namespace oqd;
+
+class NumberFormatTest : public ::testing::Test {
+protected:
+    static std::string fixed(double value, int precision) {
+        std::array<char, 400> buffer;
+        auto [ptr, ec] = json::format_fixed(buffer.data(), buffer.data() + buffer.size(), value, precision);
+        EXPECT_EQ(ec, std::errc());
+        return std::string(buffer.data(), ptr);
+    }
+
+    static std::string printf_fixed(double value, int precision) {
+        std::array<char, 400> buffer;
+        int len = std::snprintf(buffer.data(), buffer.size(), "%.*f", precision, value);
+        return std::string(buffer.data(), len);
+    }
+};
+
+TEST_F(NumberFormatTest, MatchesPrintfOnPrices) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> prices(-5000.0, 5000.0);
+    std::uniform_int_distribution<int> cents(-500000, 500000);
+    for (int i = 0; i < 200000; ++i) {
+        double value = i % 2 ? prices(rng) : cents(rng) / 100.0;
+        for (int precision = 0; precision <= 6; ++precision) {
+            ASSERT_EQ(fixed(value, precision), printf_fixed(value, precision)) << value << " @" << precision;
+        }
+    }
+}
+
+TEST_F(NumberFormatTest, TiesAndEdgeCasesMatchPrintf) {
+    const double values[] = {0.0, -0.0, 0.125, 0.375, 2.5, 1.005, 2.675, -0.001, 0.004999,
+                             999999.995, 1e11, 123456789.125, 1e15, -1e300, 5e-324,
+                             std::numeric_limits<double>::max()};
+    for (double value : values) {
+        for (int precision = 0; precision <= 4; ++precision) {
+            EXPECT_EQ(fixed(value, precision), printf_fixed(value, precision)) << value << " @" << precision;
+        }
+    }
+    EXPECT_EQ(fixed(150.0, 2), "150.00");
+    EXPECT_EQ(fixed(-0.001, 2), "-0.00");
+    EXPECT_EQ(fixed(0.05, 4), "0.0500");
+}
+
+TEST_F(NumberFormatTest, ReportsShortBuffers) {
+    std::array<char, 6> buffer;
+    auto fits = json::format_fixed(buffer.data(), buffer.data() + buffer.size(), 12.5, 2);
+    EXPECT_EQ(fits.ec, std::errc());
+    EXPECT_EQ(std::string(buffer.data(), fits.ptr), "12.50");
+    auto too_long = json::format_fixed(buffer.data(), buffer.data() + buffer.size(), 1234.5, 2);
+    EXPECT_EQ(too_long.ec, std::errc::value_too_large);
+}
+
+TEST_F(NumberFormatTest, ShortestRoundTrips) {
+    std::array<char, 32> buffer;
+    for (double value : {0.1, 1.0 / 3.0, 187.42, 1e-7, 6.02214076e23}) {
+        auto [ptr, ec] = json::format_shortest(buffer.data(), buffer.data() + buffer.size(), value);
+        ASSERT_EQ(ec, std::errc());
+        EXPECT_EQ(std::stod(std::string(buffer.data(), ptr)), value);
+    }
+    auto [ptr, ec] = json::format_shortest(buffer.data(), buffer.data() + buffer.size(), 187.42);
+    EXPECT_EQ(std::string(buffer.data(), ptr), "187.42");
+}
+
+TEST_F(NumberFormatTest, StreamingStructsKeepTheirFormat) {
+    StreamingQuote quote{};
+    quote.symbol = "SPY";
+    quote.bid = 450.125;
+    quote.ask = 450.2;
+    quote.last = 450.15;
+    quote.bid_size = 3;
+    quote.ask_size = 5;
+    quote.last_size = 100;
+    quote.bid_exch = "Q";
+    quote.ask_exch = "P";
+    quote.timestamp = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000));
+    EXPECT_EQ(quote.to_json(), "{\"symbol\":\"SPY\",\"bid\":450.12,\"ask\":450.20,\"last\":450.15,"
+                               "\"bid_size\":3,\"ask_size\":5,\"last_size\":100,\"bid_exch\":\"Q\","
+                               "\"ask_exch\":\"P\",\"timestamp\":1700000000}");
+
+    StreamingOrderStatus status{};
+    status.order_id = "123";
+    status.status = "filled";
+    status.symbol = "SPY";
+    status.quantity = 10;
+    status.filled_quantity = 10;
+    status.avg_fill_price = 450.1;
+    status.tag = "my-tag";
+    status.timestamp = quote.timestamp;
+    EXPECT_EQ(status.to_json(), "{\"order_id\":\"123\",\"status\":\"filled\",\"symbol\":\"SPY\","
+                                "\"order_type\":\"market\",\"side\":\"buy\",\"quantity\":10.00,"
+                                "\"filled_quantity\":10.00,\"avg_fill_price\":450.10,"
+                                "\"remaining_quantity\":0.00,\"tag\":\"my-tag\",\"timestamp\":1700000000}");
+}
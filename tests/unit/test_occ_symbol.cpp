@@ -0,0 +1,127 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+#include "oqdTradierpp/account/portfolio_engine.hpp"
+#include "oqdTradierpp/core/occ_symbol.hpp"
+#include "oqdTradierpp/validation.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OccSymbolTest : public ::testing::Test {
+protected:
+    static OccSymbol parsed(std::string_view text) {
+        auto symbol = OccSymbol::parse(text);
+        EXPECT_TRUE(symbol.has_value()) << text;
+        return symbol.value_or(OccSymbol{});
+    }
+};
+
+static_assert(sizeof(OccSymbol) == 12);
+static_assert(OccSymbol::parse("SPY240119C00450000")->strike_thousandths() == 450000);
+
+TEST_F(OccSymbolTest, ParsesFields) {
+    auto spy = parsed("SPY240119C00450000");
+    EXPECT_EQ(spy.root(), "SPY");
+    EXPECT_EQ(spy.root_length(), 3u);
+    EXPECT_TRUE(spy.has_root("SPY"));
+    EXPECT_FALSE(spy.has_root("SPYW"));
+    EXPECT_EQ(spy.expiry(), 2024y / January / 19);
+    EXPECT_TRUE(spy.is_call());
+    EXPECT_EQ(spy.strike(), Price::from_cents(45000));
+
+    auto adjusted = parsed("AAPL7250620P00187500");
+    EXPECT_EQ(adjusted.root(), "AAPL7");
+    EXPECT_EQ(adjusted.right(), OccSymbol::Right::Put);
+    EXPECT_EQ(adjusted.strike().to_string(), "187.50");
+
+    auto single = parsed("F991231P00000500");
+    EXPECT_EQ(single.root(), "F");
+    EXPECT_EQ(single.expiry(), 2099y / December / 31);
+    EXPECT_EQ(single.strike().to_string(), "0.50");
+}
+
+TEST_F(OccSymbolTest, FormatsCompactFormAndRoundTrips) {
+    for (const char* text : {"SPY240119C00450000", "BRKB250117P00410500", "SPXW241231C05000000", "GOOGL1240621C00001000"}) {
+        EXPECT_EQ(parsed(text).to_string(), text);
+    }
+    // Space-padded OCC form formats back compact.
+    EXPECT_EQ(parsed("SPY   240119C00450000").to_string(), "SPY240119C00450000");
+    EXPECT_EQ(parsed("SPY   240119C00450000"), parsed("SPY240119C00450000"));
+
+    std::array<char, 10> small{};
+    auto result = parsed("SPY240119C00450000").to_chars(small.data(), small.data() + small.size());
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
+TEST_F(OccSymbolTest, RejectsMalformedSymbols) {
+    for (const char* text : {"", "SPY", "SPY240230C00450000", "SPY241301C00450000", "SPY240119X00450000",
+                             "SPY240119C0045000A", "spy240119C00450000", "1SPY240119C00450000",
+                             "ABCDEFG240119C00450000", "SPY240119C00000000", "SP.Y240119C00450000",
+                             "240119C00450000", "SPY 240119C00450000X"}) {
+        EXPECT_FALSE(OccSymbol::parse(text).has_value()) << text;
+    }
+    EXPECT_FALSE(OccSymbol{}.valid());
+    EXPECT_TRUE(parsed("SPY240229C00450000").valid());   // leap day
+}
+
+TEST_F(OccSymbolTest, MakesFromParts) {
+    auto made = OccSymbol::make("SPY", 2024y / January / 19, OccSymbol::Right::Call, Price::from_cents(45000));
+    ASSERT_TRUE(made.has_value());
+    EXPECT_EQ(*made, parsed("SPY240119C00450000"));
+    EXPECT_EQ(made->to_string(), "SPY240119C00450000");
+
+    EXPECT_FALSE(OccSymbol::make("SPY", 2024y / January / 19, OccSymbol::Right::Call, *Price::parse("450.0005")));
+    EXPECT_FALSE(OccSymbol::make("SPY", 2024y / February / 30, OccSymbol::Right::Put, Price::from_cents(100)));
+    EXPECT_FALSE(OccSymbol::make("SPY", 2100y / January / 1, OccSymbol::Right::Put, Price::from_cents(100)));
+    EXPECT_FALSE(OccSymbol::make("SPY", 2024y / January / 19, OccSymbol::Right::Put, Price{}));
+    EXPECT_FALSE(OccSymbol::make("TOOLONG", 2024y / January / 19, OccSymbol::Right::Put, Price::from_cents(100)));
+}
+
+TEST_F(OccSymbolTest, OrdersLikePaddedSymbolsAndHashes) {
+    std::vector<std::string> texts = {"SPY240119P00440000", "SPY240119C00450000", "SPY1240119C00450000",
+                                      "QQQ240119C00400000", "SPY240216C00400000", "SPY240119C00440000",
+                                      "SPXW240119C04800000"};
+    std::vector<OccSymbol> symbols;
+    for (const auto& text : texts) {
+        symbols.push_back(parsed(text));
+    }
+    std::sort(symbols.begin(), symbols.end());
+    std::vector<std::string> sorted;
+    for (const auto& symbol : symbols) {
+        sorted.push_back(symbol.to_string());
+    }
+    EXPECT_EQ(sorted, (std::vector<std::string>{"QQQ240119C00400000", "SPXW240119C04800000", "SPY240119C00440000",
+                                                "SPY240119C00450000", "SPY240119P00440000", "SPY240216C00400000",
+                                                "SPY1240119C00450000"}));
+
+    std::unordered_set<OccSymbol> set(symbols.begin(), symbols.end());
+    EXPECT_EQ(set.size(), symbols.size());
+    EXPECT_TRUE(set.contains(parsed("SPY240119P00440000")));
+    EXPECT_FALSE(set.contains(parsed("SPY240119P00440001")));
+}
+
+TEST_F(OccSymbolTest, ValidatorsUseCodec) {
+    EXPECT_TRUE(OrderValidator::is_valid_option_symbol("SPY240119C00450000"));
+    EXPECT_FALSE(OrderValidator::is_valid_option_symbol("SPY240230C00450000"));
+    EXPECT_TRUE(OrderValidator::is_option_symbol_consistent("SPY", "SPY240119C00450000"));
+    EXPECT_FALSE(OrderValidator::is_option_symbol_consistent("QQQ", "SPY240119C00450000"));
+    EXPECT_FALSE(OrderValidator::is_option_symbol_consistent("SPY", "SPYG240119C00045000"));
+    EXPECT_FALSE(OrderValidator::is_option_symbol_consistent("SPY", "SPY"));
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("SPY240119C00450000"), 100.0);
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("SPY"), 1.0);
+}
@@ -0,0 +1,178 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include "oqdTradierpp/market/option_chain_store.hpp"
+
+using namespace oqd;
+
+class OptionChainStoreTest : public ::testing::Test {
+protected:
+    static std::string occ(double strike, bool call) {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "SPY250620%c%08d", call ? 'C' : 'P',
+                      static_cast<int>(strike * 1000));
+        return buffer;
+    }
+
+    static Quote make_option(double strike, bool call, double bid, double ask) {
+        Quote quote{};
+        quote.symbol = occ(strike, call);
+        quote.strike = strike;
+        quote.option_type = call ? "call" : "put";
+        quote.expiration_date = "2025-06-20";
+        quote.bid = bid;
+        quote.ask = ask;
+        quote.last = (bid + ask) / 2;
+        quote.open_interest = 100;
+        return quote;
+    }
+
+    // 100 strikes listed in descending order, both sides, except no put at 450.
+    static OptionChain make_chain() {
+        OptionChain chain;
+        chain.underlying = "SPY";
+        for (int i = 99; i >= 0; --i) {
+            double strike = 400.0 + i;
+            chain.options.push_back(make_option(strike, true, 1.0 + i, 1.1 + i));
+            if (strike != 450.0) {
+                chain.options.push_back(make_option(strike, false, 2.0 + i, 2.1 + i));
+            }
+        }
+        return chain;
+    }
+
+    static StreamingQuote make_quote(const std::string& symbol, double bid, double ask) {
+        StreamingQuote quote{};
+        quote.symbol = symbol;
+        quote.bid = bid;
+        quote.ask = ask;
+        quote.last = 0.0;
+        quote.bid_size = 10;
+        quote.ask_size = 20;
+        quote.timestamp = std::chrono::system_clock::now();
+        return quote;
+    }
+
+    OptionChainStore store_;
+};
+
+TEST_F(OptionChainStoreTest, LoadSortsStrikesAndPairsSides) {
+    auto snap = store_.load("SPY", "2025-06-20", make_chain());
+    ASSERT_NE(snap, nullptr);
+    EXPECT_EQ(snap->size(), 100u);
+    EXPECT_TRUE(std::is_sorted(snap->strikes().begin(), snap->strikes().end()));
+
+    auto row = snap->find_strike(425.0);
+    ASSERT_TRUE(row.has_value());
+    EXPECT_EQ(*row, 25u);
+    EXPECT_EQ(snap->call(*row)->symbol, occ(425.0, true));
+    EXPECT_DOUBLE_EQ(snap->put(*row)->bid, 27.0);
+    EXPECT_DOUBLE_EQ(snap->call(*row)->open_interest, 100.0);
+
+    EXPECT_FALSE(snap->put(*snap->find_strike(450.0)).has_value());
+    EXPECT_FALSE(snap->find_strike(425.5).has_value());
+    EXPECT_EQ(snap->lower_bound(425.5), 26u);
+    EXPECT_EQ(store_.symbols("SPY", "2025-06-20").size(), 199u);
+}
+
+TEST_F(OptionChainStoreTest, StreamUpdatesApplyInPlace) {
+    store_.load("SPY", "2025-06-20", make_chain());
+    auto before = store_.snapshot("SPY", "2025-06-20");
+
+    EXPECT_TRUE(store_.apply(make_quote(occ(470.0, false), 9.5, 9.7)));
+    EXPECT_FALSE(store_.apply(make_quote("QQQ250620C00400000", 1.0, 1.1)));
+
+    auto after = store_.snapshot("SPY", "2025-06-20");
+    auto row = *after->find_strike(470.0);
+    auto put = after->put(row);
+    ASSERT_TRUE(put.has_value());
+    EXPECT_DOUBLE_EQ(put->bid, 9.5);
+    EXPECT_DOUBLE_EQ(put->mid(), 9.6);
+    EXPECT_EQ(put->ask_size, 20);
+    EXPECT_GT(after->version(), before->version());
+
+    // The earlier snapshot is unaffected by the update.
+    EXPECT_DOUBLE_EQ(before->put(row)->bid, 72.0);
+}
+
+TEST_F(OptionChainStoreTest, CopyOnWriteOnlyTouchesUpdatedPage) {
+    store_.load("SPY", "2025-06-20", make_chain());
+    auto before = store_.snapshot("SPY", "2025-06-20");
+
+    store_.apply(make_quote(occ(401.0, true), 0.5, 0.6));
+    auto after = store_.snapshot("SPY", "2025-06-20");
+
+    ASSERT_EQ(after->page_count(), 4u);
+    EXPECT_NE(&before->page(0), &after->page(0));
+    EXPECT_EQ(&before->page(1), &after->page(1));
+    EXPECT_EQ(&before->strikes(), &after->strikes());
+}
+
+TEST_F(OptionChainStoreTest, PublishedPagesAreNeverWrittenInPlace) {
+    store_.load("SPY", "2025-06-20", make_chain());
+    const OptionChainPage* published = &store_.snapshot("SPY", "2025-06-20")->page(0);
+
+    // Even with no snapshot left holding it, a published page is copied
+    // before the write; a reader on another thread may still be finishing.
+    store_.apply(make_quote(occ(401.0, true), 0.5, 0.6));
+    auto first = store_.snapshot("SPY", "2025-06-20");
+    EXPECT_NE(&first->page(0), published);
+
+    // That page was published too, so the next write copies it once and the
+    // write after it lands in the same private copy.
+    const OptionChainPage* current = &first->page(0);
+    first.reset();
+    store_.apply(make_quote(occ(401.0, true), 0.7, 0.8));
+    store_.apply(make_quote(occ(401.0, true), 0.9, 1.0));
+    auto second = store_.snapshot("SPY", "2025-06-20");
+    EXPECT_NE(&second->page(0), current);
+    EXPECT_DOUBLE_EQ(second->call(*second->find_strike(401.0))->bid, 0.9);
+}
+
+TEST_F(OptionChainStoreTest, TradesUpdateLastAndVolume) {
+    store_.load("SPY", "2025-06-20", make_chain());
+
+    StreamingTrade trade{};
+    trade.symbol = occ(430.0, true);
+    trade.price = 31.25;
+    trade.size = 7;
+    trade.timestamp = std::chrono::system_clock::now();
+    EXPECT_TRUE(store_.apply(trade));
+
+    auto snap = store_.snapshot("SPY", "2025-06-20");
+    auto call = snap->call(*snap->find_strike(430.0));
+    EXPECT_DOUBLE_EQ(call->last, 31.25);
+    EXPECT_DOUBLE_EQ(call->volume, 7.0);
+}
+
+TEST_F(OptionChainStoreTest, ReloadAndEraseReindexContracts) {
+    store_.load("SPY", "2025-06-20", make_chain());
+    auto old_snap = store_.snapshot("SPY", "2025-06-20");
+
+    OptionChain smaller;
+    smaller.options.push_back(make_option(500.0, true, 1.0, 1.2));
+    store_.load("SPY", "2025-06-20", smaller);
+
+    EXPECT_EQ(store_.chain_count(), 1u);
+    EXPECT_FALSE(store_.apply(make_quote(occ(425.0, true), 1.0, 1.1)));
+    EXPECT_TRUE(store_.apply(make_quote(occ(500.0, true), 1.0, 1.1)));
+    EXPECT_EQ(old_snap->size(), 100u);
+
+    EXPECT_TRUE(store_.erase("SPY", "2025-06-20"));
+    EXPECT_FALSE(store_.apply(make_quote(occ(500.0, true), 1.0, 1.1)));
+    EXPECT_EQ(store_.snapshot("SPY", "2025-06-20"), nullptr);
+    EXPECT_TRUE(store_.symbols().empty());
+}
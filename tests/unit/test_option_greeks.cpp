@@ -0,0 +1,166 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "oqdTradierpp/market/option_greeks.hpp"
+
+using namespace oqd;
+
+class OptionGreeksTest : public ::testing::Test {
+protected:
+    static double reference_cdf(double x) {
+        return 0.5 * std::erfc(-x / std::sqrt(2.0));
+    }
+
+    // Textbook Black-Scholes-Merton using the standard library.
+    static double reference_price(double s, double k, double t, double r, double q, double vol, bool call) {
+        double d1 = (std::log(s / k) + (r - q + 0.5 * vol * vol) * t) / (vol * std::sqrt(t));
+        double d2 = d1 - vol * std::sqrt(t);
+        if (call) {
+            return s * std::exp(-q * t) * reference_cdf(d1) - k * std::exp(-r * t) * reference_cdf(d2);
+        }
+        return k * std::exp(-r * t) * reference_cdf(-d2) - s * std::exp(-q * t) * reference_cdf(-d1);
+    }
+
+    static Quote make_option(double strike, const std::string& type, double bid, double ask) {
+        Quote quote{};
+        quote.symbol = "SPY";
+        quote.strike = strike;
+        quote.option_type = type;
+        quote.expiration_date = "2026-01-16";
+        quote.bid = bid;
+        quote.ask = ask;
+        return quote;
+    }
+
+    GreeksParams params_{100.0, 0.05, 0.01, 1e-10, 64};
+};
+
+TEST_F(OptionGreeksTest, PricesMatchReference) {
+    OptionColumns columns;
+    std::vector<double> vols;
+    for (double k : {50.0, 80.0, 100.0, 120.0, 200.0}) {
+        for (double t : {0.01, 0.25, 2.0}) {
+            for (bool call : {true, false}) {
+                columns.push_back(k, t, call, 0.0);
+                vols.push_back(0.35);
+            }
+        }
+    }
+
+    GreeksColumns out;
+    compute_greeks(columns, vols, params_, out);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        double expected = reference_price(100.0, columns.strike[i], columns.expiry_years[i], 0.05, 0.01, 0.35,
+                                          columns.sign[i] > 0.0);
+        EXPECT_NEAR(out.theoretical[i], expected, 1e-10) << "contract " << i;
+    }
+}
+
+TEST_F(OptionGreeksTest, GreeksMatchFiniteDifferences) {
+    OptionColumns columns;
+    columns.push_back(105.0, 0.5, true, 0.0);
+    columns.push_back(95.0, 0.5, false, 0.0);
+    std::vector<double> vols{0.25, 0.25};
+
+    GreeksColumns out;
+    compute_greeks(columns, vols, params_, out);
+
+    const double h = 1e-4;
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        bool call = columns.sign[i] > 0.0;
+        double k = columns.strike[i];
+        auto price = [&](double s, double t, double r, double vol) {
+            return reference_price(s, k, t, r, 0.01, vol, call);
+        };
+        double delta = (price(100.0 + h, 0.5, 0.05, 0.25) - price(100.0 - h, 0.5, 0.05, 0.25)) / (2 * h);
+        double gamma = (price(100.0 + h, 0.5, 0.05, 0.25) - 2 * price(100.0, 0.5, 0.05, 0.25) +
+                        price(100.0 - h, 0.5, 0.05, 0.25)) / (h * h);
+        double vega = (price(100.0, 0.5, 0.05, 0.25 + h) - price(100.0, 0.5, 0.05, 0.25 - h)) / (2 * h);
+        double theta = -(price(100.0, 0.5 + h, 0.05, 0.25) - price(100.0, 0.5 - h, 0.05, 0.25)) / (2 * h);
+        double rho = (price(100.0, 0.5, 0.05 + h, 0.25) - price(100.0, 0.5, 0.05 - h, 0.25)) / (2 * h);
+
+        EXPECT_NEAR(out.delta[i], delta, 1e-6);
+        EXPECT_NEAR(out.gamma[i], gamma, 1e-4);
+        EXPECT_NEAR(out.vega[i], vega * 0.01, 1e-6);
+        EXPECT_NEAR(out.theta[i], theta / 365.0, 1e-6);
+        EXPECT_NEAR(out.rho[i], rho * 0.01, 1e-6);
+    }
+}
+
+TEST_F(OptionGreeksTest, ImpliedVolatilityRoundTrip) {
+    OptionColumns columns;
+    std::vector<double> expected;
+    for (double k : {60.0, 90.0, 100.0, 110.0, 150.0}) {
+        for (double vol : {0.08, 0.3, 1.2}) {
+            for (bool call : {true, false}) {
+                double price = reference_price(100.0, k, 0.75, 0.05, 0.01, vol, call);
+                // Skip contracts whose price barely depends on volatility; their
+                // implied volatility is not identifiable to the test tolerance.
+                double bumped = reference_price(100.0, k, 0.75, 0.05, 0.01, vol * 1.01, call);
+                if (bumped - price < 1e-4) {
+                    continue;
+                }
+                columns.push_back(k, 0.75, call, price);
+                expected.push_back(vol);
+            }
+        }
+    }
+
+    std::vector<double> iv;
+    compute_implied_volatility(columns, params_, iv);
+    ASSERT_EQ(iv.size(), expected.size());
+    for (std::size_t i = 0; i < iv.size(); ++i) {
+        EXPECT_NEAR(iv[i], expected[i], 1e-6) << "strike " << columns.strike[i];
+    }
+}
+
+TEST_F(OptionGreeksTest, ArbitrageViolationsYieldNaN) {
+    OptionColumns columns;
+    columns.push_back(80.0, 0.5, true, 10.0);    // below intrinsic
+    columns.push_back(100.0, 0.5, true, 150.0);  // above the spot
+    columns.push_back(100.0, -0.1, false, 5.0);  // expired
+    columns.push_back(100.0, 0.5, false, 0.0);   // no market
+
+    auto out = analyze_chain(columns, params_);
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        EXPECT_TRUE(std::isnan(out.iv[i])) << "contract " << i;
+        EXPECT_TRUE(std::isnan(out.delta[i])) << "contract " << i;
+    }
+}
+
+TEST_F(OptionGreeksTest, RefreshGreeksOnChain) {
+    OptionChain chain;
+    chain.underlying = "SPY";
+    chain.options.push_back(make_option(100.0, "call", 4.9, 5.1));
+    chain.options.push_back(make_option(100.0, "put", 4.4, 4.6));
+    chain.options.push_back(Quote{});
+    chain.options.push_back(make_option(100.0, "call", 4.9, 5.1));
+    chain.options.back().expiration_date = "2026-1-16";
+
+    auto now = std::chrono::sys_days{std::chrono::year{2025} / 7 / 16} + std::chrono::hours{20};
+    auto columns = OptionColumns::from_chain(chain, now);
+    ASSERT_EQ(columns.size(), 3u);
+    EXPECT_NEAR(columns.expiry_years[0], 184.0 / 365.0, 1e-12);
+    EXPECT_EQ(columns.expiry_years[2], 0.0);
+    EXPECT_DOUBLE_EQ(columns.price[0], 5.0);
+
+    auto out = refresh_greeks(chain, params_, now);
+    ASSERT_TRUE(chain.options[0].mid_iv.has_value());
+    ASSERT_TRUE(chain.options[1].delta.has_value());
+    EXPECT_NEAR(*chain.options[0].mid_iv, out.iv[0], 0.0);
+    EXPECT_GT(*chain.options[0].delta, 0.0);
+    EXPECT_LT(*chain.options[1].delta, 0.0);
+    EXPECT_FALSE(chain.options[2].delta.has_value());
+}
@@ -0,0 +1,151 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include "concurrency_gate.hpp"
+#include "oqdTradierpp/trading/order_batch.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OrderBatchTest : public ::testing::Test {
+protected:
+    // Fake broker; every answer passes through the concurrency gate.
+    std::future<OrderResponse> respond(std::string id) {
+        return std::async(std::launch::async, [this, id] {
+            gate_.pass();
+            if (id == "bad") {
+                throw std::runtime_error("HTTP error: 400");
+            }
+            return OrderResponse{id, "ok"};
+        });
+    }
+
+    static Order order(std::string id, OrderStatus status, std::string symbol = "SPY") {
+        Order o{};
+        o.id = std::move(id);
+        o.status = status;
+        o.symbol = std::move(symbol);
+        return o;
+    }
+
+    ConcurrencyGate gate_;
+};
+
+TEST_F(OrderBatchTest, FlattenKeepsTheWholeBoundInFlight) {
+    OrderBatchOptions options;
+    options.max_in_flight = 32;
+    RequestWindowBudget budget(0, seconds(60));
+    gate_.set_target(32);
+    auto result = dispatch_order_batch(96, options, budget, [&](std::size_t i) {
+        return respond(std::to_string(i));
+    });
+    ASSERT_EQ(result.items.size(), 96u);
+    EXPECT_TRUE(result.ok());
+    EXPECT_EQ(result.items[17].order_id, "17");
+    EXPECT_EQ(result.items[17].response->status, "ok");
+    // Every slot was in use at once, and no request waited on the budget.
+    EXPECT_EQ(gate_.peak(), 32);
+    EXPECT_EQ(result.budget_waits, 0u);
+}
+
+TEST_F(OrderBatchTest, BoundsInFlightRequests) {
+    OrderBatchOptions options;
+    options.max_in_flight = 8;
+    RequestWindowBudget budget(0, seconds(60));
+    gate_.set_target(8);
+    auto result = dispatch_order_batch(40, options, budget, [&](std::size_t i) {
+        return respond(std::to_string(i));
+    });
+    EXPECT_TRUE(result.ok());
+    EXPECT_EQ(gate_.peak(), 8);
+}
+
+TEST_F(OrderBatchTest, ReportsFailuresPerOrderAndKeepsGivenIds) {
+    std::vector<std::string> ids = {"101", "bad", "103"};
+    std::vector<OrderBatchItem> items(ids.size());
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        items[i].order_id = ids[i];
+    }
+    RequestWindowBudget budget(0, seconds(60));
+    auto result = dispatch_order_batch(ids.size(), OrderBatchOptions{}, budget, [&](std::size_t i) {
+        return respond(ids[i]);
+    }, std::move(items));
+    EXPECT_FALSE(result.ok());
+    EXPECT_EQ(result.succeeded(), 2u);
+    EXPECT_EQ(result.failed(), (std::vector<std::size_t>{1}));
+    EXPECT_EQ(result.items[1].order_id, "bad");
+    EXPECT_EQ(result.items[1].error, "HTTP error: 400");
+    EXPECT_FALSE(result.items[1].response.has_value());
+}
+
+TEST_F(OrderBatchTest, SubmitThrowingSynchronouslyIsRecorded) {
+    RequestWindowBudget budget(0, seconds(60));
+    auto result = dispatch_order_batch(2, OrderBatchOptions{}, budget, [&](std::size_t i) -> std::future<OrderResponse> {
+        if (i == 0) {
+            throw std::invalid_argument("Invalid account ID");
+        }
+        return respond("2");
+    });
+    EXPECT_EQ(result.items[0].error, "Invalid account ID");
+    EXPECT_TRUE(result.items[1].ok());
+}
+
+TEST_F(OrderBatchTest, LatencyComesFromTheCompletionStamp) {
+    // Stamped 5ms after issue, ready only after 50ms.
+    RequestWindowBudget budget(0, seconds(60));
+    auto result = dispatch_order_batch(4, OrderBatchOptions{}, budget, [](std::size_t i) {
+        auto issued = steady_clock::now();
+        return std::async(std::launch::async, [i, issued] {
+            std::this_thread::sleep_for(milliseconds(50));
+            return Timed<OrderResponse>{OrderResponse{std::to_string(i), "ok"}, issued + milliseconds(5)};
+        });
+    });
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result.items[3].order_id, "3");
+    for (const auto& item : result.items) {
+        EXPECT_GE(item.latency, milliseconds(5));
+        EXPECT_LT(item.latency, milliseconds(50));
+    }
+}
+
+TEST_F(OrderBatchTest, BudgetPacesBatch) {
+    RequestWindowBudget budget(4, milliseconds(200));
+    OrderBatchOptions options;
+    options.max_in_flight = 16;
+    auto result = dispatch_order_batch(10, options, budget, [&](std::size_t i) {
+        return respond(std::to_string(i));
+    });
+    EXPECT_TRUE(result.ok());
+    // Ten orders at four per window: the fifth and ninth open new windows.
+    EXPECT_EQ(result.budget_waits, 2u);
+    EXPECT_GT(result.budget_wait, microseconds(0));
+}
+
+TEST_F(OrderBatchTest, SelectsWorkingOrdersThroughFilter) {
+    std::vector<Order> orders = {
+        order("1", OrderStatus::Open),
+        order("2", OrderStatus::Filled),
+        order("3", OrderStatus::PartiallyFilled, "QQQ"),
+        order("4", OrderStatus::Pending),
+        order("5", OrderStatus::Canceled),
+        order("", OrderStatus::Open),
+    };
+    EXPECT_EQ(working_order_ids(orders), (std::vector<std::string>{"1", "3", "4"}));
+    EXPECT_EQ(working_order_ids(orders, [](const Order& o) { return o.symbol == "SPY"; }),
+              (std::vector<std::string>{"1", "4"}));
+}
@@ -0,0 +1,164 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+#include "oqdTradierpp/trading/order_guard.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class OrderGuardTest : public ::testing::Test {
+protected:
+    static EquityOrderRequest limit_buy(const std::string& symbol, int quantity, double price) {
+        EquityOrderRequest order;
+        order.symbol = symbol;
+        order.side = OrderSide::Buy;
+        order.quantity = quantity;
+        order.type = OrderType::Limit;
+        order.price = price;
+        return order;
+    }
+
+    // Sub-windows are aligned to the clock, so start the tests on a second.
+    OrderSubmissionGuard::Clock::time_point t0_{ceil<seconds>(OrderSubmissionGuard::Clock::now().time_since_epoch())};
+};
+
+TEST_F(OrderGuardTest, DefaultLimitsAdmitEverything) {
+    OrderSubmissionGuard guard;
+    auto order = limit_buy("SPY", 10, 450.0);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(guard.admit("ACC", order, t0_), GuardVerdict::Allowed);
+    }
+    EXPECT_EQ(to_string(GuardVerdict::SymbolRate), "symbol_rate");
+}
+
+TEST_F(OrderGuardTest, AccountRateSlidesWithWindow) {
+    OrderSubmissionGuard guard({.max_orders_per_account = 3, .rate_window = milliseconds(800)});
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 1 + i, 450.0), t0_ + milliseconds(i * 100)),
+                  GuardVerdict::Allowed);
+    }
+    EXPECT_EQ(guard.admit("ACC", limit_buy("QQQ", 1, 380.0), t0_ + milliseconds(300)), GuardVerdict::AccountRate);
+    EXPECT_EQ(guard.admit("OTHER", limit_buy("QQQ", 1, 380.0), t0_ + milliseconds(300)), GuardVerdict::Allowed);
+    // The first order ages out of the window, freeing exactly one slot.
+    EXPECT_EQ(guard.admit("ACC", limit_buy("QQQ", 1, 380.0), t0_ + milliseconds(850)), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("QQQ", 2, 380.0), t0_ + milliseconds(850)), GuardVerdict::AccountRate);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("QQQ", 3, 380.0), t0_ + milliseconds(2000)), GuardVerdict::Allowed);
+}
+
+TEST_F(OrderGuardTest, SymbolRateRefundsAccountBudget) {
+    OrderSubmissionGuard guard({.max_orders_per_account = 3, .max_orders_per_symbol = 1});
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 1, 450.0), t0_), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 2, 450.0), t0_), GuardVerdict::SymbolRate);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 3, 450.0), t0_), GuardVerdict::SymbolRate);
+    // Symbol rejections did not spend the account's remaining two orders.
+    EXPECT_EQ(guard.admit("ACC", limit_buy("QQQ", 1, 380.0), t0_), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("IWM", 1, 200.0), t0_), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("DIA", 1, 390.0), t0_), GuardVerdict::AccountRate);
+}
+
+TEST_F(OrderGuardTest, DuplicatesRejectedInsideWindow) {
+    OrderSubmissionGuard guard({.duplicate_window = milliseconds(500)});
+    auto order = limit_buy("SPY", 10, 450.10);
+    EXPECT_EQ(guard.admit("ACC", order, t0_), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", order, t0_ + milliseconds(100)), GuardVerdict::Duplicate);
+    // Same price on the tick grid is the same order.
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 10, 450.1000000001), t0_ + milliseconds(100)),
+              GuardVerdict::Duplicate);
+
+    auto tagged = order;
+    tagged.tag = "leg-2";
+    EXPECT_EQ(guard.admit("ACC", tagged, t0_ + milliseconds(100)), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 11, 450.10), t0_ + milliseconds(100)), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 10, 450.11), t0_ + milliseconds(100)), GuardVerdict::Allowed);
+    EXPECT_EQ(guard.admit("OTHER", order, t0_ + milliseconds(100)), GuardVerdict::Allowed);
+    // Rejections do not restart the window.
+    EXPECT_EQ(guard.admit("ACC", order, t0_ + milliseconds(450)), GuardVerdict::Duplicate);
+    EXPECT_EQ(guard.admit("ACC", order, t0_ + milliseconds(600)), GuardVerdict::Allowed);
+}
+
+TEST_F(OrderGuardTest, RateRejectedOrderIsNotRememberedAsDuplicate) {
+    OrderSubmissionGuard guard({.max_orders_per_symbol = 1, .duplicate_window = milliseconds(5000)});
+    EXPECT_EQ(guard.admit("ACC", limit_buy("SPY", 1, 450.0), t0_), GuardVerdict::Allowed);
+    auto retry = limit_buy("SPY", 2, 450.0);
+    EXPECT_EQ(guard.admit("ACC", retry, t0_), GuardVerdict::SymbolRate);
+    EXPECT_EQ(guard.admit("ACC", retry, t0_ + milliseconds(1500)), GuardVerdict::Allowed);
+}
+
+TEST_F(OrderGuardTest, FingerprintsCoverEveryOrderShape) {
+    MultilegOrderRequest multileg{};
+    multileg.type = OrderType::Limit;
+    multileg.duration = OrderDuration::Day;
+    multileg.price = 1.25;
+    multileg.legs = {{"SPY240119C00450000", OrderSide::BuyToOpen, 1}, {"SPY240119C00460000", OrderSide::SellToOpen, 1}};
+    auto swapped = multileg;
+    std::swap(swapped.legs[0].side, swapped.legs[1].side);
+    EXPECT_NE(OrderSubmissionGuard::fingerprint("ACC", multileg), OrderSubmissionGuard::fingerprint("ACC", swapped));
+    EXPECT_EQ(OrderSubmissionGuard::rate_symbol(multileg), "SPY240119C00450000");
+
+    OptionOrderRequest option;
+    option.symbol = "SPY";
+    option.option_symbol = "SPY240119C00450000";
+    option.side = OrderSide::BuyToOpen;
+    option.quantity = 1;
+    EXPECT_EQ(OrderSubmissionGuard::rate_symbol(option), "SPY240119C00450000");
+    auto other = option;
+    other.option_symbol = "SPY240119P00450000";
+    EXPECT_NE(OrderSubmissionGuard::fingerprint("ACC", option), OrderSubmissionGuard::fingerprint("ACC", other));
+
+    OrderFingerprint a, b;
+    a.add("AB").add("C");
+    b.add("A").add("BC");
+    EXPECT_NE(a.value(), b.value());
+}
+
+TEST_F(OrderGuardTest, FingerprintsTolerateUnrepresentablePrices) {
+    auto nan = limit_buy("SPY", 1, std::numeric_limits<double>::quiet_NaN());
+    auto huge = limit_buy("SPY", 1, 1e300);
+    auto unpriced = limit_buy("SPY", 1, 0.0);
+    unpriced.price.reset();
+    EXPECT_EQ(OrderSubmissionGuard::fingerprint("ACC", huge), OrderSubmissionGuard::fingerprint("ACC", huge));
+    EXPECT_NE(OrderSubmissionGuard::fingerprint("ACC", nan), OrderSubmissionGuard::fingerprint("ACC", unpriced));
+    EXPECT_NE(OrderSubmissionGuard::fingerprint("ACC", huge), OrderSubmissionGuard::fingerprint("ACC", limit_buy("SPY", 1, 1e6)));
+}
+
+TEST_F(OrderGuardTest, ConcurrentAdmitNeverExceedsLimit) {
+    OrderSubmissionGuard guard({.max_orders_per_account = 100, .max_orders_per_symbol = 40,
+                                .rate_window = milliseconds(60000)});
+    std::atomic<int> account_admitted{0};
+    std::atomic<int> spy_admitted{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 200; ++i) {
+                const bool spy = (i % 2) == 0;
+                auto order = limit_buy(spy ? "SPY" : "QQQ" + std::to_string(t * 1000 + i), i, 100.0);
+                if (guard.admit("ACC", order, t0_) == GuardVerdict::Allowed) {
+                    ++account_admitted;
+                    if (spy) {
+                        ++spy_admitted;
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(spy_admitted.load(), 40);
+    EXPECT_EQ(account_admitted.load(), 100);
+}
@@ -0,0 +1,188 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include "oqdTradierpp/trading/order_tracker.hpp"
+
+using namespace oqd;
+
+class OrderTrackerTest : public ::testing::Test {
+protected:
+    static Order make_order(const std::string& id, OrderStatus status, int quantity,
+                            const std::optional<std::string>& tag = std::nullopt) {
+        Order order{};
+        order.id = id;
+        order.type = OrderType::Limit;
+        order.symbol = "AAPL";
+        order.side = OrderSide::Buy;
+        order.quantity = quantity;
+        order.status = status;
+        order.duration = OrderDuration::Day;
+        order.exec_quantity = 0;
+        order.remaining_quantity = quantity;
+        order.tag = tag;
+        return order;
+    }
+
+    static StreamingOrderStatus make_event(const std::string& id, const std::string& status,
+                                           double filled = 0.0, double avg_price = 0.0) {
+        StreamingOrderStatus event;
+        event.order_id = id;
+        event.status = status;
+        event.symbol = "AAPL";
+        event.order_type = OrderType::Limit;
+        event.side = OrderSide::Buy;
+        event.quantity = 100;
+        event.filled_quantity = filled;
+        event.avg_fill_price = avg_price;
+        event.remaining_quantity = 100 - filled;
+        event.timestamp = std::chrono::system_clock::now();
+        return event;
+    }
+
+    OrderTracker tracker_;
+};
+
+TEST_F(OrderTrackerTest, StateMachineTransitions) {
+    EXPECT_TRUE(OrderTracker::can_transition(OrderStatus::Pending, OrderStatus::Open));
+    EXPECT_TRUE(OrderTracker::can_transition(OrderStatus::Open, OrderStatus::PartiallyFilled));
+    EXPECT_TRUE(OrderTracker::can_transition(OrderStatus::PartiallyFilled, OrderStatus::Filled));
+    EXPECT_TRUE(OrderTracker::can_transition(OrderStatus::Open, OrderStatus::Rejected));
+    EXPECT_FALSE(OrderTracker::can_transition(OrderStatus::PartiallyFilled, OrderStatus::Open));
+    EXPECT_FALSE(OrderTracker::can_transition(OrderStatus::Filled, OrderStatus::Canceled));
+    EXPECT_FALSE(OrderTracker::can_transition(OrderStatus::Canceled, OrderStatus::Open));
+    EXPECT_FALSE(OrderTracker::can_transition(OrderStatus::Open, OrderStatus::Open));
+}
+
+TEST_F(OrderTrackerTest, SeedIndexesByIdAndTag) {
+    EXPECT_EQ(tracker_.seed({make_order("1", OrderStatus::Open, 100, "alpha"),
+                             make_order("2", OrderStatus::Filled, 50)}), 2u);
+
+    EXPECT_EQ(tracker_.size(), 2u);
+    EXPECT_EQ(tracker_.open_count(), 1u);
+    ASSERT_TRUE(tracker_.find_by_tag("alpha").has_value());
+    EXPECT_EQ(tracker_.find_by_tag("alpha")->id, "1");
+    EXPECT_EQ(tracker_.status_of("2"), OrderStatus::Filled);
+    EXPECT_FALSE(tracker_.find("3").has_value());
+}
+
+TEST_F(OrderTrackerTest, PartialFillsEmitFillCallbacks) {
+    tracker_.seed({make_order("1", OrderStatus::Open, 100)});
+
+    std::vector<OrderFill> fills;
+    tracker_.on_fill([&fills](const OrderFill& fill) { fills.push_back(fill); });
+
+    EXPECT_TRUE(tracker_.apply(make_event("1", "partially_filled", 40, 10.0)));
+    EXPECT_TRUE(tracker_.apply(make_event("1", "filled", 100, 10.6)));
+
+    ASSERT_EQ(fills.size(), 2u);
+    EXPECT_DOUBLE_EQ(fills[0].quantity, 40);
+    EXPECT_DOUBLE_EQ(fills[0].price, 10.0);
+    EXPECT_EQ(fills[0].status, OrderStatus::PartiallyFilled);
+    EXPECT_DOUBLE_EQ(fills[1].quantity, 60);
+    EXPECT_NEAR(fills[1].price, 11.0, 1e-9);
+    EXPECT_EQ(fills[1].status, OrderStatus::Filled);
+
+    auto order = tracker_.find("1");
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->status, OrderStatus::Filled);
+    EXPECT_DOUBLE_EQ(order->remaining_quantity, 0.0);
+    EXPECT_EQ(tracker_.open_count(), 0u);
+}
+
+TEST_F(OrderTrackerTest, IgnoresStaleAndDuplicateEvents) {
+    tracker_.seed({make_order("1", OrderStatus::Open, 100)});
+    int status_changes = 0;
+    tracker_.on_status_change([&status_changes](const TrackedOrder&, OrderStatus) { ++status_changes; });
+
+    EXPECT_TRUE(tracker_.apply(make_event("1", "partially_filled", 40, 10.0)));
+    EXPECT_FALSE(tracker_.apply(make_event("1", "partially_filled", 40, 10.0)));
+    EXPECT_FALSE(tracker_.apply(make_event("1", "open")));
+    EXPECT_TRUE(tracker_.apply(make_event("1", "canceled", 40, 10.0)));
+    EXPECT_FALSE(tracker_.apply(make_event("1", "open")));
+
+    EXPECT_EQ(status_changes, 2);
+    EXPECT_EQ(tracker_.status_of("1"), OrderStatus::Canceled);
+}
+
+TEST_F(OrderTrackerTest, StreamEventsCreateUnseededOrders) {
+    simdjson::dom::parser parser;
+    std::string json = R"({"id":8675309,"event":"order","status":"open","type":"limit","side":"sell",)"
+                       R"("symbol":"SPY","quantity":5,"executed_quantity":0,"remaining_quantity":5,"tag":"hedge"})";
+    auto doc = parser.parse(json);
+    ASSERT_EQ(doc.error(), simdjson::SUCCESS);
+
+    auto callback = tracker_.stream_callback();
+    callback(doc.value());
+
+    auto order = tracker_.find_by_tag("hedge");
+    ASSERT_TRUE(order.has_value());
+    EXPECT_EQ(order->id, "8675309");
+    EXPECT_EQ(order->status, OrderStatus::Open);
+    EXPECT_EQ(order->side, OrderSide::Sell);
+
+    std::string journal_json = R"({"event":"journal","status":"done"})";
+    auto journal = parser.parse(journal_json);
+    EXPECT_FALSE(tracker_.on_stream_event(journal.value()));
+    EXPECT_EQ(tracker_.size(), 1u);
+}
+
+TEST_F(OrderTrackerTest, PruneTerminalOrders) {
+    tracker_.seed({make_order("1", OrderStatus::Open, 100, "keep"),
+                   make_order("2", OrderStatus::Canceled, 100, "gone")});
+
+    EXPECT_EQ(tracker_.prune_terminal(), 1u);
+    EXPECT_EQ(tracker_.size(), 1u);
+    EXPECT_FALSE(tracker_.find_by_tag("gone").has_value());
+    EXPECT_EQ(tracker_.open_orders().size(), 1u);
+}
+TEST_F(OrderTrackerTest, ReplayedEventsForPrunedOrdersAreIgnored) {
+    double filled = 0.0;
+    tracker_.on_fill([&](const OrderFill& fill) { filled += fill.quantity; });
+
+    auto event = make_event("7", "filled", 100, 10.0);
+    EXPECT_TRUE(tracker_.apply(event));
+    EXPECT_EQ(tracker_.prune_terminal(), 1u);
+
+    // A reconnect replays the same event; it must not report the fill again.
+    EXPECT_FALSE(tracker_.apply(event));
+    EXPECT_DOUBLE_EQ(filled, 100.0);
+    EXPECT_FALSE(tracker_.find("7").has_value());
+    EXPECT_EQ(tracker_.seed({make_order("7", OrderStatus::Filled, 100)}), 0u);
+}
+
+TEST_F(OrderTrackerTest, PrunedIdsAreBounded) {
+    tracker_.apply(make_event("first", "canceled"));
+    EXPECT_EQ(tracker_.prune_terminal(), 1u);
+    for (std::size_t i = 0; i < OrderTracker::pruned_history; ++i) {
+        tracker_.apply(make_event(std::to_string(i), "canceled"));
+    }
+    EXPECT_EQ(tracker_.prune_terminal(), OrderTracker::pruned_history);
+
+    // The oldest id has aged out; the most recent ones are still suppressed.
+    EXPECT_EQ(tracker_.seed({make_order("first", OrderStatus::Canceled, 100),
+                             make_order("0", OrderStatus::Canceled, 100)}), 1u);
+    EXPECT_TRUE(tracker_.find("first").has_value());
+    EXPECT_FALSE(tracker_.find("0").has_value());
+}
+
+TEST_F(OrderTrackerTest, CallbacksMayRegisterCallbacks) {
+    int fills = 0;
+    tracker_.on_status_change([&](const TrackedOrder&, OrderStatus) {
+        tracker_.on_fill([&](const OrderFill&) { ++fills; });
+    });
+    tracker_.apply(make_event("1", "open"));
+    tracker_.apply(make_event("1", "partially_filled", 40, 10.0));
+    EXPECT_EQ(fills, 1);
+    EXPECT_EQ(tracker_.status_of("1"), OrderStatus::PartiallyFilled);
+}
@@ -0,0 +1,152 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "oqdTradierpp/account/closed_position.hpp"
+#include "oqdTradierpp/account/history_event.hpp"
+#include "oqdTradierpp/paged_range.hpp"
+#include "oqdTradierpp/utils.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class PagedHistoryTest : public ::testing::Test {
+protected:
+    // Serves `total` integers in pages, recording how many requests overlap.
+    PagedRange<int> numbers(int total, int page_size, int prefetch, milliseconds latency = milliseconds(0)) {
+        return PagedRange<int>(
+            [this, total, page_size, latency](int page) {
+                return std::async(std::launch::async, [this, total, page_size, latency, page] {
+                    int now = ++in_flight_;
+                    int seen = max_in_flight_.load();
+                    while (now > seen && !max_in_flight_.compare_exchange_weak(seen, now)) {}
+                    std::this_thread::sleep_for(latency);
+                    std::vector<int> items;
+                    for (int i = (page - 1) * page_size; i < std::min(total, page * page_size); ++i) {
+                        items.push_back(i);
+                    }
+                    --in_flight_;
+                    return items;
+                });
+            },
+            page_size, prefetch);
+    }
+
+    std::atomic<int> in_flight_{0};
+    std::atomic<int> max_in_flight_{0};
+};
+
+TEST_F(PagedHistoryTest, WalksPagesInOrderAndStopsOnShortPage) {
+    auto range = numbers(250, 100, 2);
+    std::vector<std::size_t> sizes;
+    int expected = 0;
+    for (const auto& page : range) {
+        sizes.push_back(page.size());
+        for (int value : page) {
+            EXPECT_EQ(value, expected++);
+        }
+    }
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{100, 100, 50}));
+    EXPECT_EQ(expected, 250);
+}
+
+TEST_F(PagedHistoryTest, ExactMultipleEndsOnEmptyPage) {
+    auto range = numbers(200, 100, 0);
+    EXPECT_EQ(range.collect().size(), 200u);
+    EXPECT_EQ(range.pages_requested(), 3);
+}
+
+TEST_F(PagedHistoryTest, PrefetchesWhileCallerConsumes) {
+    auto range = numbers(1000, 100, 3, milliseconds(20));
+    auto start = steady_clock::now();
+    std::size_t items = 0;
+    for (const auto& page : range) {
+        items += page.size();
+    }
+    auto elapsed = steady_clock::now() - start;
+    EXPECT_EQ(items, 1000u);
+    EXPECT_GE(max_in_flight_.load(), 3);
+    // Eleven sequential round trips would take 220 ms.
+    EXPECT_LT(elapsed, milliseconds(180));
+    // Never more than one prefetch window past the end.
+    EXPECT_LE(range.pages_requested(), 11 + 3);
+}
+
+TEST_F(PagedHistoryTest, FailedPageRethrowsAndEndsRange) {
+    PagedRange<int> range(
+        [](int page) {
+            return std::async(std::launch::deferred, [page]() -> std::vector<int> {
+                if (page == 2) {
+                    throw std::runtime_error("page 2 failed");
+                }
+                return {1, 2};
+            });
+        },
+        2, 1);
+    auto it = range.begin();
+    ASSERT_NE(it, range.end());
+    EXPECT_THROW(++it, std::runtime_error);
+    EXPECT_EQ(it, range.end());
+}
+
+TEST_F(PagedHistoryTest, ParsesIsoDates) {
+    EXPECT_EQ(utils::parse_iso_date("2024-02-29"), sys_days{2024y / February / 29});
+    EXPECT_EQ(utils::parse_iso_date("2018-10-31T00:00:00.000Z"), sys_days{2018y / October / 31});
+    EXPECT_FALSE(utils::parse_iso_date("2023-02-29").has_value());
+    EXPECT_FALSE(utils::parse_iso_date("2023/01/01").has_value());
+    EXPECT_FALSE(utils::parse_iso_date("2023-1-1").has_value());
+}
+
+TEST_F(PagedHistoryTest, DecodesNestedHistoryEvents) {
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(std::string(R"({"history":{"event":[
+        {"amount":-3000.0,"date":"2018-05-23T00:00:00Z","type":"trade",
+         "trade":{"commission":1.5,"description":"BUY SPY","price":300.0,"quantity":10.0,"symbol":"SPY","trade_type":"Equity"}},
+        {"amount":12.5,"date":"2018-06-01T00:00:00Z","type":"dividend",
+         "dividend":{"description":"SPY DIVIDEND","quantity":0.0}},
+        {"amount":5.0,"date":"2018-06-02T00:00:00Z","type":"rebate"}]}})"));
+    auto events = HistoryEvent::list_from_json(doc.value());
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[0].type, HistoryEventType::Trade);
+    EXPECT_EQ(events[0].date, sys_days{2018y / May / 23});
+    EXPECT_DOUBLE_EQ(events[0].amount, -3000.0);
+    EXPECT_DOUBLE_EQ(events[0].quantity, 10.0);
+    EXPECT_DOUBLE_EQ(events[0].commission, 1.5);
+    EXPECT_EQ(events[0].symbol, "SPY");
+    EXPECT_EQ(events[1].type, HistoryEventType::Dividend);
+    EXPECT_EQ(events[1].description, "SPY DIVIDEND");
+    EXPECT_EQ(events[2].type, HistoryEventType::Other);
+    EXPECT_EQ(to_string(HistoryEventType::Ach), "ach");
+
+    auto single = parser.parse(std::string(R"({"history":{"event":{"amount":1.0,"date":"2019-01-02","type":"fee"}}})"));
+    EXPECT_EQ(HistoryEvent::list_from_json(single.value()).size(), 1u);
+    auto empty = parser.parse(std::string(R"({"history":"null"})"));
+    EXPECT_TRUE(HistoryEvent::list_from_json(empty.value()).empty());
+}
+
+TEST_F(PagedHistoryTest, DecodesClosedPositions) {
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(std::string(R"({"gainloss":{"closed_position":{
+        "close_date":"2018-10-31T00:00:00.000Z","cost":12.7,"gain_loss":-2.64,"gain_loss_percent":-20.7874,
+        "open_date":"2018-06-19T00:00:00.000Z","proceeds":10.06,"quantity":1.0,"symbol":"GE","term":134}}})"));
+    auto positions = ClosedPosition::list_from_json(doc.value());
+    ASSERT_EQ(positions.size(), 1u);
+    EXPECT_EQ(positions[0].open_date, sys_days{2018y / June / 19});
+    EXPECT_EQ(positions[0].close_date, sys_days{2018y / October / 31});
+    EXPECT_EQ((positions[0].close_date - positions[0].open_date).count(), positions[0].term);
+    EXPECT_DOUBLE_EQ(positions[0].gain_loss, -2.64);
+    EXPECT_EQ(positions[0].symbol, "GE");
+}
@@ -0,0 +1,151 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include "oqdTradierpp/account/portfolio_engine.hpp"
+
+using namespace oqd;
+
+class PortfolioEngineTest : public ::testing::Test {
+protected:
+    static Position make_position(const std::string& symbol, double quantity, double cost_basis) {
+        Position position{};
+        position.symbol = symbol;
+        position.quantity = quantity;
+        position.cost_basis = cost_basis;
+        position.id = symbol;
+        return position;
+    }
+
+    static StreamingQuote make_quote(const std::string& symbol, double bid, double ask, double last = 0.0) {
+        StreamingQuote quote{};
+        quote.symbol = symbol;
+        quote.bid = bid;
+        quote.ask = ask;
+        quote.last = last;
+        quote.timestamp = std::chrono::system_clock::now();
+        return quote;
+    }
+
+    void seed_default() {
+        AccountBalances balances;
+        balances.total_cash = 10000.0;
+        engine_.seed({make_position("AAPL", 100, 15000.0),
+                      make_position("SPY250620C00500000", 2, 1000.0)}, balances);
+    }
+
+    PortfolioEngine engine_;
+};
+
+TEST_F(PortfolioEngineTest, ContractMultiplier) {
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("AAPL"), 1.0);
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("SPY250620C00500000"), 100.0);
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("AAPL250117P00150000"), 100.0);
+    EXPECT_DOUBLE_EQ(PortfolioEngine::contract_multiplier("BRK.B"), 1.0);
+}
+
+TEST_F(PortfolioEngineTest, SeedCarriesPositionsAtCost) {
+    seed_default();
+
+    auto aapl = engine_.position("AAPL");
+    ASSERT_TRUE(aapl.has_value());
+    EXPECT_DOUBLE_EQ(aapl->avg_cost, 150.0);
+    EXPECT_FALSE(aapl->marked);
+
+    auto option = engine_.position("SPY250620C00500000");
+    ASSERT_TRUE(option.has_value());
+    EXPECT_DOUBLE_EQ(option->avg_cost, 5.0);
+
+    auto snapshot = engine_.snapshot();
+    EXPECT_EQ(snapshot.open_positions, 2u);
+    EXPECT_DOUBLE_EQ(snapshot.market_value, 16000.0);
+    EXPECT_DOUBLE_EQ(snapshot.unrealized_pl, 0.0);
+    EXPECT_DOUBLE_EQ(snapshot.equity, 26000.0);
+}
+
+TEST_F(PortfolioEngineTest, QuotesMarkPositions) {
+    seed_default();
+
+    EXPECT_TRUE(engine_.on_quote(make_quote("AAPL", 159.9, 160.1)));
+    EXPECT_TRUE(engine_.on_quote(make_quote("SPY250620C00500000", 0.0, 0.0, 6.0)));
+    EXPECT_FALSE(engine_.on_quote(make_quote("MSFT", 400.0, 400.2)));
+    EXPECT_FALSE(engine_.on_quote(make_quote("AAPL", 0.0, 0.0)));
+
+    EXPECT_NEAR(engine_.unrealized_pl(), 1000.0 + 200.0, 1e-9);
+    EXPECT_NEAR(engine_.gross_exposure(), 16000.0 + 1200.0, 1e-9);
+    EXPECT_NEAR(engine_.net_exposure(), 17200.0, 1e-9);
+}
+
+TEST_F(PortfolioEngineTest, FillsRealizeAgainstAverageCost) {
+    seed_default();
+
+    engine_.apply_fill("AAPL", OrderSide::Buy, 100, 170.0);
+    auto aapl = engine_.position("AAPL");
+    ASSERT_TRUE(aapl.has_value());
+    EXPECT_DOUBLE_EQ(aapl->quantity, 200.0);
+    EXPECT_DOUBLE_EQ(aapl->avg_cost, 160.0);
+    EXPECT_DOUBLE_EQ(engine_.cash(), 10000.0 - 17000.0);
+
+    engine_.apply_fill("AAPL", OrderSide::Sell, 50, 180.0);
+    EXPECT_DOUBLE_EQ(engine_.realized_pl(), 1000.0);
+    EXPECT_DOUBLE_EQ(engine_.position("AAPL")->quantity, 150.0);
+
+    engine_.apply_fill("SPY250620C00500000", OrderSide::SellToClose, 2, 4.0);
+    EXPECT_DOUBLE_EQ(engine_.realized_pl(), 1000.0 - 200.0);
+    EXPECT_EQ(engine_.snapshot().open_positions, 1u);
+    EXPECT_EQ(engine_.symbols(), std::vector<std::string>{"AAPL"});
+}
+
+TEST_F(PortfolioEngineTest, FillThroughZeroFlipsSide) {
+    engine_.apply_fill("TSLA", OrderSide::Buy, 10, 200.0);
+    engine_.apply_fill("TSLA", OrderSide::SellShort, 15, 210.0);
+
+    auto tsla = engine_.position("TSLA");
+    ASSERT_TRUE(tsla.has_value());
+    EXPECT_DOUBLE_EQ(tsla->quantity, -5.0);
+    EXPECT_DOUBLE_EQ(tsla->avg_cost, 210.0);
+    EXPECT_DOUBLE_EQ(tsla->realized_pl, 100.0);
+
+    engine_.mark("TSLA", 200.0);
+    auto snapshot = engine_.snapshot();
+    EXPECT_DOUBLE_EQ(snapshot.short_market_value, -1000.0);
+    EXPECT_DOUBLE_EQ(snapshot.unrealized_pl, 50.0);
+}
+
+TEST_F(PortfolioEngineTest, TrackerFillsFlowIntoEngine) {
+    OrderTracker tracker;
+    engine_.attach(tracker);
+
+    Order order{};
+    order.id = "1";
+    order.symbol = "AAPL";
+    order.side = OrderSide::Buy;
+    order.quantity = 10;
+    order.status = OrderStatus::Open;
+    tracker.seed({order});
+
+    StreamingOrderStatus event;
+    event.order_id = "1";
+    event.status = "filled";
+    event.symbol = "AAPL";
+    event.quantity = 10;
+    event.filled_quantity = 10;
+    event.avg_fill_price = 150.0;
+    event.timestamp = std::chrono::system_clock::now();
+    tracker.apply(event);
+
+    auto aapl = engine_.position("AAPL");
+    ASSERT_TRUE(aapl.has_value());
+    EXPECT_DOUBLE_EQ(aapl->quantity, 10.0);
+    EXPECT_DOUBLE_EQ(aapl->avg_cost, 150.0);
+}
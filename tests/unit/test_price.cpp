@@ -0,0 +1,123 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <limits>
+#include "oqdTradierpp/core/json_builder.hpp"
+#include "oqdTradierpp/core/price.hpp"
+#include "oqdTradierpp/validation.hpp"
+
+using namespace oqd;
+
+class PriceTest : public ::testing::Test {
+protected:
+    static Price parsed(std::string_view text) {
+        auto price = Price::parse(text);
+        EXPECT_TRUE(price.has_value()) << text;
+        return price.value_or(Price{});
+    }
+};
+
+TEST_F(PriceTest, ParsesDecimalText) {
+    EXPECT_EQ(parsed("150").ticks(), 1500000);
+    EXPECT_EQ(parsed("150.25").ticks(), 1502500);
+    EXPECT_EQ(parsed("-0.05").ticks(), -500);
+    EXPECT_EQ(parsed("0.0001").ticks(), 1);
+    EXPECT_EQ(parsed(".5").ticks(), 5000);
+    // Past the fourth decimal, halves round away from zero.
+    EXPECT_EQ(parsed("1.23455").ticks(), 12346);
+    EXPECT_EQ(parsed("1.234549").ticks(), 12345);
+    EXPECT_EQ(parsed("-1.23455").ticks(), -12346);
+
+    for (std::string_view bad : {"", "-", ".", "1e3", "1.2.3", "abc", " 1", "1 ", "99999999999999999"}) {
+        EXPECT_FALSE(Price::parse(bad).has_value()) << bad;
+    }
+    static_assert(Price::parse("2.5")->ticks() == 25000);
+}
+
+TEST_F(PriceTest, ReadsJsonNumbersAndStrings) {
+    simdjson::dom::parser parser;
+    auto doc = parser.parse(std::string(R"({"a":187.42,"b":3,"c":"0.0125","d":true,"e":1e300})"));
+    EXPECT_EQ(Price::from_json(doc["a"].value())->ticks(), 1874200);
+    EXPECT_EQ(Price::from_json(doc["b"].value())->ticks(), 30000);
+    EXPECT_EQ(Price::from_json(doc["c"].value())->ticks(), 125);
+    EXPECT_FALSE(Price::from_json(doc["d"].value()).has_value());
+    EXPECT_FALSE(Price::from_json(doc["e"].value()).has_value());
+    // Every cent survives a trip through double.
+    for (std::int64_t cents = -100000; cents <= 100000; ++cents) {
+        ASSERT_EQ(Price::from_double(Price::from_cents(cents).to_double()), Price::from_cents(cents));
+    }
+}
+
+TEST_F(PriceTest, FormatsTwoToFourDecimals) {
+    EXPECT_EQ(parsed("150").to_string(), "150.00");
+    EXPECT_EQ(parsed("0.05").to_string(), "0.05");
+    EXPECT_EQ(parsed("1.2").to_string(), "1.20");
+    EXPECT_EQ(parsed("1.234").to_string(), "1.234");
+    EXPECT_EQ(parsed("1.2345").to_string(), "1.2345");
+    EXPECT_EQ(parsed("-0.0001").to_string(), "-0.0001");
+    EXPECT_EQ(Price::from_ticks(std::numeric_limits<std::int64_t>::min()).to_string(), "-922337203685477.5808");
+
+    std::array<char, 3> small;
+    EXPECT_EQ(parsed("1.25").to_chars(small.data(), small.data() + small.size()).ec, std::errc::value_too_large);
+
+    auto json = json::create_object().field("limit", parsed("12.5")).end_object().str();
+    EXPECT_EQ(json, "{\"limit\":12.50}");
+}
+
+TEST_F(PriceTest, RoundsToTickGrid) {
+    const Price nickel = Price::from_cents(5);
+    EXPECT_EQ(parsed("3.12").round_down(nickel), parsed("3.10"));
+    EXPECT_EQ(parsed("3.12").round_up(nickel), parsed("3.15"));
+    EXPECT_EQ(parsed("3.12").round_nearest(nickel), parsed("3.10"));
+    EXPECT_EQ(parsed("3.125").round_nearest(nickel), parsed("3.15"));
+    EXPECT_EQ(parsed("-3.12").round_down(nickel), parsed("-3.15"));
+    EXPECT_EQ(parsed("-3.12").round_up(nickel), parsed("-3.10"));
+    EXPECT_EQ(parsed("-3.125").round_nearest(nickel), parsed("-3.15"));
+    EXPECT_EQ(parsed("3.15").round_up(nickel), parsed("3.15"));
+    EXPECT_TRUE(parsed("3.15").is_multiple_of(nickel));
+    EXPECT_FALSE(parsed("3.16").is_multiple_of(nickel));
+
+    // Odd ticks have no exact halves.
+    const Price odd = Price::from_ticks(5);
+    EXPECT_EQ(Price::from_ticks(2).round_nearest(odd).ticks(), 0);
+    EXPECT_EQ(Price::from_ticks(3).round_nearest(odd).ticks(), 5);
+}
+
+TEST_F(PriceTest, RepresentableDoubles) {
+    EXPECT_TRUE(Price::representable(150.25));
+    EXPECT_TRUE(Price::representable(-0.05));
+    EXPECT_TRUE(Price::representable(static_cast<double>(Price::max_units)));
+    EXPECT_FALSE(Price::representable(std::numeric_limits<double>::quiet_NaN()));
+    EXPECT_FALSE(Price::representable(std::numeric_limits<double>::infinity()));
+    EXPECT_FALSE(Price::representable(-std::numeric_limits<double>::infinity()));
+    EXPECT_FALSE(Price::representable(1e300));
+}
+
+TEST_F(PriceTest, Arithmetic) {
+    EXPECT_EQ(parsed("0.10") + parsed("0.20"), parsed("0.30"));
+    EXPECT_EQ(parsed("1.05") * 100, parsed("105"));
+    EXPECT_EQ(-parsed("1.05"), parsed("-1.05"));
+    EXPECT_LT(parsed("0.9999"), parsed("1"));
+}
+
+TEST_F(PriceTest, ValidatesIncrementsExactly) {
+    EXPECT_TRUE(OrderValidator::is_valid_price_increment(parsed("150.25"), "SPY"));
+    EXPECT_FALSE(OrderValidator::is_valid_price_increment(parsed("150.255"), "SPY"));
+    EXPECT_TRUE(OrderValidator::is_valid_price_increment(parsed("0.1234"), "PENNY"));
+    EXPECT_TRUE(OrderValidator::is_valid_price_increment(parsed("2.99"), "SPY250117C00500000"));
+    EXPECT_FALSE(OrderValidator::is_valid_price_increment(parsed("3.01"), "SPY250117C00500000"));
+    EXPECT_TRUE(OrderValidator::is_valid_price_increment(parsed("3.05"), "SPY250117C00500000"));
+    EXPECT_FALSE(OrderValidator::is_valid_price_increment(Price{}, "SPY"));
+    EXPECT_EQ(OrderValidator::tick_size(parsed("3.00"), "SPY250117C00500000"), Price::from_cents(5));
+}
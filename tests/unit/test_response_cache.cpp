@@ -0,0 +1,174 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "oqdTradierpp/endpoints.hpp"
+#include "oqdTradierpp/response_cache.hpp"
+
+using namespace oqd;
+
+class ResponseCacheTest : public ::testing::Test {
+protected:
+    // Mimics TradierClient::request_then: the worker "decodes", publishes and
+    // then hands the value to the future.
+    auto loader(int value, std::chrono::milliseconds latency = std::chrono::milliseconds(0), bool fail = false) {
+        return [this, value, latency, fail](auto publish) {
+            ++loads_;
+            return std::async(std::launch::async, [value, latency, fail, publish = std::move(publish)]() {
+                std::this_thread::sleep_for(latency);
+                if (fail) {
+                    throw std::runtime_error("HTTP error: 503");
+                }
+                std::vector<int> decoded{value, value + 1};
+                publish(decoded);
+                return decoded;
+            });
+        };
+    }
+
+    std::atomic<int> loads_{0};
+};
+
+TEST_F(ResponseCacheTest, KeysAreCanonical) {
+    std::unordered_map<std::string, std::string> a{{"symbol", "SPY"}, {"expiration", "2025-07-18"}};
+    std::unordered_map<std::string, std::string> b{{"expiration", "2025-07-18"}, {"symbol", "SPY"}};
+    EXPECT_EQ(ResponseCache::make_key("/v1/markets/options/strikes", a),
+              ResponseCache::make_key("/v1/markets/options/strikes", b));
+    EXPECT_EQ(ResponseCache::make_key("/v1/markets/options/strikes", a),
+              "/v1/markets/options/strikes?expiration=2025-07-18&symbol=SPY");
+    EXPECT_EQ(ResponseCache::make_key("/v1/markets/clock", {}), "/v1/markets/clock?");
+    EXPECT_EQ(ResponseCache::make_key("/v1/markets/lookup", {{"q", "a&b"}}), "/v1/markets/lookup?q=a%26b");
+}
+
+TEST_F(ResponseCacheTest, KeysSeparateEnvironments) {
+    ResponseCache cache;
+    std::unordered_map<std::string, std::string> params{{"symbol", "SPY"}};
+    auto production = ResponseCache::make_key("/v1/markets/options/strikes", params, "https://api.tradier.com");
+    auto sandbox = ResponseCache::make_key("/v1/markets/options/strikes", params, "https://sandbox.tradier.com");
+    EXPECT_NE(production, sandbox);
+
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>(production, std::chrono::seconds(60), loader(1)).get()[0], 1);
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>(sandbox, std::chrono::seconds(60), loader(2)).get()[0], 2);
+    EXPECT_EQ(loads_.load(), 2);
+
+    cache.invalidate_path("/v1/markets/options/strikes");
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST_F(ResponseCacheTest, HitsServeDecodedValueUntilExpiry) {
+    ResponseCache cache;
+    auto ttl = std::chrono::milliseconds(50);
+
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>("k", ttl, loader(1)).get(), (std::vector<int>{1, 2}));
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>("k", ttl, loader(2)).get(), (std::vector<int>{1, 2}));
+    EXPECT_EQ(loads_.load(), 1);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>("k", ttl, loader(3)).get(), (std::vector<int>{3, 4}));
+    EXPECT_EQ(loads_.load(), 2);
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST_F(ResponseCacheTest, ConcurrentMissesShareOneRequest) {
+    ResponseCache cache;
+    std::vector<std::future<std::vector<int>>> waiters;
+    for (int i = 0; i < 16; ++i) {
+        waiters.push_back(cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60),
+                                                              loader(i, std::chrono::milliseconds(20))));
+    }
+    for (auto& waiter : waiters) {
+        EXPECT_EQ(waiter.get(), (std::vector<int>{0, 1}));
+    }
+    EXPECT_EQ(loads_.load(), 1);
+    EXPECT_EQ(cache.stats().coalesced, 15u);
+}
+
+TEST_F(ResponseCacheTest, FailuresAreSharedButNotCached) {
+    ResponseCache cache;
+    auto leader = cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60),
+                                                      loader(1, std::chrono::milliseconds(20), true));
+    auto follower = cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60), loader(2));
+    EXPECT_THROW(leader.get(), std::runtime_error);
+    EXPECT_THROW(follower.get(), std::runtime_error);
+
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60), loader(5)).get(),
+              (std::vector<int>{5, 6}));
+    EXPECT_EQ(loads_.load(), 2);
+
+    auto throwing = [](auto) -> std::future<std::vector<int>> { throw std::runtime_error("rate limited"); };
+    EXPECT_THROW(cache.get_or_load<std::vector<int>>("other", std::chrono::seconds(60), throwing), std::runtime_error);
+    EXPECT_EQ(cache.stats().entries, 1u);
+}
+
+TEST_F(ResponseCacheTest, InvalidationAndEviction) {
+    ResponseCache cache(2);
+    auto ttl = std::chrono::seconds(60);
+    auto strikes = ResponseCache::make_key("/v1/markets/options/strikes", {{"symbol", "SPY"}});
+    auto expirations = ResponseCache::make_key("/v1/markets/options/expirations", {{"symbol", "SPY"}});
+    cache.get_or_load<std::vector<int>>(strikes, ttl, loader(1)).get();
+    cache.get_or_load<std::vector<int>>(expirations, ttl, loader(2)).get();
+
+    cache.invalidate_path("/v1/markets/options/strikes");
+    EXPECT_EQ(cache.stats().entries, 1u);
+
+    cache.get_or_load<std::vector<int>>("a", ttl, loader(3)).get();
+    cache.get_or_load<std::vector<int>>("b", ttl, loader(4)).get();
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_EQ(stats.evictions, 1u);
+
+    cache.clear();
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST_F(ResponseCacheTest, SlowChangingEndpointsHaveTtl) {
+    EXPECT_GT(endpoints::markets::clock.cache_ttl_seconds, 0);
+    EXPECT_GT(endpoints::markets::calendar.cache_ttl_seconds, 0);
+    EXPECT_GT(endpoints::markets::options::strikes.cache_ttl_seconds, 0);
+    EXPECT_GT(endpoints::beta::fundamentals::company.cache_ttl_seconds, 0);
+    EXPECT_EQ(endpoints::markets::quotes.cache_ttl_seconds, 0);
+    EXPECT_EQ(endpoints::markets::options::chains.cache_ttl_seconds, 0);
+}
+
+TEST_F(ResponseCacheTest, FundamentalsEndpointsDoNotShareKeys) {
+    // Each decoder caches its own type; two getters on one path would evict
+    // each other's entries with a type mismatch.
+    std::unordered_map<std::string, std::string> params{{"symbols", "AAPL"}};
+    EXPECT_NE(ResponseCache::make_key(endpoints::beta::fundamentals::corporate_actions.path, params),
+              ResponseCache::make_key(endpoints::beta::fundamentals::corporate_calendar.path, params));
+}
+
+TEST_F(ResponseCacheTest, DeferredLoadsAreNotJoined) {
+    // A load that joined a client-side in-flight GET returns a deferred future;
+    // a failure there must not pin the key.
+    ResponseCache cache;
+    auto deferred_failure = [this](auto) {
+        ++loads_;
+        return std::async(std::launch::deferred, []() -> std::vector<int> { throw std::runtime_error("HTTP error: 500"); });
+    };
+    auto first = cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60), deferred_failure);
+    EXPECT_THROW(first.get(), std::runtime_error);
+
+    EXPECT_EQ(cache.get_or_load<std::vector<int>>("k", std::chrono::seconds(60), loader(7)).get(),
+              (std::vector<int>{7, 8}));
+    EXPECT_EQ(loads_.load(), 2);
+}
@@ -0,0 +1,218 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "oqdTradierpp/trading/risk_engine.hpp"
+#include "oqdTradierpp/validation.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class RiskEngineTest : public ::testing::Test {
+protected:
+    static RiskOrder order(std::uint32_t symbol, OrderSide side, double quantity, double limit = 0.0) {
+        return RiskOrder{symbol, side, quantity, limit};
+    }
+
+    static SpreadLeg leg(const std::string& symbol, OrderSide side, int quantity = 1) {
+        SpreadLeg spread_leg{};
+        spread_leg.option_symbol = symbol;
+        spread_leg.side = side;
+        spread_leg.quantity = quantity;
+        return spread_leg;
+    }
+
+    PreTradeRiskEngine::Clock::time_point t0_ = PreTradeRiskEngine::Clock::now();
+};
+
+TEST_F(RiskEngineTest, RejectsInvalidOrdersAndMissingReference) {
+    PreTradeRiskEngine engine;
+    auto spy = engine.symbol_id("SPY");
+    EXPECT_EQ(engine.symbol_id("SPY"), spy);
+    EXPECT_EQ(engine.check(order(spy + 1, OrderSide::Buy, 1, 10.0)).verdict, RiskVerdict::InvalidOrder);
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 0, 10.0)).verdict, RiskVerdict::InvalidOrder);
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, NAN, 10.0)).verdict, RiskVerdict::InvalidOrder);
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 1)).verdict, RiskVerdict::NoReferencePrice);
+    engine.set_last_price(spy, 450.0);
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 1)).accepted());
+    EXPECT_EQ(to_string(RiskVerdict::PriceBand), "price_band");
+}
+
+TEST_F(RiskEngineTest, PriceBandAgainstLastQuote) {
+    PreTradeRiskEngine engine({.price_band = 0.05});
+    auto spy = engine.symbol_id("SPY");
+    StreamingQuote quote{};
+    quote.symbol = "SPY";
+    quote.bid = 99.0;
+    quote.ask = 101.0;
+    ASSERT_TRUE(engine.on_quote(quote));   // midpoint without a last trade
+
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 1, 104.0)).accepted());
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 1, 106.0)).verdict, RiskVerdict::PriceBand);
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Sell, 1, 10.0)).verdict, RiskVerdict::PriceBand);
+    quote.symbol = "QQQ";
+    EXPECT_FALSE(engine.on_quote(quote));
+}
+
+TEST_F(RiskEngineTest, NotionalLimitsUseContractMultiplier) {
+    PreTradeRiskEngine engine({.max_order_notional = 10000.0, .max_open_notional = 15000.0});
+    auto call = engine.symbol_id("SPY250117C00500000");
+    auto decision = engine.check(order(call, OrderSide::BuyToOpen, 10, 9.0));
+    ASSERT_TRUE(decision.accepted());
+    EXPECT_DOUBLE_EQ(decision.notional, 9000.0);
+    EXPECT_EQ(engine.check(order(call, OrderSide::BuyToOpen, 11, 10.0)).verdict, RiskVerdict::OrderNotional);
+    EXPECT_EQ(engine.check(order(call, OrderSide::BuyToOpen, 7, 9.0)).verdict, RiskVerdict::OpenNotional);
+
+    engine.release(order(call, OrderSide::BuyToOpen, 10, 9.0), decision, 10);
+    EXPECT_DOUBLE_EQ(engine.open_notional(), 0.0);
+    EXPECT_DOUBLE_EQ(engine.pending(call), 0.0);
+    EXPECT_TRUE(engine.check(order(call, OrderSide::BuyToOpen, 7, 9.0)).accepted());
+}
+
+TEST_F(RiskEngineTest, PositionLimitCountsHeldAndPending) {
+    PreTradeRiskEngine engine({.max_position = 1000.0});
+    auto aapl = engine.symbol_id("AAPL");
+    auto msft = engine.symbol_id("MSFT");
+    engine.seed({Position{0.0, "", "1", 600.0, "AAPL"}});
+    engine.set_position_limit(msft, 50.0);
+
+    EXPECT_TRUE(engine.check(order(aapl, OrderSide::Buy, 300, 190.0)).accepted());
+    EXPECT_EQ(engine.check(order(aapl, OrderSide::Buy, 200, 190.0)).verdict, RiskVerdict::PositionLimit);
+    EXPECT_DOUBLE_EQ(engine.pending(aapl), 300.0);
+
+    engine.apply_fill(aapl, OrderSide::Buy, 300);
+    EXPECT_DOUBLE_EQ(engine.position(aapl), 900.0);
+    EXPECT_DOUBLE_EQ(engine.pending(aapl), 0.0);
+
+    // Reducing orders pass even while over the limit.
+    engine.set_position(aapl, 1500.0);
+    EXPECT_TRUE(engine.check(order(aapl, OrderSide::Sell, 100, 190.0)).accepted());
+    EXPECT_EQ(engine.check(order(aapl, OrderSide::Sell, 3000, 190.0)).verdict, RiskVerdict::PositionLimit);
+    EXPECT_EQ(engine.check(order(msft, OrderSide::SellShort, 60, 400.0)).verdict, RiskVerdict::PositionLimit);
+}
+
+TEST_F(RiskEngineTest, RestingSellDoesNotMakeRoomForBuys) {
+    PreTradeRiskEngine engine({.max_position = 100.0});
+    auto spy = engine.symbol_id("SPY");
+    RiskOrder sell = order(spy, OrderSide::Sell, 100, 450.0);
+    auto sell_decision = engine.check(sell);
+    ASSERT_TRUE(sell_decision.accepted());
+    EXPECT_DOUBLE_EQ(engine.pending(spy), -100.0);
+
+    // Netted against the sell this buy would look flat; if the sell is
+    // canceled, the filled buy alone is over the limit.
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 150, 450.0)).verdict, RiskVerdict::PositionLimit);
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 100, 450.0)).accepted());
+    EXPECT_DOUBLE_EQ(engine.pending(spy), 0.0);
+
+    engine.release(sell, sell_decision, 100);
+    EXPECT_DOUBLE_EQ(engine.pending(spy), 100.0);
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 1, 450.0)).verdict, RiskVerdict::PositionLimit);
+}
+
+TEST_F(RiskEngineTest, OrderRateIsATokenBucket) {
+    PreTradeRiskEngine engine({.max_orders_per_second = 2.0});
+    auto spy = engine.symbol_id("SPY");
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 1, 10.0), t0_).accepted());
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 1, 10.0), t0_).accepted());
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 1, 10.0), t0_).verdict, RiskVerdict::OrderRate);
+    // Rejections for other reasons spend no budget.
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 0, 10.0), t0_ + milliseconds(500)).verdict, RiskVerdict::InvalidOrder);
+    EXPECT_TRUE(engine.check(order(spy, OrderSide::Buy, 1, 10.0), t0_ + milliseconds(500)).accepted());
+    EXPECT_EQ(engine.check(order(spy, OrderSide::Buy, 1, 10.0), t0_ + milliseconds(500)).verdict, RiskVerdict::OrderRate);
+}
+
+TEST_F(RiskEngineTest, BatchSeesEarlierReservations) {
+    PreTradeRiskEngine engine({.max_open_notional = 2500.0});
+    auto spy = engine.symbol_id("SPY");
+    std::vector<RiskOrder> orders(4, order(spy, OrderSide::Buy, 10, 100.0));
+    orders[2].limit_price = 0.0;   // market, no last price yet
+    std::vector<RiskDecision> decisions(orders.size());
+    EXPECT_EQ(engine.check_batch(orders, decisions, t0_), 2u);
+    EXPECT_TRUE(decisions[0].accepted());
+    EXPECT_TRUE(decisions[1].accepted());
+    EXPECT_EQ(decisions[2].verdict, RiskVerdict::NoReferencePrice);
+    EXPECT_EQ(decisions[3].verdict, RiskVerdict::OpenNotional);
+}
+
+TEST_F(RiskEngineTest, ChecksOrderRequestsByName) {
+    PreTradeRiskEngine engine({.max_position = 5.0});
+    OptionOrderRequest option;
+    option.symbol = "SPY";
+    option.option_symbol = "SPY250117P00450000";
+    option.side = OrderSide::SellToOpen;
+    option.quantity = 6;
+    option.type = OrderType::Limit;
+    option.price = 2.5;
+    EXPECT_EQ(engine.check(option).verdict, RiskVerdict::PositionLimit);
+    option.quantity = 5;
+    EXPECT_TRUE(engine.check(option).accepted());
+    EXPECT_DOUBLE_EQ(engine.pending(*engine.find_symbol("SPY250117P00450000")), -5.0);
+    EXPECT_FALSE(engine.find_symbol("SPY").has_value());
+
+    EquityOrderRequest limit_without_price;
+    limit_without_price.symbol = "SPY";
+    limit_without_price.quantity = 1;
+    limit_without_price.type = OrderType::Limit;
+    EXPECT_EQ(engine.check(limit_without_price).verdict, RiskVerdict::InvalidOrder);
+}
+
+TEST_F(RiskEngineTest, AnalyzesVerticalAndNakedSpreads) {
+    SpreadOrderRequest vertical{};
+    vertical.type = OrderType::Limit;
+    vertical.price = 2.0;
+    vertical.spread_type = "vertical_call_bull";
+    vertical.legs = {leg("SPY250117C00500000", OrderSide::BuyToOpen), leg("SPY250117C00505000", OrderSide::SellToOpen)};
+    auto analysis = RiskAnalyzer::analyze_spread_order(vertical);
+    EXPECT_DOUBLE_EQ(analysis.max_loss, 200.0);
+    EXPECT_DOUBLE_EQ(analysis.max_profit, 300.0);
+    EXPECT_DOUBLE_EQ(analysis.risk_reward_ratio, 1.5);
+    EXPECT_DOUBLE_EQ(analysis.breakeven_price, 502.0);
+    EXPECT_TRUE(analysis.risk_warnings.empty());
+
+    SpreadOrderRequest naked{};
+    naked.type = OrderType::Limit;
+    naked.price = -1.0;   // credit
+    naked.legs = {leg("SPY250117C00500000", OrderSide::SellToOpen)};
+    analysis = RiskAnalyzer::analyze_spread_order(naked);
+    EXPECT_TRUE(std::isinf(analysis.max_loss));
+    EXPECT_DOUBLE_EQ(analysis.max_profit, 100.0);
+    EXPECT_DOUBLE_EQ(analysis.breakeven_price, 501.0);
+    EXPECT_FALSE(analysis.risk_warnings.empty());
+}
+
+TEST_F(RiskEngineTest, AnalyzesBracketsAndSizing) {
+    OTOCOOrderRequest bracket{};
+    bracket.primary_order = {"AAPL", OrderSide::Buy, 100, OrderType::Limit, OrderDuration::Day, 100.0, std::nullopt, std::nullopt, std::nullopt};
+    bracket.profit_order = {"AAPL", OrderSide::Sell, 100, OrderType::Limit, OrderDuration::GTC, 104.0, std::nullopt, std::nullopt, std::nullopt};
+    bracket.stop_order = {"AAPL", OrderSide::Sell, 100, OrderType::Stop, OrderDuration::GTC, std::nullopt, 98.0, std::nullopt, std::nullopt};
+    auto analysis = RiskAnalyzer::analyze_otoco_order(bracket);
+    EXPECT_DOUBLE_EQ(analysis.max_loss, 200.0);
+    EXPECT_DOUBLE_EQ(analysis.max_profit, 400.0);
+    EXPECT_DOUBLE_EQ(analysis.risk_reward_ratio, 2.0);
+
+    EXPECT_DOUBLE_EQ(RiskAnalyzer::calculate_position_size_by_risk(100000.0, 1.0, 50.0, 48.0), 500.0);
+    EXPECT_DOUBLE_EQ(RiskAnalyzer::calculate_position_size_by_risk(100000.0, 1.0, 50.0, 50.0), 0.0);
+
+    EquityOrderRequest equity;
+    equity.symbol = "AAPL";
+    equity.quantity = 100;
+    equity.price = 100.0;
+    EXPECT_FALSE(RiskAnalyzer::exceeds_position_limit(equity, 10.0, 200000.0, 5000.0));
+    EXPECT_TRUE(RiskAnalyzer::exceeds_position_limit(equity, 10.0, 200000.0, 15000.0));
+    equity.type = OrderType::Market;
+    equity.price.reset();
+    EXPECT_TRUE(RiskAnalyzer::exceeds_position_limit(equity, 10.0, 200000.0, 0.0));
+    EXPECT_EQ(RiskAnalyzer::identify_risk_factors(equity).size(), 1u);
+}
@@ -0,0 +1,138 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "oqdTradierpp/single_flight.hpp"
+#include "oqdTradierpp/utils.hpp"
+
+using namespace oqd;
+
+class SingleFlightTest : public ::testing::Test {
+protected:
+    SingleFlight<std::shared_ptr<const std::string>> flight_;
+};
+
+TEST_F(SingleFlightTest, FollowersShareTheLeaderResult) {
+    auto leader = flight_.join("GET /v1/markets/quotes?symbols=SPY");
+    auto follower = flight_.join("GET /v1/markets/quotes?symbols=SPY");
+    auto other = flight_.join("GET /v1/markets/quotes?symbols=QQQ");
+    ASSERT_TRUE(leader.leader());
+    EXPECT_FALSE(follower.leader());
+    EXPECT_TRUE(other.leader());
+    EXPECT_EQ(flight_.in_flight(), 2u);
+
+    flight_.complete(leader, std::make_shared<const std::string>("body"));
+    EXPECT_EQ(follower.result().get().get(), leader.result().get().get());
+    EXPECT_EQ(*follower.result().get(), "body");
+
+    // Completion releases the key, so a later call is sent again.
+    EXPECT_TRUE(flight_.join("GET /v1/markets/quotes?symbols=SPY").leader());
+}
+
+TEST_F(SingleFlightTest, FailuresReachEveryWaiter) {
+    auto leader = flight_.join("k");
+    auto follower = flight_.join("k");
+    flight_.fail(leader, std::make_exception_ptr(std::runtime_error("HTTP error: 502")));
+
+    EXPECT_THROW(follower.result().get(), std::runtime_error);
+    EXPECT_EQ(flight_.in_flight(), 0u);
+    EXPECT_TRUE(flight_.join("k").leader());
+}
+
+TEST_F(SingleFlightTest, ThenRunsWhenTheLeaderFinishes) {
+    auto leader = flight_.join("k");
+    auto follower = flight_.join("k");
+    std::vector<std::string> seen;
+    flight_.then(follower, [&seen](const auto& result) { seen.push_back(*result.get()); });
+    EXPECT_TRUE(seen.empty());
+
+    flight_.complete(leader, std::make_shared<const std::string>("body"));
+    ASSERT_EQ(seen.size(), 1u);
+    EXPECT_EQ(seen[0], "body");
+
+    // Registering after the leader finished runs the callback immediately.
+    flight_.then(follower, [&seen](const auto& result) { seen.push_back(*result.get()); });
+    EXPECT_EQ(seen.size(), 2u);
+
+    auto failing = flight_.join("k");
+    auto waiting = flight_.join("k");
+    bool threw = false;
+    flight_.then(waiting, [&threw](const auto& result) {
+        try {
+            result.get();
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+    });
+    flight_.fail(failing, std::make_exception_ptr(std::runtime_error("HTTP error: 502")));
+    EXPECT_TRUE(threw);
+}
+
+TEST_F(SingleFlightTest, ConcurrentCallersElectOneLeader) {
+    constexpr int threads = 30;
+    std::atomic<int> leaders{0};
+    std::atomic<int> ready{0};
+    std::vector<std::thread> workers;
+    std::vector<std::string> seen(threads);
+
+    for (int i = 0; i < threads; ++i) {
+        workers.emplace_back([&, i]() {
+            ++ready;
+            while (ready.load() < threads) {
+            }
+            auto ticket = flight_.join("GET /v1/accounts/VA000001/balances?");
+            if (ticket.leader()) {
+                ++leaders;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                flight_.complete(ticket, std::make_shared<const std::string>("balances"));
+            }
+            seen[i] = *ticket.result().get();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_GE(leaders.load(), 1);
+    EXPECT_LT(leaders.load(), threads);
+    for (const auto& value : seen) {
+        EXPECT_EQ(value, "balances");
+    }
+}
+
+TEST_F(SingleFlightTest, CanonicalKeysIgnoreParameterOrder) {
+    std::unordered_map<std::string, std::string> a{{"symbols", "SPY"}, {"greeks", "true"}};
+    std::unordered_map<std::string, std::string> b{{"greeks", "true"}, {"symbols", "SPY"}};
+    EXPECT_EQ(utils::canonical_request_key("/v1/markets/quotes", a), "/v1/markets/quotes?greeks=true&symbols=SPY");
+    EXPECT_EQ(utils::canonical_request_key("/v1/markets/quotes", a), utils::canonical_request_key("/v1/markets/quotes", b));
+}
+
+TEST_F(SingleFlightTest, CanonicalKeysEscapeSeparators) {
+    std::unordered_map<std::string, std::string> joined{{"symbols", "SPY&greeks=true"}};
+    std::unordered_map<std::string, std::string> split{{"symbols", "SPY"}, {"greeks", "true"}};
+    EXPECT_NE(utils::canonical_request_key("/v1/markets/quotes", joined),
+              utils::canonical_request_key("/v1/markets/quotes", split));
+    EXPECT_EQ(utils::canonical_request_key("/v1/markets/quotes", joined), "/v1/markets/quotes?symbols=SPY%26greeks%3Dtrue");
+
+    std::unordered_map<std::string, std::string> key_with_equals{{"a=b", "c"}};
+    std::unordered_map<std::string, std::string> value_with_equals{{"a", "b=c"}};
+    EXPECT_NE(utils::canonical_request_key("/v1/markets/quotes", key_with_equals),
+              utils::canonical_request_key("/v1/markets/quotes", value_with_equals));
+
+    EXPECT_NE(utils::canonical_request_key("/v1/markets/quotes", split, "https://api.tradier.com"),
+              utils::canonical_request_key("/v1/markets/quotes", split, "https://sandbox.tradier.com"));
+}
@@ -0,0 +1,236 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "oqdTradierpp/trading/spread_analytics.hpp"
+#include "oqdTradierpp/validation.hpp"
+
+using namespace oqd;
+using namespace std::chrono;
+
+class SpreadAnalyticsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        params_.spot = 455.0;
+        params_.volatility = 0.20;
+        params_.now = sys_days{2024y / January / 2} + hours{20};
+    }
+
+    static SpreadLeg leg(std::string symbol, OrderSide side, int quantity = 1) {
+        return SpreadLeg{std::move(symbol), side, quantity, std::nullopt};
+    }
+
+    static SpreadOrderRequest spread(std::vector<SpreadLeg> legs, double price) {
+        SpreadOrderRequest order{};
+        order.type = OrderType::Limit;
+        order.duration = OrderDuration::Day;
+        order.price = price;
+        order.legs = std::move(legs);
+        return order;
+    }
+
+    static SpreadOrderRequest bull_call() {
+        return spread({leg("SPY240119C00450000", OrderSide::BuyToOpen),
+                       leg("SPY240119C00460000", OrderSide::SellToOpen)}, 4.0);
+    }
+
+    static SpreadOrderRequest iron_condor(double short_put = 440.0, double short_call = 470.0) {
+        auto put = [](double strike) { return "SPY240119P00" + std::to_string(static_cast<int>(strike)) + "000"; };
+        auto call = [](double strike) { return "SPY240119C00" + std::to_string(static_cast<int>(strike)) + "000"; };
+        return spread({leg(put(short_put - 10.0), OrderSide::BuyToOpen), leg(put(short_put), OrderSide::SellToOpen),
+                       leg(call(short_call), OrderSide::SellToOpen), leg(call(short_call + 10.0), OrderSide::BuyToOpen)},
+                      -2.5);
+    }
+
+    // Lognormal P(S_T > x) with zero carry, as the analytics assume.
+    double probability_above(double x, double years) const {
+        double vol_sqrt_t = params_.volatility * std::sqrt(years);
+        double z = (std::log(x / params_.spot) + 0.5 * vol_sqrt_t * vol_sqrt_t) / vol_sqrt_t;
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+    }
+
+    SpreadAnalyticsParams params_;
+};
+
+TEST_F(SpreadAnalyticsTest, VerticalExtremesAndOdds) {
+    auto analysis = analyze_spread(bull_call(), params_);
+    ASSERT_TRUE(analysis.ok()) << analysis.error;
+    EXPECT_EQ(analysis.strategy, SpreadStrategy::Vertical);
+    EXPECT_DOUBLE_EQ(analysis.net_premium, -400.0);
+    EXPECT_NEAR(analysis.max_profit, 600.0, 1e-9);
+    EXPECT_NEAR(analysis.max_loss, 400.0, 1e-9);
+    ASSERT_EQ(analysis.breakevens.size(), 1u);
+    EXPECT_NEAR(analysis.breakevens[0], 454.0, 1e-9);
+
+    // Expiry is 17 days out at the 20:00 UTC close.
+    double years = 17.0 / 365.0;
+    EXPECT_NEAR(analysis.probability_of_profit, probability_above(454.0, years), 1e-4);
+    EXPECT_NEAR(analysis.probability_of_max_profit, probability_above(460.0, years), 1e-4);
+    EXPECT_NEAR(analysis.probability_of_max_loss, 1.0 - probability_above(450.0, years), 1e-4);
+    EXPECT_GT(analysis.probability_of_profit, analysis.probability_of_max_profit);
+
+    EXPECT_GT(analysis.delta, 0.0);
+    EXPECT_LT(analysis.delta, 100.0);
+    EXPECT_NEAR(analysis.expiry_pnl.front(), -400.0, 1e-6);
+    EXPECT_NEAR(analysis.expiry_pnl.back(), 600.0, 1e-6);
+}
+
+TEST_F(SpreadAnalyticsTest, ClassifiesFromLegs) {
+    EXPECT_EQ(classify_spread(iron_condor()), SpreadStrategy::IronCondor);
+    EXPECT_EQ(classify_spread(iron_condor(450.0, 450.0)), SpreadStrategy::IronButterfly);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00450000", OrderSide::Buy)}, 5.0)), SpreadStrategy::Single);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00450000", OrderSide::BuyToOpen),
+                                      leg("SPY240119P00450000", OrderSide::BuyToOpen)}, 9.0)),
+              SpreadStrategy::Straddle);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119P00440000", OrderSide::SellToOpen),
+                                      leg("SPY240119C00470000", OrderSide::SellToOpen)}, -3.0)),
+              SpreadStrategy::Strangle);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00450000", OrderSide::BuyToOpen),
+                                      leg("SPY240119C00460000", OrderSide::SellToOpen, 2)}, 1.0)),
+              SpreadStrategy::Ratio);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00440000", OrderSide::BuyToOpen),
+                                      leg("SPY240119C00450000", OrderSide::SellToOpen, 2),
+                                      leg("SPY240119C00460000", OrderSide::BuyToOpen)}, 2.0)),
+              SpreadStrategy::Butterfly);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00450000", OrderSide::SellToOpen),
+                                      leg("SPY240216C00460000", OrderSide::BuyToOpen)}, 1.0)),
+              SpreadStrategy::Diagonal);
+    EXPECT_EQ(classify_spread(spread({leg("SPY240119C00450000", OrderSide::BuyToOpen),
+                                      leg("SPY240119C00460000", OrderSide::BuyToOpen)}, 9.0)),
+              SpreadStrategy::Custom);
+    EXPECT_EQ(classify_spread(spread({leg("SPY", OrderSide::Buy)}, 1.0)), SpreadStrategy::Invalid);
+    EXPECT_EQ(to_string(SpreadStrategy::IronCondor), "iron_condor");
+
+    EXPECT_EQ(OrderValidator::analyze_spread_strategy(iron_condor()), "iron_condor");
+    EXPECT_NEAR(OrderValidator::calculate_spread_max_profit(iron_condor()), 250.0, 1e-9);
+    EXPECT_NEAR(OrderValidator::calculate_spread_max_loss(iron_condor()), 750.0, 1e-9);
+}
+
+TEST_F(SpreadAnalyticsTest, RiskAnalyzerSharesThePayoffEngine) {
+    // Unexpired legs, so the back month still carries time value at the front expiry.
+    auto calendar = spread({leg("SPY350119C00450000", OrderSide::SellToOpen),
+                            leg("SPY350216C00450000", OrderSide::BuyToOpen)}, 2.0);
+    auto risk = RiskAnalyzer::analyze_spread_order(calendar);
+    EXPECT_EQ(risk.strategy_description, "calendar");
+    EXPECT_TRUE(risk.risk_warnings.empty());
+
+    SpreadAnalyticsParams params;
+    params.spot = 450.0;
+    params.price_range = 1.0;
+    params.vol_points = 1;
+    auto direct = analyze_spread(calendar, params);
+    ASSERT_TRUE(direct.ok()) << direct.error;
+    EXPECT_GT(risk.max_profit, 0.0);
+    EXPECT_NEAR(risk.max_profit, direct.max_profit, 1e-6);
+    EXPECT_NEAR(risk.max_loss, direct.max_loss, 1e-6);
+    EXPECT_NEAR(OrderValidator::calculate_spread_max_profit(calendar), direct.max_profit, 1e-6);
+    EXPECT_NEAR(OrderValidator::calculate_spread_max_loss(calendar), direct.max_loss, 1e-6);
+}
+
+TEST_F(SpreadAnalyticsTest, IronCondorHasTwoBreakevens) {
+    auto analysis = analyze_spread(iron_condor(), params_);
+    EXPECT_NEAR(analysis.max_profit, 250.0, 1e-9);
+    EXPECT_NEAR(analysis.max_loss, 750.0, 1e-9);
+    ASSERT_EQ(analysis.breakevens.size(), 2u);
+    EXPECT_NEAR(analysis.breakevens[0], 437.5, 1e-9);
+    EXPECT_NEAR(analysis.breakevens[1], 472.5, 1e-9);
+
+    double years = 17.0 / 365.0;
+    EXPECT_NEAR(analysis.probability_of_max_profit, probability_above(440.0, years) - probability_above(470.0, years),
+                1e-4);
+    EXPECT_NEAR(analysis.probability_of_max_loss,
+                1.0 - probability_above(430.0, years) + probability_above(480.0, years), 1e-4);
+    EXPECT_LE(analysis.probability_of_profit, 1.0);
+    EXPECT_GE(analysis.probability_of_profit, analysis.probability_of_max_profit);
+    // Short premium: the position earns theta and loses on a vol rise.
+    EXPECT_GT(analysis.theta, 0.0);
+    EXPECT_LT(analysis.vega, 0.0);
+}
+
+TEST_F(SpreadAnalyticsTest, UnboundedAndInvalidSpreads) {
+    auto naked = analyze_spread(spread({leg("SPY240119C00460000", OrderSide::SellToOpen)}, -3.0), params_);
+    EXPECT_EQ(naked.max_loss, std::numeric_limits<double>::infinity());
+    EXPECT_NEAR(naked.max_profit, 300.0, 1e-9);
+    EXPECT_DOUBLE_EQ(naked.probability_of_max_loss, 0.0);
+    ASSERT_EQ(naked.breakevens.size(), 1u);
+    EXPECT_NEAR(naked.breakevens[0], 463.0, 1e-9);
+
+    auto invalid = analyze_spread(spread({leg("SPY240119X00460000", OrderSide::Buy)}, 1.0), params_);
+    EXPECT_FALSE(invalid.ok());
+    EXPECT_FALSE(invalid.error.empty());
+    EXPECT_TRUE(invalid.surface.empty());
+}
+
+TEST_F(SpreadAnalyticsTest, CalendarValuesTheBackMonth) {
+    auto calendar = spread({leg("SPY240119C00450000", OrderSide::SellToOpen),
+                            leg("SPY240216C00450000", OrderSide::BuyToOpen)}, 3.0);
+    auto analysis = analyze_spread(calendar, params_);
+    EXPECT_EQ(analysis.strategy, SpreadStrategy::Calendar);
+    // The long back month caps the loss at the debit and peaks at the strike.
+    EXPECT_LE(analysis.max_loss, 300.0 + 1e-6);
+    EXPECT_GT(analysis.max_profit, 0.0);
+    EXPECT_TRUE(std::isfinite(analysis.max_profit));
+    EXPECT_EQ(analysis.breakevens.size(), 2u);
+    auto axis = spread_price_axis(params_);
+    auto peak = std::max_element(analysis.expiry_pnl.begin(), analysis.expiry_pnl.end()) - analysis.expiry_pnl.begin();
+    EXPECT_NEAR(axis[peak], 450.0, axis[1] - axis[0]);
+    EXPECT_GT(analysis.vega, 0.0);
+}
+
+TEST_F(SpreadAnalyticsTest, SurfaceRowsFollowTheVolAxis) {
+    params_.price_points = 41;
+    params_.vol_points = 3;
+    auto vols = spread_vol_axis(params_);
+    ASSERT_EQ(vols.size(), 3u);
+    EXPECT_NEAR(vols[0], 0.10, 1e-12);
+    EXPECT_NEAR(vols[2], 0.30, 1e-12);
+
+    auto single = spread({leg("SPY240119C00455000", OrderSide::BuyToOpen)}, 5.0);
+    auto analysis = analyze_spread(single, params_);
+    ASSERT_EQ(analysis.surface.size(), 3u * 41u);
+    ASSERT_EQ(analysis.expiry_pnl.size(), 41u);
+    // A long option gains value with volatility at every price.
+    for (std::size_t p = 0; p < 41; ++p) {
+        EXPECT_LE(analysis.surface_at(0, p), analysis.surface_at(1, p) + 1e-9);
+        EXPECT_LE(analysis.surface_at(1, p), analysis.surface_at(2, p) + 1e-9);
+    }
+
+    // At the expiry horizon the surface collapses onto the expiry payoff.
+    params_.horizon_days = 17.0;
+    auto at_expiry = analyze_spread(single, params_);
+    for (std::size_t p = 0; p < 41; ++p) {
+        EXPECT_NEAR(at_expiry.surface_at(2, p), at_expiry.expiry_pnl[p], 1e-9);
+    }
+}
+
+TEST_F(SpreadAnalyticsTest, BatchMatchesSingleAnalyses) {
+    std::vector<SpreadOrderRequest> orders;
+    for (int i = 0; i < 40; ++i) {
+        orders.push_back(i % 2 == 0 ? iron_condor(430.0 + i / 2, 470.0 + i / 2) : bull_call());
+    }
+    orders.push_back(spread({leg("bad", OrderSide::Buy)}, 1.0));
+    params_.threads = 4;
+    auto batch = analyze_spreads(orders, params_);
+    ASSERT_EQ(batch.size(), orders.size());
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+        auto single = analyze_spread(orders[i], params_);
+        EXPECT_EQ(batch[i].strategy, single.strategy);
+        EXPECT_EQ(batch[i].max_loss, single.max_loss);
+        EXPECT_EQ(batch[i].probability_of_profit, single.probability_of_profit);
+        EXPECT_EQ(batch[i].surface, single.surface);
+    }
+    EXPECT_FALSE(batch.back().ok());
+}
@@ -0,0 +1,139 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <boost/beast/http.hpp>
+#include "oqdTradierpp/core/json_array_splitter.hpp"
+#include "oqdTradierpp/core/padded_body.hpp"
+
+using namespace oqd;
+
+class StreamingBodyTest : public ::testing::Test {
+protected:
+    static std::vector<std::string> split(const std::string& json, std::vector<std::string> path, std::size_t step) {
+        JsonArraySplitter splitter(std::move(path));
+        std::vector<JsonArraySplitter::Range> ranges;
+        for (std::size_t end = step; end < json.size() + step; end += step) {
+            splitter.scan(std::string_view(json).substr(0, std::min(end, json.size())), ranges);
+        }
+        std::vector<std::string> elements;
+        for (const auto& [begin, end] : ranges) {
+            elements.push_back(json.substr(begin, end - begin));
+        }
+        return elements;
+    }
+
+    static std::string http_response(const std::string& body) {
+        return "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+               std::to_string(body.size()) + "\r\n\r\n" + body;
+    }
+};
+
+TEST_F(StreamingBodyTest, SplitsArrayElementsAtAnyChunking) {
+    std::string json = R"({"history":{"day":[{"date":"2025-06-02","close":1.5},)"
+                       R"({"date":"2025-06-03","close":2.5,"note":"a ] } \" , [ {"},)"
+                       R"({"date":"2025-06-04","close":3.5}]},"other":{"day":[{"x":1}]}})";
+    for (std::size_t step : {1u, 7u, 64u, 4096u}) {
+        auto elements = split(json, {"history", "day"}, step);
+        ASSERT_EQ(elements.size(), 3u) << "step " << step;
+        EXPECT_EQ(elements[0], R"({"date":"2025-06-02","close":1.5})");
+        EXPECT_EQ(elements[1], R"({"date":"2025-06-03","close":2.5,"note":"a ] } \" , [ {"})");
+        EXPECT_EQ(elements[2], R"({"date":"2025-06-04","close":3.5})");
+    }
+}
+
+TEST_F(StreamingBodyTest, ReportsElementsBeforeTheDocumentEnds) {
+    std::string json = R"({"series":{"data":[{"price":1},{"price":2},{"price":3}]}})";
+    JsonArraySplitter splitter({"series", "data"});
+    std::vector<JsonArraySplitter::Range> ranges;
+    splitter.scan(std::string_view(json).substr(0, json.find(R"({"price":3)")), ranges);
+    EXPECT_EQ(ranges.size(), 2u);
+    EXPECT_FALSE(splitter.done());
+    splitter.scan(json, ranges);
+    EXPECT_EQ(ranges.size(), 3u);
+    EXPECT_TRUE(splitter.done());
+}
+
+TEST_F(StreamingBodyTest, HandlesCollapsedScalarAndMissingArrays) {
+    auto single = split(R"({"history":{"day":{"date":"2025-06-02","close":1.5}}})", {"history", "day"}, 3);
+    ASSERT_EQ(single.size(), 1u);
+    EXPECT_EQ(single[0], R"({"date":"2025-06-02","close":1.5})");
+
+    auto strikes = split(R"({"strikes":{"strike":[ 100.0, 105.5 ,-1e3]}})", {"strikes", "strike"}, 2);
+    EXPECT_EQ(strikes, (std::vector<std::string>{"100.0", "105.5", "-1e3"}));
+
+    EXPECT_TRUE(split(R"({"history":null})", {"history", "day"}, 5).empty());
+    EXPECT_TRUE(split(R"({"history":{"day":[]}})", {"history", "day"}, 5).empty());
+}
+
+TEST_F(StreamingBodyTest, PaddedBodyReservesContentLengthAndParsesInPlace) {
+    namespace http = boost::beast::http;
+    std::string body = R"({"clock":{"state":"open","timestamp":1751290200}})";
+    std::string raw = http_response(body);
+
+    http::response_parser<padded_body> parser;
+    std::size_t appends = 0;
+    parser.get().body().on_append = [&](const PaddedBuffer&) { ++appends; };
+
+    boost::beast::error_code ec;
+    std::size_t offset = 0;
+    while (offset < raw.size() && !parser.is_done()) {
+        // Hand the parser the rest of the message in small pieces.
+        auto consumed = parser.put(boost::asio::buffer(raw.data() + offset, std::min<std::size_t>(16, raw.size() - offset)), ec);
+        if (ec == http::error::need_more) {
+            ec = {};
+            if (consumed == 0) {
+                // Headers must arrive whole; offer everything that is left.
+                consumed = parser.put(boost::asio::buffer(raw.data() + offset, raw.size() - offset), ec);
+                if (ec == http::error::need_more) {
+                    ec = {};
+                }
+            }
+        }
+        ASSERT_FALSE(ec) << ec.message();
+        offset += consumed;
+    }
+    ASSERT_TRUE(parser.is_done());
+
+    const PaddedBuffer& received = parser.get().body();
+    EXPECT_EQ(received.view(), body);
+    EXPECT_EQ(received.capacity(), body.size());
+    EXPECT_GE(appends, 1u);
+
+    simdjson::dom::parser json;
+    auto doc = json.parse(reinterpret_cast<const std::uint8_t*>(received.data()), received.size(), false);
+    ASSERT_EQ(doc.error(), simdjson::SUCCESS);
+    EXPECT_EQ(std::string_view(doc.value()["clock"]["state"].get_string().value()), "open");
+}
+
+TEST_F(StreamingBodyTest, PoolReusesGrownBuffers) {
+    PaddedBufferPool pool(2, 1024);
+    auto buffer = pool.acquire();
+    buffer.append("0123456789", 10);
+    buffer.reserve(512);
+    const char* storage = buffer.data();
+    pool.release(std::move(buffer));
+    EXPECT_EQ(pool.available(), 1u);
+
+    auto reused = pool.acquire();
+    EXPECT_EQ(reused.data(), storage);
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(reused.capacity(), 512u);
+
+    PaddedBuffer huge;
+    huge.reserve(4096);
+    pool.release(std::move(huge));
+    EXPECT_EQ(pool.available(), 0u);
+}
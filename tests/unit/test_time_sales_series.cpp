@@ -0,0 +1,159 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <string>
+#include "oqdTradierpp/market/time_sales_series.hpp"
+
+using namespace oqd;
+
+class TimeSalesSeriesTest : public ::testing::Test {
+protected:
+    simdjson::dom::element parse(const std::string& json) {
+        json_ = json;
+        return parser_.parse(json_).value();
+    }
+
+    // One tick per second from 09:30:00 UTC on 2019-05-09, price 100 + i.
+    static TimeSalesSeries make_ticks(int count) {
+        TimeSalesSeries series;
+        const std::int64_t start = 1557394200LL * 1'000'000'000LL;
+        for (int i = 0; i < count; ++i) {
+            double price = 100.0 + i;
+            series.push_back(start + i * 1'000'000'000LL, price, price, price, price, price, 10.0 * (i + 1), price);
+        }
+        return series;
+    }
+
+    simdjson::dom::parser parser_;
+    std::string json_;
+};
+
+TEST_F(TimeSalesSeriesTest, ParsesBarResponse) {
+    auto response = parse(R"({"series":{"data":[
+        {"time":"2019-05-09T09:30:00","timestamp":1557394200,"price":200.5,"open":200.0,"high":201.0,
+         "low":199.5,"close":200.75,"volume":1200,"vwap":200.4},
+        {"time":"2019-05-09T09:31:00","timestamp":1557394260,"price":201.0,"open":200.75,"high":201.5,
+         "low":200.5,"close":201.25,"volume":800,"vwap":201.1}]}})");
+
+    auto series = TimeSalesSeries::from_json(response);
+    ASSERT_EQ(series.size(), 2u);
+    EXPECT_EQ(series.timestamp_ns[1], 1557394260LL * 1'000'000'000LL);
+    EXPECT_DOUBLE_EQ(series.high[0], 201.0);
+    EXPECT_DOUBLE_EQ(series.volume[1], 800.0);
+    EXPECT_DOUBLE_EQ(series.vwap[1], 201.1);
+}
+
+TEST_F(TimeSalesSeriesTest, TickRowsFillMissingColumns) {
+    auto response = parse(R"({"series":{"data":
+        {"time":"2019-05-09T09:30:01","price":50.25,"volume":100}}})");
+
+    auto series = TimeSalesSeries::from_json(response);
+    ASSERT_EQ(series.size(), 1u);
+    // No timestamp: "time" is read as exchange-local, 09:30:01 EDT.
+    EXPECT_EQ(series.timestamp_ns[0], 1557408601LL * 1'000'000'000LL);
+    EXPECT_DOUBLE_EQ(series.open[0], 50.25);
+    EXPECT_DOUBLE_EQ(series.low[0], 50.25);
+    EXPECT_DOUBLE_EQ(series.vwap[0], 50.25);
+
+    auto empty = TimeSalesSeries::from_json(parse(R"({"series":null})"));
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(TimeSalesSeriesTest, TimeWithoutTimestampIsEastern) {
+    auto series = TimeSalesSeries::from_json(parse(R"({"series":{"data":[
+        {"time":"2019-01-09T09:30:00","price":1.0},
+        {"time":"2019-03-10T01:59:59","price":1.0},
+        {"time":"2019-03-10T03:00:00","price":1.0},
+        {"time":"2019-11-03T02:00:00","price":1.0},
+        {"time":"2019-02-30T09:30:00","price":1.0},
+        {"time":"2019-5-09T09:30:00","price":1.0}]}})"));
+
+    ASSERT_EQ(series.size(), 6u);
+    constexpr std::int64_t ns = 1'000'000'000LL;
+    EXPECT_EQ(series.timestamp_ns[0], 1547044200LL * ns);  // 14:30 UTC, EST
+    EXPECT_EQ(series.timestamp_ns[1], 1552201199LL * ns);  // 06:59:59 UTC, last EST second
+    EXPECT_EQ(series.timestamp_ns[2], 1552201200LL * ns);  // 07:00 UTC, EDT
+    EXPECT_EQ(series.timestamp_ns[3], 1572764400LL * ns);  // 07:00 UTC, back on EST
+    EXPECT_EQ(series.timestamp_ns[4], 0);
+    EXPECT_EQ(series.timestamp_ns[5], 0);
+}
+
+TEST_F(TimeSalesSeriesTest, VwapAndRange) {
+    auto series = make_ticks(7);
+    // sum(price * 10(i+1)) / sum(10(i+1)) over prices 100..106
+    double notional = 0.0;
+    double shares = 0.0;
+    for (int i = 0; i < 7; ++i) {
+        notional += (100.0 + i) * 10.0 * (i + 1);
+        shares += 10.0 * (i + 1);
+    }
+    EXPECT_NEAR(series.volume_weighted_price(), notional / shares, 1e-12);
+    EXPECT_DOUBLE_EQ(series.total_volume(0, 7), shares);
+
+    auto range = series.range();
+    EXPECT_DOUBLE_EQ(range.low, 100.0);
+    EXPECT_DOUBLE_EQ(range.high, 106.0);
+
+    auto window = series.range(2, 5);
+    EXPECT_DOUBLE_EQ(window.low, 102.0);
+    EXPECT_DOUBLE_EQ(window.high, 104.0);
+    EXPECT_DOUBLE_EQ(series.volume_weighted_price(3, 3), 0.0);
+}
+
+TEST_F(TimeSalesSeriesTest, ResamplesToBars) {
+    auto ticks = make_ticks(150);
+    auto bars = ticks.resample(std::chrono::minutes(1));
+    ASSERT_EQ(bars.size(), 3u);
+
+    EXPECT_EQ(bars.timestamp_ns[0], 1557394200LL * 1'000'000'000LL);
+    EXPECT_EQ(bars.timestamp_ns[1] - bars.timestamp_ns[0], 60LL * 1'000'000'000LL);
+    EXPECT_DOUBLE_EQ(bars.open[0], 100.0);
+    EXPECT_DOUBLE_EQ(bars.close[0], 159.0);
+    EXPECT_DOUBLE_EQ(bars.high[1], 219.0);
+    EXPECT_DOUBLE_EQ(bars.low[2], 220.0);
+    EXPECT_DOUBLE_EQ(bars.close[2], 249.0);
+    EXPECT_DOUBLE_EQ(bars.total_volume(0, 3), ticks.total_volume(0, ticks.size()));
+    EXPECT_NEAR(bars.volume_weighted_price(), ticks.volume_weighted_price(), 1e-9);
+
+    EXPECT_EQ(ticks.lower_bound(bars.timestamp_ns[1]), 60u);
+}
+
+TEST_F(TimeSalesSeriesTest, RecordsRoundTrip) {
+    auto ticks = make_ticks(3);
+    auto records = ticks.to_records();
+    ASSERT_EQ(records.size(), 3u);
+    EXPECT_EQ(records[2].time, "2019-05-09T09:30:02");
+    EXPECT_DOUBLE_EQ(records[2].timestamp, 1557394202.0);
+
+    auto back = TimeSalesSeries::from_records(records);
+    EXPECT_EQ(back.timestamp_ns, ticks.timestamp_ns);
+    EXPECT_EQ(back.close, ticks.close);
+}
+
+TEST_F(TimeSalesSeriesTest, RecordsFromJsonKeepExchangeTime) {
+    // Tradier's "time" is exchange-local: 09:30 ET is 13:30 UTC.
+    auto response = parse(R"({"series":{"data":{"time":"2019-05-09T09:30:00","timestamp":1557408600,
+        "price":200.5,"open":200.0,"high":201.0,"low":199.5,"close":200.75,"volume":1200,"vwap":200.4}}})");
+    auto row = response["series"]["data"].value();
+
+    auto record = TimeSales::from_json(row);
+    EXPECT_EQ(record.time, "2019-05-09T09:30:00");
+    EXPECT_DOUBLE_EQ(record.timestamp, 1557408600.0);
+
+    // The columnar form keeps only the UTC instant.
+    auto rebuilt = TimeSalesSeries::from_json(response).to_records();
+    ASSERT_EQ(rebuilt.size(), 1u);
+    EXPECT_EQ(rebuilt[0].time, "2019-05-09T13:30:00");
+    EXPECT_DOUBLE_EQ(rebuilt[0].timestamp, record.timestamp);
+}
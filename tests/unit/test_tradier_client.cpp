@@ -0,0 +1,80 @@
+/*
+/        oqdTradierpp - Full featured Tradier API library 
+/       
+/        Authors:  Benjamin Cance (kc8bws@kc8bws.com), OQD Developer Team (developers@openquantdesk.com)
+/        Version:           v1.1
+/        Release Date:  06/30/2025
+/        License: Apache 2.0
+/        Disclaimer: This software is provided "as-is" without warranties of any kind. 
+/                    Use at your own risk. The authors are not liable for any trading losses.
+/                    Not financial advice. By using this software, you accept all risks.
+/
+*/
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "oqdTradierpp/client.hpp"
+#include "oqdTradierpp/endpoints.hpp"
+#include "oqdTradierpp/market/market_status.hpp"
+#include "loopback_server.hpp"
+
+using namespace oqd;
+
+class TradierClientMoveTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server_ = std::make_unique<LoopbackServer>(
+            R"({"clock":{"date":"2025-06-30","description":"Market is open from 09:30 to 16:00",)"
+            R"("state":"open","timestamp":1751290200,"next_change":"16:00","next_state":"postmarket"}})");
+    }
+
+    // Leaves one idle pooled connection to the loopback server behind.
+    void connect(TradierClient& client) {
+        client.set_base_url(server_->base_url());
+        client.set_access_token("test");
+        auto clock = client.get_endpoint_then(endpoints::markets::clock, {}, MarketClock::from_json).get();
+        EXPECT_EQ(clock.state, "open");
+        EXPECT_EQ(client.idle_connections(), 1u);
+    }
+
+    std::unique_ptr<LoopbackServer> server_;
+};
+
+TEST_F(TradierClientMoveTest, MoveKeepsSettings) {
+    static_assert(std::is_move_constructible_v<TradierClient>);
+    static_assert(std::is_nothrow_move_assignable_v<TradierClient>);
+
+    TradierClient client(Environment::Sandbox);
+    client.set_compression_enabled(false);
+    TradierClient moved(std::move(client));
+    EXPECT_FALSE(moved.compression_enabled());
+    EXPECT_TRUE(moved.connection_pooling());
+    EXPECT_EQ(moved.get_base_url(), "https://sandbox.tradier.com");
+
+    TradierClient assigned(Environment::Production);
+    assigned = std::move(moved);
+    EXPECT_FALSE(assigned.compression_enabled());
+    EXPECT_EQ(assigned.get_base_url(), "https://sandbox.tradier.com");
+}
+
+TEST_F(TradierClientMoveTest, MoveAssignmentClosesIdleConnections) {
+    TradierClient target(Environment::Production);
+    connect(target);
+
+    TradierClient source(Environment::Sandbox);
+    connect(source);
+    source.set_compression_enabled(false);
+
+    // The target's idle stream is bound to the io_context being replaced.
+    target = std::move(source);
+    EXPECT_FALSE(target.compression_enabled());
+    EXPECT_EQ(target.get_base_url(), server_->base_url());
+    EXPECT_EQ(target.idle_connections(), 1u);
+
+    // The adopted pool and contexts still serve requests.
+    auto clock = target.get_endpoint_then(endpoints::markets::clock, {}, MarketClock::from_json).get();
+    EXPECT_EQ(clock.state, "open");
+    EXPECT_EQ(target.idle_connections(), 1u);
+}